@@ -6,8 +6,11 @@
 #include <set>
 #include <utility>
 #include <chrono>
+#include <functional>
 #include "Core/interface/TreeEvent.h"
 
+class TTree;
+
 namespace ic {
 class ModuleBase;
 }
@@ -45,6 +48,29 @@ class AnalysisBase {
   unsigned retry_pause_;
   unsigned retry_attempts_;
   bool timings_;
+  bool event_snapshots_;
+  std::function<std::vector<int64_t>(TTree*)> preselection_;
+  std::function<void()> pre_loop_fn_;
+  int64_t first_entry_;
+  int64_t last_entry_;
+  std::vector<int64_t> input_entries_;
+  std::vector<std::vector<int64_t>> picked_entries_;
+  std::string checkpoint_path_;
+  unsigned checkpoint_events_;
+  std::function<void(unsigned)> checkpoint_fn_;
+  unsigned checkpoint_segment_;
+  // The highest checkpoint number in use, the number the outputs were
+  // selected to be at on resuming (-1 for the latest), and the record the
+  // outputs were last saved at, which is kept in the checkpoint file next
+  // to the new one
+  unsigned checkpoint_number_;
+  int checkpoint_selected_;
+  std::string checkpoint_last_;
+
+  void WriteCheckpoint(unsigned file, int64_t entry, int64_t file_offset);
+  std::vector<std::string> ReadCheckpointRecords() const;
+  bool ReadCheckpoint(unsigned & file, int64_t & entry, int64_t & file_offset,
+                      unsigned & number);
 
  public:
   AnalysisBase(std::string const& analysis_name,
@@ -74,6 +100,47 @@ class AnalysisBase {
   void RetryFileAfterFailure(unsigned pause_in_seconds,
                              unsigned retry_attempts);
   void CalculateTimings(bool const& value);
+  /// Decode each entry once and restore it for the other sequences, if
+  /// there is more than one and no module requires fresh reads (default)
+  void SetEventSnapshots(bool const& value);
+  /// Only process the entries of each input tree returned by fn, which
+  /// must be in increasing order, e.g. LumiMask::AcceptedEntries. The
+  /// other entries are never read or passed to any module.
+  void SetEntryPreselection(
+      std::function<std::vector<int64_t>(TTree*)> const& fn);
+  /// Called once the PreAnalysis of every module has run, before the first
+  /// event, e.g. to configure the output trees booked by the modules
+  void SetPreLoopFunction(std::function<void()> const& fn);
+  /// Only process the entries [first, last) of the input trees, numbered
+  /// across all the input files in the order given. A negative last means
+  /// up to the end of the last file.
+  void SetEntryRange(int64_t first, int64_t last);
+  /// The number of entries in each input tree, if known in advance, e.g.
+  /// from a job plan. Files entirely outside the entry range are then
+  /// skipped without being opened.
+  void SetInputEntries(std::vector<int64_t> const& entries);
+  /// Only process the given entries of each input file, in increasing
+  /// order, e.g. from ic::EventIndex::PickedEntries. Files with none are
+  /// not opened. This replaces the entry preselection and cannot be
+  /// combined with an entry range.
+  void SetPickedEntries(std::vector<std::vector<int64_t>> const& entries);
+  /// Every n events record the input position and the module counters in
+  /// path under a new checkpoint number, then call fn with that number. fn
+  /// should save the outputs of the modules as they are at that point
+  /// together with the number (e.g. with ic::AutoSaveDirectory). fn is also
+  /// called before the first event with the number the attempt starts from.
+  /// The record the outputs were saved at before is kept in path as well,
+  /// so that a crash while saving leaves a record matching the outputs. If
+  /// path already holds a checkpoint of an earlier attempt at the job, the
+  /// event loop carries on from it, see SelectCheckpoint. Returns the number
+  /// of attempts that have saved outputs before this one, so that the caller
+  /// can keep the outputs of this attempt separate and merge them at the end.
+  unsigned SetCheckpoint(std::string const& path, unsigned n,
+                         std::function<void(unsigned)> const& fn);
+  /// Resume from the checkpoint record with this number, which should be
+  /// the one saved in the outputs of the previous attempt. Without it the
+  /// latest record is used.
+  void SelectCheckpoint(unsigned number);
 };
 }
 
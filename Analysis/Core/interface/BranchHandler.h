@@ -20,6 +20,11 @@ template <class T, bool X = std::is_fundamental<T>::value>
 class BranchHandler : public BranchHandlerBase {
  private:
   T* ptr_;
+  T pristine_;
+
+ protected:
+  void Snapshot() { if (ptr_) pristine_ = *ptr_; }
+  void Restore() { if (ptr_) *ptr_ = pristine_; }
 
  public:
   BranchHandler() : BranchHandlerBase(), ptr_(nullptr) {}
@@ -45,14 +50,19 @@ template <class T>
 class BranchHandler<T, true> : public BranchHandlerBase {
  private:
   T obj_;
+  T pristine_;
+
+ protected:
+  void Snapshot() { pristine_ = obj_; }
+  void Restore() { obj_ = pristine_; }
 
  public:
-  BranchHandler() : BranchHandlerBase(), obj_(T()) {
+  BranchHandler() : BranchHandlerBase(), obj_(T()), pristine_(T()) {
     SetBranchPtr(0);
   }
 
   BranchHandler(TTree* tree, std::string const& branch_name)
-      : BranchHandlerBase(), obj_(T()) {
+      : BranchHandlerBase(), obj_(T()), pristine_(T()) {
     if (tree) {
       TBranch* branch_ptr = tree->GetBranch(branch_name.c_str());
       if (branch_ptr) this->SetBranchPtr(branch_ptr);
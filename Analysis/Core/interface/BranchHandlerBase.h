@@ -15,20 +15,51 @@ class BranchHandlerBase {
   BranchHandlerBase();
   virtual ~BranchHandlerBase();
   virtual void SetAddress() = 0;
+  /**
+   * Makes sure the object holds entry i
+   *
+   * The branch is only decoded when i changes. If the same entry is
+   * requested again after SetNoOverwrite(false), i.e. by the next sequence,
+   * the object is restored from the snapshot taken when it was decoded, and
+   * only if it was marked dirty in the meantime. Without snapshots the
+   * branch is decoded again instead.
+   */
   inline void GetEntry(int64_t i) {
-    if ((!no_overwrite_) || (no_overwrite_ && i != current_)) {
+    if (i != current_) {
       branch_ptr_->GetEntry(i);
+      if (snapshots_) Snapshot();
+      dirty_ = false;
+    } else if (!no_overwrite_) {
+      if (!snapshots_) {
+        branch_ptr_->GetEntry(i);
+      } else if (dirty_) {
+        Restore();
+      }
+      dirty_ = false;
     }
     current_ = i;
   }
   inline void SetBranchPtr(TBranch* ptr) { branch_ptr_ = ptr; }
   inline TBranch* GetBranchPtr() { return branch_ptr_; }
   inline void SetNoOverwrite(bool const& flag) { no_overwrite_ = flag; }
+  /// Keep a copy of each decoded entry to restore from (see GetEntry)
+  inline void SetSnapshots(bool const& flag) {
+    snapshots_ = flag;
+    current_ = -1;
+  }
+  /// Flag that the object may have been modified since it was restored
+  inline void SetDirty() { dirty_ = true; }
+
+ protected:
+  virtual void Snapshot() = 0;
+  virtual void Restore() = 0;
 
  private:
   TBranch* branch_ptr_;
   int64_t current_;
   bool no_overwrite_;
+  bool snapshots_;
+  bool dirty_;
 };
 }
 
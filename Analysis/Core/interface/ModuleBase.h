@@ -42,6 +42,10 @@ class ModuleBase {
   virtual int Execute(ic::TreeEvent*) = 0;
   inline virtual int PostAnalysis() { return 0; }
   inline virtual void PrintInfo() { return; }
+  /// Return true if the module needs the objects it reads from the tree to
+  /// be decoded again for each sequence rather than restored from a copy
+  /// (see TreeEvent::SetSnapshots). This turns snapshots off for the job.
+  inline virtual bool RequiresFreshReads() { return false; }
 };
 }
 
@@ -22,8 +22,12 @@ class TreeEvent : public Event {
   std::map<std::string, std::function<void(int64_t)> > cached_funcs_;
 
   std::vector<std::function<void(int64_t)> > auto_add_funcs_;
+  // The handler each product read from the tree came from
+  std::map<std::string, BranchHandlerBase*> product_handlers_;
+  std::vector<BranchHandlerBase*> auto_add_handlers_;
   TTree* tree_;
   int64_t event_;
+  bool snapshots_;
 
   std::set<std::string> branch_names_;
 
@@ -37,6 +41,7 @@ class TreeEvent : public Event {
       BranchHandler<T>* handler =
           new BranchHandler<T>(tree_, branch_name);
       handler->SetAddress();
+      handler->SetSnapshots(snapshots_);
       handlers_[branch_name] = handler;
       return handler;
     } else {
@@ -79,61 +84,14 @@ class TreeEvent : public Event {
     Add(prod_name, temp_map);
   }
 
- public:
-  TreeEvent();
-  virtual ~TreeEvent();
-
-  bool ExistsInTree(std::string const& branch_name);
-  bool ExistsInEvent(std::string const& name);
-
-  template <class T>
-  void AutoAddPtr(std::string const& name, std::string branch_name = "") {
-    // Check if a branch handler already exists with this branch_name
-    if (branch_name == "") branch_name = name;
-    if (ExistsInTree(branch_name)) {
-      // Return the BranchHandler for this branch, creating it if
-      // necessary (will fail if SetupHandler dynamic_cast fails)
-      BranchHandler<T>* bh = SetupHandler<T>(branch_name);
-      // Create and store a function to extract the product from the tree
-      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyPtr<T>, this,
-                                          name, bh, std::placeholders::_1));
-    }
+  // Called on non-const access: the objects of this product may be modified
+  void MarkModified(std::string const& name) {
+    auto it = product_handlers_.find(name);
+    if (it != product_handlers_.end()) it->second->SetDirty();
   }
 
   template <class T>
-  void AutoAddPtrVec(std::string const& name,
-                     std::string branch_name = "") {
-    typedef std::vector<T> Vector_T;
-    // Check if a branch handler already exists with this branch_name
-    if (branch_name == "") branch_name = name;
-    if (ExistsInTree(branch_name)) {
-      // Return the BranchHandler for this branch, creating it if
-      // necessary (will fail if SetupHandler dynamic_cast fails)
-      BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
-      // Creat and store a function to extract the product from the tree
-      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyPtrVec<T>, this,
-                                          name, bh, std::placeholders::_1));
-    }
-  }
-
-  template <class T>
-  void AutoAddIDMap(std::string const& name,
-                    std::string branch_name = "") {
-    typedef std::vector<T> Vector_T;
-    // Check if a branch handler already exists with this branch_name
-    if (branch_name == "") branch_name = name;
-    if (ExistsInTree(branch_name)) {
-      // Return the BranchHandler for this branch, creating it if
-      // necessary (will fail if SetupHandler dynamic_cast fails)
-      BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
-      // Creat and store a function to extract the product from the tree
-      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyIDMap<T>, this,
-                                          name, bh, std::placeholders::_1));
-    }
-  }
-
-  template <class T>
-  T* GetPtr(std::string const& name, std::string branch_name = "") {
+  T* FindPtr(std::string const& name, std::string branch_name) {
     // If the product is already in the event: just return it
     if (ExistsInEvent(name)) return Get<T*>(name);
     // If a function to extract the product from the tree exists:
@@ -149,6 +107,7 @@ class TreeEvent : public Event {
       // Return the BranchHandler for this branch, creating it if
       // necessary (will fail if SetupHandler dynamic_cast fails)
       BranchHandler<T>* bh = SetupHandler<T>(branch_name);
+      product_handlers_[name] = bh;
       // Create and store a function to extract the product from the tree
       cached_funcs_[name] = std::bind(&TreeEvent::CopyPtr<T>, this, name,
                                       bh, std::placeholders::_1);
@@ -162,8 +121,8 @@ class TreeEvent : public Event {
   }
 
   template <class T>
-  std::vector<T*>& GetPtrVec(std::string const& name,
-                             std::string branch_name = "") {
+  std::vector<T*>& FindPtrVec(std::string const& name,
+                              std::string branch_name) {
     typedef std::vector<T*> Vector_TP;
     typedef std::vector<T> Vector_T;
     // If the product is already in the event: just return it
@@ -181,6 +140,7 @@ class TreeEvent : public Event {
       // Return the BranchHandler for this branch, creating it if
       // necessary (will fail if SetupHandler dynamic_cast fails)
       BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
+      product_handlers_[name] = bh;
       // Creat and store a function to extract the product from the tree
       cached_funcs_[name] = std::bind(&TreeEvent::CopyPtrVec<T>, this, name,
                                       bh, std::placeholders::_1);
@@ -194,8 +154,8 @@ class TreeEvent : public Event {
   }
 
   template <class T>
-  std::map<std::size_t, T*>& GetIDMap(std::string const& name,
-                                      std::string branch_name = "") {
+  std::map<std::size_t, T*>& FindIDMap(std::string const& name,
+                                       std::string branch_name) {
     typedef std::map<std::size_t, T*> Map_TP;
     typedef std::vector<T> Vector_T;
     // If the product is already in the event: just return it
@@ -213,6 +173,7 @@ class TreeEvent : public Event {
       // Return the BranchHandler for this branch, creating it if
       // necessary (will fail if SetupHandler dynamic_cast fails)
       BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
+      product_handlers_[name] = bh;
       // Creat and store a function to extract the product from the tree
       cached_funcs_[name] = std::bind(&TreeEvent::CopyIDMap<T>, this, name,
                                       bh, std::placeholders::_1);
@@ -225,8 +186,128 @@ class TreeEvent : public Event {
     }
   }
 
+ public:
+  TreeEvent();
+  virtual ~TreeEvent();
+
+  bool ExistsInTree(std::string const& branch_name);
+  bool ExistsInEvent(std::string const& name);
+
+  template <class T>
+  void AutoAddPtr(std::string const& name, std::string branch_name = "") {
+    // Check if a branch handler already exists with this branch_name
+    if (branch_name == "") branch_name = name;
+    if (ExistsInTree(branch_name)) {
+      // Return the BranchHandler for this branch, creating it if
+      // necessary (will fail if SetupHandler dynamic_cast fails)
+      BranchHandler<T>* bh = SetupHandler<T>(branch_name);
+      product_handlers_[name] = bh;
+      auto_add_handlers_.push_back(bh);
+      // Create and store a function to extract the product from the tree
+      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyPtr<T>, this,
+                                          name, bh, std::placeholders::_1));
+    }
+  }
+
+  template <class T>
+  void AutoAddPtrVec(std::string const& name,
+                     std::string branch_name = "") {
+    typedef std::vector<T> Vector_T;
+    // Check if a branch handler already exists with this branch_name
+    if (branch_name == "") branch_name = name;
+    if (ExistsInTree(branch_name)) {
+      // Return the BranchHandler for this branch, creating it if
+      // necessary (will fail if SetupHandler dynamic_cast fails)
+      BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
+      product_handlers_[name] = bh;
+      auto_add_handlers_.push_back(bh);
+      // Creat and store a function to extract the product from the tree
+      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyPtrVec<T>, this,
+                                          name, bh, std::placeholders::_1));
+    }
+  }
+
+  template <class T>
+  void AutoAddIDMap(std::string const& name,
+                    std::string branch_name = "") {
+    typedef std::vector<T> Vector_T;
+    // Check if a branch handler already exists with this branch_name
+    if (branch_name == "") branch_name = name;
+    if (ExistsInTree(branch_name)) {
+      // Return the BranchHandler for this branch, creating it if
+      // necessary (will fail if SetupHandler dynamic_cast fails)
+      BranchHandler<Vector_T>* bh = SetupHandler<Vector_T>(branch_name);
+      product_handlers_[name] = bh;
+      auto_add_handlers_.push_back(bh);
+      // Creat and store a function to extract the product from the tree
+      auto_add_funcs_.push_back(std::bind(&TreeEvent::CopyIDMap<T>, this,
+                                          name, bh, std::placeholders::_1));
+    }
+  }
+
+  /**
+   * The product name, read from branch_name (= name if empty) of the tree
+   * if it is not already in the event
+   *
+   * The object may be modified by the caller, so with snapshots enabled it
+   * will be restored before the next sequence sees it.
+   */
+  template <class T>
+  T* GetPtr(std::string const& name, std::string branch_name = "") {
+    T* ptr = FindPtr<T>(name, branch_name);
+    MarkModified(name);
+    return ptr;
+  }
+
+  /**
+   * As GetPtr, for read-only access: the object is not restored for the
+   * next sequence on account of this call
+   */
+  template <class T>
+  T const* GetConstPtr(std::string const& name, std::string branch_name = "") {
+    return FindPtr<T>(name, branch_name);
+  }
+
+  template <class T>
+  std::vector<T*>& GetPtrVec(std::string const& name,
+                             std::string branch_name = "") {
+    std::vector<T*>& vec = FindPtrVec<T>(name, branch_name);
+    MarkModified(name);
+    return vec;
+  }
+
+  /**
+   * As GetPtrVec, for read-only access: the caller must not modify the
+   * objects, which are not restored for the next sequence on account of
+   * this call
+   */
+  template <class T>
+  std::vector<T*> const& GetConstPtrVec(std::string const& name,
+                                        std::string branch_name = "") {
+    return FindPtrVec<T>(name, branch_name);
+  }
+
+  template <class T>
+  std::map<std::size_t, T*>& GetIDMap(std::string const& name,
+                                      std::string branch_name = "") {
+    std::map<std::size_t, T*>& map = FindIDMap<T>(name, branch_name);
+    MarkModified(name);
+    return map;
+  }
+
   void SetEvent(int64_t event);
 
+  /**
+   * Decode each branch once per entry and keep a copy of it
+   *
+   * When several sequences run over the same entry, each calls SetEvent
+   * for it. With snapshots the later calls do not decode the branches
+   * again, but restore the objects that were accessed through a non-const
+   * getter (GetPtr, GetPtrVec, GetIDMap) since from their copies. Without
+   * them every branch used is decoded again for every sequence.
+   */
+  void SetSnapshots(bool const& value);
+
   void SetTree(TTree* tree);
   void DeleteAndClearHandlers();
 
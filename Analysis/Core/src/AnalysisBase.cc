@@ -1,6 +1,10 @@
 #include "Core/interface/AnalysisBase.h"
 #include <unistd.h>
+#include <cstdio>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -31,7 +35,14 @@ AnalysisBase::AnalysisBase(std::string const& analysis_name,
       retry_on_fail_(false),
       retry_pause_(5),
       retry_attempts_(1),
-      timings_(false) {}
+      timings_(false),
+      event_snapshots_(true),
+      first_entry_(0),
+      last_entry_(-1),
+      checkpoint_events_(0),
+      checkpoint_segment_(0),
+      checkpoint_number_(0),
+      checkpoint_selected_(-1) {}
 
 AnalysisBase::~AnalysisBase() { ; }
 
@@ -71,6 +82,32 @@ int AnalysisBase::RunAnalysis() {
                    input_files_.size();
   std::cout << boost::format("%-15s : %-60s\n") % "Tree Path" % tree_path();
   std::cout << boost::format("%-15s : %-60s\n") % "Events" % events_to_process_;
+  bool entry_range = first_entry_ > 0 || last_entry_ >= 0;
+  if (entry_range) {
+    std::cout << boost::format("%-15s : [%i, %s)\n") % "Entry Range" %
+                     first_entry_ %
+                     (last_entry_ >= 0 ? std::to_string(last_entry_) : "end");
+  }
+  bool picking = picked_entries_.size() > 0;
+  if (picking) {
+    if (picked_entries_.size() != input_files_.size()) {
+      throw std::runtime_error(
+          "The picked entries given do not match the input files");
+    }
+    if (entry_range) {
+      throw std::runtime_error(
+          "Picked entries cannot be combined with an entry range");
+    }
+    unsigned n_picked = 0;
+    for (auto const& entries : picked_entries_) n_picked += entries.size();
+    std::cout << boost::format("%-15s : %-60s\n") % "Picked Entries" %
+                     n_picked;
+  }
+  bool known_entries = input_entries_.size() == input_files_.size();
+  if (input_entries_.size() && !known_entries) {
+    throw std::runtime_error(
+        "The number of input entries given does not match the input files");
+  }
 
   if (print_module_list_) {
     for (auto & seq : seqs_) {
@@ -109,17 +146,66 @@ int AnalysisBase::RunAnalysis() {
                   boost::bind(&ModuleBase::PreAnalysis, _1));
   }
 
+  if (pre_loop_fn_) pre_loop_fn_();
+
+  bool snapshots = event_snapshots_ && seqs_.size() > 1;
+  for (auto & seq : seqs_) {
+    for (auto module : seq.modules) {
+      if (snapshots && module->RequiresFreshReads()) {
+        std::cout << ">> Event snapshots disabled by module "
+                  << module->ModuleName() << "\n";
+        snapshots = false;
+      }
+    }
+  }
+  event_.SetSnapshots(snapshots);
+  if (snapshots) {
+    std::cout << ">> Event snapshots enabled for " << seqs_.size()
+              << " sequences\n";
+  }
+
+  // The global number of the first entry in the current file
+  int64_t file_offset = 0;
+  unsigned resume_file = 0;
+  int64_t resume_entry = 0;
+  bool checkpoints = checkpoint_path_ != "" && checkpoint_events_ > 0;
+  if (checkpoints) {
+    if (do_skim) {
+      throw std::runtime_error("Checkpoints cannot be used with skimming");
+    }
+    std::cout << ">> Checkpoint every " << checkpoint_events_
+              << " events to " << checkpoint_path_ << "\n";
+    unsigned resume_number = 0;
+    if (ReadCheckpoint(resume_file, resume_entry, file_offset, resume_number)) {
+      std::cout << ">> Resuming from checkpoint " << resume_number
+                << " at entry " << resume_entry << " of file " << resume_file
+                << " with " << events_processed_ << " events processed\n";
+    }
+    // The outputs of this attempt are still empty, so they match the record
+    // resumed from until the first new one is written
+    if (checkpoint_fn_) checkpoint_fn_(resume_number);
+  }
+
   std::cout << std::string(78, '-') << "\n";
   std::cout << "Beginning Analysis Sequence" << std::endl;
   std::cout << std::string(78, '-') << "\n";
 
   // Timers if we want them
   std::chrono::time_point<std::chrono::system_clock> start, end;
+  std::chrono::time_point<std::chrono::system_clock> loop_start =
+      std::chrono::system_clock::now();
+  unsigned loop_events_start = events_processed_;
 
-  for (unsigned file = 0; file < input_files_.size(); ++file) {
+  for (unsigned file = resume_file; file < input_files_.size(); ++file) {
     // Stop looping through files if user-specified events have
     // been processed
     if (events_processed_ == events_to_process_) break;
+    if (last_entry_ >= 0 && file_offset >= last_entry_) break;
+    if (picking && picked_entries_[file].empty()) continue;
+    if (known_entries && file_offset + input_entries_[file] <= first_entry_) {
+      file_offset += input_entries_[file];
+      continue;
+    }
 
     std::vector<std::string> in_name;
     std::string out_name;
@@ -161,10 +247,34 @@ int AnalysisBase::RunAnalysis() {
       if (stop_on_failed_file_) {
         throw std::runtime_error("Error: input tree could not be located");
       } else {
+        if (known_entries) file_offset += input_entries_[file];
         continue;
       }
     }
+    int64_t tree_entries = tree_ptr->GetEntries();
+    if (known_entries && tree_entries != input_entries_[file]) {
+      std::cerr << ">> Error: Expected " << input_entries_[file]
+                << " entries in file \"" << input_files_[file] << "\", found "
+                << tree_entries << "\n";
+      throw std::runtime_error("Input tree does not have the expected entries");
+    }
+    // The local entries [lo, hi) of this tree in the entry range
+    int64_t lo = std::max(first_entry_ - file_offset, int64_t(0));
+    if (file == resume_file) lo = std::max(lo, resume_entry);
+    int64_t hi = last_entry_ >= 0
+                     ? std::min(last_entry_ - file_offset, tree_entries)
+                     : tree_entries;
+    file_offset += tree_entries;
+    if (hi <= lo) {
+      file_ptr->Close();
+      delete file_ptr;
+      continue;
+    }
     std::cout << ">> File: " << input_files_[file] << "\n";
+    if (entry_range) {
+      std::cout << ">> Entries [" << lo << ", " << hi << ") of " << tree_entries
+                << "\n";
+    }
     TFile* outf = nullptr;
     TTree* outtree = nullptr;
     if (do_skim) {
@@ -195,11 +305,24 @@ int AnalysisBase::RunAnalysis() {
       tree_ptr->SetCacheLearnEntries(100);
     }
 
-    unsigned tree_events = tree_ptr->GetEntries();
+    unsigned tree_events = hi - lo;
+    bool use_entries = picking || preselection_;
+    std::vector<int64_t> entries;
+    if (use_entries) {
+      entries = picking ? picked_entries_[file] : preselection_(tree_ptr);
+      entries.erase(std::lower_bound(entries.begin(), entries.end(), hi),
+                    entries.end());
+      entries.erase(entries.begin(),
+                    std::lower_bound(entries.begin(), entries.end(), lo));
+      std::cout << (picking ? ">> Picked " : ">> Preselected ")
+                << entries.size() << "/" << tree_events << " entries\n";
+      tree_events = entries.size();
+    }
     event_.SetTree(tree_ptr);
     DoEventSetup();
     //bool exception_check=false;
-    for (unsigned evt = 0; evt < tree_events; ++evt) {
+    for (unsigned ientry = 0; ientry < tree_events; ++ientry) {
+      int64_t evt = use_entries ? entries[ientry] : lo + ientry;
       // if(exception_check){
       // 	try{
 	  if (ttree_caching_) tree_ptr->LoadTree(evt);
@@ -259,6 +382,9 @@ int AnalysisBase::RunAnalysis() {
         outtree->Fill();
       }
       ++events_processed_;
+      if (checkpoints && events_processed_ % checkpoint_events_ == 0) {
+        WriteCheckpoint(file, evt + 1, file_offset - tree_entries);
+      }
       if (events_processed_ % 10000 == 0) {
         std::cout << ">> Processed " << events_processed_ << " events...\r"
                   << std::flush;
@@ -274,8 +400,16 @@ int AnalysisBase::RunAnalysis() {
     }
   }
 
+  std::chrono::duration<double> loop_time =
+      std::chrono::system_clock::now() - loop_start;
   std::cout << ">> Processing Complete: " << events_processed_
             << " events processed\n";
+  // Read back by python/jobs.py to estimate the cost per event of a sample
+  if (timings_) {
+    std::cout << boost::format(">> Event loop: %i events in %.3f s\n") %
+                     (events_processed_ - loop_events_start) %
+                     loop_time.count();
+  }
   for (auto & seq : seqs_) {
     std::cout << std::string(78, '-') << "\n";
     if (!timings_) {
@@ -341,4 +475,153 @@ void AnalysisBase::WriteSkimHere(std::string const& seq_name) {
 void AnalysisBase::CalculateTimings(bool const& value) {
   timings_ = value;
 }
+
+void AnalysisBase::SetEventSnapshots(bool const& value) {
+  event_snapshots_ = value;
+}
+
+void AnalysisBase::SetEntryPreselection(
+    std::function<std::vector<int64_t>(TTree*)> const& fn) {
+  preselection_ = fn;
+}
+
+void AnalysisBase::SetPreLoopFunction(std::function<void()> const& fn) {
+  pre_loop_fn_ = fn;
+}
+
+void AnalysisBase::SetEntryRange(int64_t first, int64_t last) {
+  first_entry_ = first;
+  last_entry_ = last;
+}
+
+void AnalysisBase::SetInputEntries(std::vector<int64_t> const& entries) {
+  input_entries_ = entries;
+}
+
+void AnalysisBase::SetPickedEntries(
+    std::vector<std::vector<int64_t>> const& entries) {
+  picked_entries_ = entries;
+}
+
+unsigned AnalysisBase::SetCheckpoint(std::string const& path, unsigned n,
+                                     std::function<void(unsigned)> const& fn) {
+  checkpoint_path_ = path;
+  checkpoint_events_ = n;
+  checkpoint_fn_ = fn;
+  // The attempt that wrote the latest record has saved outputs, this one is
+  // next
+  checkpoint_segment_ = 0;
+  std::vector<std::string> records = ReadCheckpointRecords();
+  if (!records.empty()) {
+    std::istringstream in(records.back());
+    std::string key;
+    unsigned number = 0;
+    in >> key >> number >> key >> checkpoint_segment_;
+    if (!in) {
+      throw std::runtime_error("Unable to read checkpoint " + checkpoint_path_);
+    }
+    ++checkpoint_segment_;
+  }
+  return checkpoint_segment_;
+}
+
+void AnalysisBase::SelectCheckpoint(unsigned number) {
+  checkpoint_selected_ = number;
+}
+
+void AnalysisBase::WriteCheckpoint(unsigned file, int64_t entry,
+                                   int64_t file_offset) {
+  ++checkpoint_number_;
+  std::ostringstream record;
+  record << std::setprecision(17);
+  record << "checkpoint " << checkpoint_number_ << "\n";
+  record << "segment " << checkpoint_segment_ << "\n";
+  record << "file " << file << "\n";
+  record << "entry " << entry << "\n";
+  record << "offset " << file_offset << "\n";
+  record << "events " << events_processed_ << "\n";
+  for (auto const& seq : seqs_) {
+    record << "sequence " << seq.name << " " << seq.modules.size() << "\n";
+    for (unsigned i = 0; i < seq.modules.size(); ++i) {
+      record << seq.proc_counters[i] << " " << seq.counters[i] << " "
+             << seq.timers[i] << "\n";
+    }
+  }
+  // Written in full before it replaces the last one, so that a crash at
+  // any point leaves a complete checkpoint behind. The outputs are only
+  // saved afterwards, so until they are the previous record is the one
+  // that matches them.
+  std::string tmp_path = checkpoint_path_ + ".tmp";
+  std::ofstream out(tmp_path.c_str());
+  out << checkpoint_last_ << record.str();
+  out.close();
+  if (!out || std::rename(tmp_path.c_str(), checkpoint_path_.c_str()) != 0) {
+    throw std::runtime_error("Unable to write checkpoint " + checkpoint_path_);
+  }
+  if (checkpoint_fn_) checkpoint_fn_(checkpoint_number_);
+  checkpoint_last_ = record.str();
+}
+
+std::vector<std::string> AnalysisBase::ReadCheckpointRecords() const {
+  std::vector<std::string> records;
+  std::ifstream in(checkpoint_path_.c_str());
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.compare(0, 11, "checkpoint ") == 0) records.push_back("");
+    if (records.empty()) {
+      throw std::runtime_error("Unable to read checkpoint " + checkpoint_path_);
+    }
+    records.back() += line + "\n";
+  }
+  return records;
+}
+
+bool AnalysisBase::ReadCheckpoint(unsigned & file, int64_t & entry,
+                                  int64_t & file_offset, unsigned & number) {
+  std::vector<std::string> records = ReadCheckpointRecords();
+  if (records.empty()) return false;
+  // New records get numbers beyond all of those already used
+  std::string key;
+  std::string const* chosen = checkpoint_selected_ < 0 ? &records.back() : nullptr;
+  for (auto const& record : records) {
+    std::istringstream in(record);
+    unsigned n = 0;
+    in >> key >> n;
+    checkpoint_number_ = std::max(checkpoint_number_, n);
+    if (checkpoint_selected_ >= 0 && n == unsigned(checkpoint_selected_)) chosen = &record;
+  }
+  // Outputs saved before the first record match the start of the input
+  if (!chosen && checkpoint_selected_ == 0) return false;
+  if (!chosen) {
+    throw std::runtime_error("Checkpoint " + checkpoint_path_ +
+                             " has no record matching the saved outputs");
+  }
+  std::istringstream in(*chosen);
+  in >> key >> number;
+  unsigned segment = 0;
+  unsigned events = 0;
+  in >> key >> segment >> key >> file >> key >> entry >> key >> file_offset >>
+      key >> events;
+  if (!in) {
+    throw std::runtime_error("Unable to read checkpoint " + checkpoint_path_);
+  }
+  for (auto & seq : seqs_) {
+    std::string name;
+    unsigned n_modules = 0;
+    in >> key >> name >> n_modules;
+    if (!in || name != seq.name || n_modules != seq.modules.size()) {
+      throw std::runtime_error("Checkpoint " + checkpoint_path_ +
+                               " does not match the module sequences");
+    }
+    for (unsigned i = 0; i < n_modules; ++i) {
+      in >> seq.proc_counters[i] >> seq.counters[i] >> seq.timers[i];
+    }
+  }
+  if (!in) {
+    throw std::runtime_error("Unable to read checkpoint " + checkpoint_path_);
+  }
+  events_processed_ = events;
+  checkpoint_last_ = *chosen;
+  return true;
+}
 }
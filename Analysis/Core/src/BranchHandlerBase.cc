@@ -2,7 +2,11 @@
 
 namespace ic {
 BranchHandlerBase::BranchHandlerBase()
-    : branch_ptr_(nullptr), current_(-1), no_overwrite_(false) {}
+    : branch_ptr_(nullptr),
+      current_(-1),
+      no_overwrite_(false),
+      snapshots_(false),
+      dirty_(false) {}
 
 BranchHandlerBase::~BranchHandlerBase() {}
 }
\ No newline at end of file
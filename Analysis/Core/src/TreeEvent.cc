@@ -4,7 +4,8 @@ class TTree;
 
 namespace ic {
 
-TreeEvent::TreeEvent() : Event(), tree_(nullptr), event_(0) {}
+TreeEvent::TreeEvent()
+    : Event(), tree_(nullptr), event_(0), snapshots_(false) {}
 
 TreeEvent::~TreeEvent() { DeleteAndClearHandlers(); }
 
@@ -14,14 +15,24 @@ void TreeEvent::SetEvent(int64_t event) {
   for (unsigned i = 0; i < auto_add_funcs_.size(); ++i) {
     auto_add_funcs_[i](event);
   }
+  // Products added automatically are handed out without any getter
+  // being called, so have to be assumed modified
+  for (auto bh : auto_add_handlers_) bh->SetDirty();
   for (auto bh : handlers_) bh.second->SetNoOverwrite(false);
 }
 
+void TreeEvent::SetSnapshots(bool const& value) {
+  snapshots_ = value;
+  for (auto bh : handlers_) bh.second->SetSnapshots(value);
+}
+
 void TreeEvent::SetTree(TTree* tree) {
   tree_ = tree;
   DeleteAndClearHandlers();
   cached_funcs_.clear();
   auto_add_funcs_.clear();
+  product_handlers_.clear();
+  auto_add_handlers_.clear();
   if (tree) {
     TObjArray const* branches = tree_->GetListOfBranches();
     for (int i = 0; i < branches->GetSize(); ++i) {
@@ -44,6 +44,7 @@ namespace ic {
     virtual ~DataNormShape();
     virtual int Init(TFile*);
     virtual int Run(LTFiles*);
+    virtual void DeclareShapes(LTFiles*);
   };
 
 }
@@ -23,6 +23,7 @@ namespace ic {
     virtual ~DataQCDEst();
     virtual int Init(TFile*);
     virtual int Run(LTFiles*);
+    virtual void DeclareShapes(LTFiles*);
   };
 
 }
@@ -33,6 +33,7 @@ namespace ic {
     virtual ~DataShape();
     virtual int Init(TFile*);
     virtual int Run(LTFiles*);
+    virtual void DeclareShapes(LTFiles*);
   };
 
 }
@@ -23,6 +23,7 @@ namespace ic {
     virtual ~DataWEst();
     virtual int Init(TFile*);
     virtual int Run(LTFiles*);
+    virtual void DeclareShapes(LTFiles*);
   };
 
 }
@@ -30,6 +30,7 @@ namespace ic {
     virtual ~DataZEst();
     virtual int Init(TFile*);
     virtual int Run(LTFiles*);
+    virtual void DeclareShapes(LTFiles*);
   };
 
 }
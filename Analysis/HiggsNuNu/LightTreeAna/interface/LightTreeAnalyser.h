@@ -11,10 +11,12 @@ namespace ic{
   CLASS_MEMBER(LTAnalyser,int,verbosity)
     CLASS_MEMBER(LTAnalyser,std::string,baseselection)
     CLASS_MEMBER(LTAnalyser,std::string,outputname)
+    CLASS_MEMBER(LTAnalyser,bool,plan_shapes)
   protected:
     std::vector<ic::LTModule *> modulelist_;
     LTFiles filemanager_;    
     bool print_module_list_;
+    std::shared_ptr<ShapeCache> shape_cache_;
   public:
     TFile* fs;
     LTAnalyser(std::string);
@@ -26,6 +28,10 @@ namespace ic{
     void SetInFolder(std::string);
     void SetEosFolders(std::string,std::string);
     void SetInputParams(std::string);
+    void SetNThreads(unsigned);
+    // Keep the shapes in a persistent cache in directory dir, dropping
+    // those of the files listed in invalidate first
+    void SetShapeCache(std::string dir, std::vector<std::string> invalidate);
 
     bool PostModule(int);
     int RunAnalysis();
@@ -2,8 +2,11 @@
 #define ICHiggsTauTau_HiggsNuNu_LightTreeFiles_h
 #include <vector>
 #include <map>
+#include <set>
 #include <utility>
+#include <memory>
 #include "HiggsNuNu/interface/HiggsNuNuAnalysisTools.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/ShapeCache.h"
 #include "TTree.h"
 #include "TFile.h"
 #include "TH1F.h"
@@ -26,14 +29,20 @@ namespace ic{
     LTFile(std::string,std::string);
     LTFile(std::string,std::string,std::string);
     int Open(std::string,std::string dataeospath="",std::string mceospath="");
+    std::string FullPath(std::string,std::string dataeospath="",std::string mceospath="");
     int Close();
     int AddFriend(TTree*);
     int AddFriend(std::string,std::string);
+    inline std::vector<std::pair<std::string,std::string> > const& friend_trees() const { return friendTrees; }
     TEntryList GetEntryList(std::string const&, std::string const&, std::string const&);
     TTree* GetSubTree(TEntryList);
     bool GetShape(TH1F & shape, std::string const&, std::string const&, std::string const&, std::string const&, const bool);
     bool GetShape2D(TH2F & shape, std::string const&, std::string const&, std::string const&, std::string const&, const bool);
     TH3F GetShape3D(std::string const&, std::string const&, std::string const&, std::string const&);
+    // Fills the (variable, cut string) requests in a single loop over the
+    // tree. Requests that TTree::Draw must handle itself (no explicit
+    // binning, 2D, arrays) are left with filled=false.
+    int FillShapes(std::vector<std::pair<std::string,std::string> > const&, std::vector<TH1F> & shapes, std::vector<bool> & filled);
     TTree* GetTree();
   };
 
@@ -42,9 +51,23 @@ namespace ic{
     CLASS_MEMBER(LTFiles,std::string,dataeosfolder)
     CLASS_MEMBER(LTFiles,std::string,mceosfolder)
     CLASS_MEMBER(LTFiles,std::string,input_params)
+    CLASS_MEMBER(LTFiles,unsigned,nthreads)
     protected:								
     std::map<std::string,LTFile> files_;					
     std::map<std::string,std::vector<std::pair<std::string,bool> > > setlists_;
+    // Shapes declared by the modules before they run: file name -> set of
+    // (variable, full cut string), and the histograms filled for them
+    std::map<std::string,std::set<std::pair<std::string,std::string> > > shape_requests_;
+    std::map<std::string,TH1F> shape_cache_;
+    // Optional persistent cache consulted before anything is drawn, keyed
+    // by file name (for invalidation) and the stamps of the input file and
+    // of any friend tree files
+    std::shared_ptr<ShapeCache> disk_cache_;
+    std::map<std::string,std::string> file_stamps_;
+    std::string DiskCacheKey(std::string const& filename, std::string const& variable, std::string const& cut);
+    void StoreShape(std::string const& filename, std::string const& variable, std::string const& cut, TH1F const& shape);
+    TH1F const* FindCachedShape(std::string const& filename, std::string const& variable, std::string const& cut);
+    bool GetCachedShape(TH1F & shape, std::string const& filename, std::string const& variable, std::string const& cut, const bool toadd, bool & success);
     public:
     LTFiles();
     LTFiles(std::string,std::string);
@@ -90,6 +113,18 @@ namespace ic{
     TH2F GetSetsShape2D(std::vector<std::string>,std::string const&, std::string const&, std::string const&, std::string const&,const bool);
     TH3F GetShape3D(std::string,std::string const&, std::string const&, std::string const&, std::string const&);
     TH3F GetSetShape3D(std::string,std::string const&, std::string const&, std::string const&, std::string const&,bool);
+
+    // Declare shapes that will be needed later with the same arguments
+    // as the corresponding Get*Shape calls. FillRequestedShapes then fills
+    // all distinct requests with one pass over each file and the Get*Shape
+    // calls are served from the result. Files are processed concurrently
+    // on nthreads threads, each with its own TFile/TTree.
+    void RequestShape(std::string,std::string const&, std::string const&, std::string const&, std::string const&);
+    void RequestSetShape(std::string,std::string const&, std::string const&, std::string const&, std::string const&,const bool);
+    void RequestSetsShape(std::vector<std::string>,std::string const&, std::string const&, std::string const&, std::string const&,const bool);
+    int FillRequestedShapes();
+    void ClearShapeCache();
+    void SetDiskCache(std::shared_ptr<ShapeCache> const& cache);
   };
 
 }
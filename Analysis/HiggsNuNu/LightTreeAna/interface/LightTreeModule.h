@@ -14,6 +14,9 @@ namespace ic{
     std::string module_name();
     virtual int Init(TFile*) =0;
     virtual int Run(LTFiles*)=0;
+    // Optionally declare, via LTFiles::Request*Shape, the shapes that Run
+    // will ask for so they can be filled together before any module runs
+    virtual void DeclareShapes(LTFiles*) {}
   };
 
 }
@@ -47,6 +47,24 @@ namespace ic{
     return 0;
   };
 
+  void DataNormShape::DeclareShapes(LTFiles* filemanager){
+    //Backgrounds weighted by data driven factors depend on the output of
+    //earlier modules and are still made when Run asks for them
+    filemanager->RequestSetShape(contmcset_,"jet2_pt(200,0.,1000.)",basesel_,(contcat_+contmcextrasel_),contmcweight_,false);
+    if(contbkgextrafactordir_.size()==0){
+      filemanager->RequestSetsShape(contbkgset_,"jet2_pt(200,0.,1000.)",basesel_,(contcat_+contbkgextrasel_),contmcweight_,false);
+    }
+    filemanager->RequestSetShape(contdataset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_+contdataextrasel_,contdataweight_,false);
+    for(unsigned iShape=0;iShape<shape_.size();iShape++){
+      filemanager->RequestSetShape(sigmcset_,shape_[iShape],basesel_,sigcat_,sigmcweight_,false);
+      if(do_subsets_){
+	for(unsigned isubset=0;isubset<subsets_.size();isubset++){
+	  filemanager->RequestSetShape(subsets_[isubset],shape_[iShape],basesel_,sigcat_,sigmcweight_,false);
+	}
+      }
+    }
+  };
+
   int DataNormShape::Run(LTFiles* filemanager){
     std::cout<<module_name_<<":"<<std::endl;
     //sort out puweighting
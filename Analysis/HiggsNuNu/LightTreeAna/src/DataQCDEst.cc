@@ -24,6 +24,15 @@ namespace ic{
     return 0;
   };
 
+  void DataQCDEst::DeclareShapes(LTFiles* filemanager){
+    filemanager->RequestSetShape(Aset_,"jet2_pt(200,0.,1000.)",basesel_,Acat_,"weight_nolep",false);
+    filemanager->RequestSetShape(Bset_,"jet2_pt(200,0.,1000.)",basesel_,Bcat_,"weight_nolep",false);
+    filemanager->RequestSetShape(Cset_,"jet2_pt(200,0.,1000.)",basesel_,Ccat_,"weight_nolep",false);
+    filemanager->RequestSetsShape(Abkgset_,"jet2_pt(200,0.,1000.)",basesel_,Acat_,"total_weight_lepveto",false);
+    filemanager->RequestSetsShape(Bbkgset_,"jet2_pt(200,0.,1000.)",basesel_,Bcat_,"total_weight_lepveto",false);
+    filemanager->RequestSetsShape(Cbkgset_,"jet2_pt(200,0.,1000.)",basesel_,Ccat_,"total_weight_lepveto",false);
+  };
+
   int DataQCDEst::Run(LTFiles* filemanager){
     std::cout<<module_name_<<":"<<std::endl;
 
@@ -39,6 +39,13 @@ namespace ic{
     return 0;
   };
 
+  void DataShape::DeclareShapes(LTFiles* filemanager){
+    for(unsigned iShape=0;iShape<shape_.size();iShape++){
+      if(shape_[iShape].find(":")!=shape_[iShape].npos) continue;
+      filemanager->RequestSetsShape(dataset_,shape_[iShape],basesel_,cat_,dataweight_,false);
+    }
+  };
+
   int DataShape::Run(LTFiles* filemanager){
     std::cout<<"DataShape " << module_name_<<":"<<std::endl;
 
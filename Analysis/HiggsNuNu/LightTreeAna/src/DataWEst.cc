@@ -29,6 +29,13 @@ namespace ic{
     return 0;
   };
 
+  void DataWEst::DeclareShapes(LTFiles* filemanager){
+    filemanager->RequestSetShape(sigmcset_,"jet2_pt(200,0.,1000.)",basesel_,sigcat_,sigmcweight_,false);
+    filemanager->RequestSetShape(contmcset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,contmcweight_,false);
+    filemanager->RequestSetsShape(contbkgset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,contmcweight_,false);
+    filemanager->RequestSetShape(contdataset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,contdataweight_,false);
+  };
+
   int DataWEst::Run(LTFiles* filemanager){
     std::cout<<module_name_<<":"<<std::endl;
 
@@ -34,6 +34,15 @@ namespace ic{
     return 0;
   };
 
+  void DataZEst::DeclareShapes(LTFiles* filemanager){
+    filemanager->RequestSetShape(sigmcewkset_,"jet2_pt(200,0.,1000.)",basesel_,sigcat_,"weight_nolep",false);
+    filemanager->RequestSetShape(sigmcqcdset_,"jet2_pt(200,0.,1000.)",basesel_,sigcat_,"weight_nolep",false);
+    filemanager->RequestSetShape(contmcewkset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,"total_weight_leptight",false);
+    filemanager->RequestSetShape(contmcqcdset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,"total_weight_leptight",false);
+    filemanager->RequestSetsShape(contbkgset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,"total_weight_leptight",false);
+    filemanager->RequestSetShape(contdataset_,"jet2_pt(200,0.,1000.)",basesel_,contcat_,"weight_nolep",false);
+  };
+
   int DataZEst::Run(LTFiles* filemanager){
     std::cout<<module_name_<<":"<<std::endl;
 
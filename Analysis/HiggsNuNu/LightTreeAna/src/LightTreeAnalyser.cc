@@ -10,12 +10,14 @@ namespace ic{
   LTAnalyser::LTAnalyser(std::string outputname){
     verbosity_=1;
     outputname_=outputname;
+    plan_shapes_=true;
     fs=new TFile((outputname_).c_str(),"RECREATE");
   };
   
   LTAnalyser::LTAnalyser(std::string outputname, int verbosity){
     verbosity_=verbosity;
     outputname_=outputname;
+    plan_shapes_=true;
     fs=new TFile((outputname_).c_str(),"RECREATE");
   };
   
@@ -64,6 +66,21 @@ namespace ic{
     filemanager_.set_input_params(inputparams);
   };
 
+  void LTAnalyser::SetNThreads(unsigned nthreads){
+    filemanager_.set_nthreads(nthreads);
+  };
+
+  void LTAnalyser::SetShapeCache(std::string dir, std::vector<std::string> invalidate){
+    if(dir==""){
+      shape_cache_.reset();
+    }
+    else {
+      shape_cache_ = std::make_shared<ShapeCache>(dir);
+      for(unsigned i=0;i<invalidate.size();++i) shape_cache_->Invalidate(invalidate[i]);
+    }
+    filemanager_.SetDiskCache(shape_cache_);
+  };
+
   bool LTAnalyser::PostModule(int status) {
     if (status > 0) {
 
@@ -91,6 +108,16 @@ namespace ic{
       modulelist_[module]->Init(fs);
     }
 
+    if (plan_shapes_) {
+      std::cout << "-------------------------------------" << std::endl;
+      std::cout << "Filling Declared Shapes" << std::endl;
+      std::cout << "-------------------------------------" << std::endl;
+      for (unsigned module = 0; module < modulelist_.size(); ++module) {
+	modulelist_[module]->DeclareShapes(&filemanager_);
+      }
+      filemanager_.FillRequestedShapes();
+    }
+
     std::cout << "-------------------------------------" << std::endl;
     std::cout << "Beginning Main Analysis Sequence" << std::endl;
     std::cout << "-------------------------------------" << std::endl;
@@ -101,6 +128,10 @@ namespace ic{
       }
     }
     std::cout<<"All modules ran and exited with status 0."<<std::endl;
+    if (shape_cache_) {
+      std::cout<<"Shape cache "<<shape_cache_->dir()<<": "<<shape_cache_->hits()<<" hits, "<<shape_cache_->misses()<<" misses"<<std::endl;
+      shape_cache_->Flush();
+    }
     fs->Close();
     return 0;
   };
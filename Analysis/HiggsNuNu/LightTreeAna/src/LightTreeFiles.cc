@@ -1,11 +1,52 @@
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsNuNu/LightTreeAna/interface/LightTreeFiles.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsNuNu/interface/HiggsNuNuAnalysisTools.h"
 #include "boost/lexical_cast.hpp"
+#include "boost/algorithm/string.hpp"
+#include "TTreeFormula.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnParallel.h"
 #include <iostream>
+#include <mutex>
 #include <vector>
 #include <cstring>
 
 namespace ic{
+
+  namespace {
+    //Serialises opening/closing files and compiling formulas when several
+    //files are processed at once; the event loops themselves run unlocked
+    std::mutex root_setup_mutex;
+
+    std::string ShapeCacheKey(std::string const& filename, std::string const& variable, std::string const& cut){
+      return filename+"\n"+variable+"\n"+cut;
+    }
+
+    // Split a 1D "expression(nbins,xmin,xmax)" variable in the same way
+    // BuildVarString does for TTree::Draw. Returns false for anything that
+    // Draw would treat differently (no binning, arrays, 2D).
+    bool ParseVarBinning(std::string const& variable, std::string & expr, int & nbins, double & xmin, double & xmax){
+      if (variable.find("[")!=variable.npos || variable.find("]")!=variable.npos) return false;
+      std::size_t pos = variable.find_last_of("(");
+      if (pos==variable.npos || pos==0 || variable[variable.size()-1]!=')') return false;
+      expr = variable.substr(0,pos);
+      for (unsigned i=0;i<expr.size();++i){
+	if (expr[i]!=':') continue;
+	bool scope = (i>0 && expr[i-1]==':') || (i+1<expr.size() && expr[i+1]==':');
+	if (!scope) return false;
+      }
+      std::vector<std::string> strs;
+      std::string binning = variable.substr(pos+1,variable.size()-pos-2);
+      boost::split(strs, binning, boost::is_any_of(","));
+      if (strs.size()!=3) return false;
+      try {
+	nbins = boost::lexical_cast<int>(boost::trim_copy(strs[0]));
+	xmin = boost::lexical_cast<double>(boost::trim_copy(strs[1]));
+	xmax = boost::lexical_cast<double>(boost::trim_copy(strs[2]));
+      } catch (boost::bad_lexical_cast const&) {
+	return false;
+      }
+      return nbins>0 && xmax>xmin;
+    }
+  }
   LTFile::LTFile(){
   };
 
@@ -21,8 +62,7 @@ namespace ic{
     path_=path;
   };
 
-  int LTFile::Open(std::string infolder,std::string dataeosfolder,std::string mceosfolder){
-    //std::cout<<"Opening TFile..."<<std::endl;
+  std::string LTFile::FullPath(std::string infolder,std::string dataeosfolder,std::string mceosfolder){
     std::string filepath = (this->path());
     bool isMC=false;
     if (filepath.find("MC_")!=filepath.npos){
@@ -33,7 +73,12 @@ namespace ic{
       //std::cout << " File " << dataeosfolder << infolder << filepath << " is data." << std::endl;
       isMC=false;
     }
-    TFile * tmp = isMC?TFile::Open((mceosfolder+infolder+"/"+this->path()).c_str()) : TFile::Open((dataeosfolder+infolder+"/"+this->path()).c_str());
+    return isMC ? mceosfolder+infolder+"/"+filepath : dataeosfolder+infolder+"/"+filepath;
+  }
+
+  int LTFile::Open(std::string infolder,std::string dataeosfolder,std::string mceosfolder){
+    //std::cout<<"Opening TFile..."<<std::endl;
+    TFile * tmp = TFile::Open(FullPath(infolder,dataeosfolder,mceosfolder).c_str());
     if (!tmp) {
       std::cerr << "Warning, file " << this->name() << " could not be opened." << std::endl;
       return 1;
@@ -134,6 +179,84 @@ namespace ic{
     return temp;
   };
 
+  int LTFile::FillShapes(std::vector<std::pair<std::string,std::string> > const& requests, std::vector<TH1F> & shapes, std::vector<bool> & filled){
+    shapes.assign(requests.size(),TH1F());
+    filled.assign(requests.size(),false);
+    if(!tree_ || tree_->GetEntries()<1){
+      std::cout<<"WARNING: "<<name_<<" is empty."<<std::endl;
+      return 0;
+    }
+
+    //Compile each distinct expression only once
+    std::unique_lock<std::mutex> setup_lock(root_setup_mutex);
+    std::vector<TTreeFormula*> formulas;
+    std::map<std::string,int> formula_index;
+    auto get_formula = [&](std::string const& expr) -> int {
+      if (expr=="") return -1;
+      auto it = formula_index.find(expr);
+      if (it!=formula_index.end()) return it->second;
+      TTreeFormula *formula = new TTreeFormula(("ltformula"+boost::lexical_cast<std::string>(formulas.size())).c_str(),expr.c_str(),tree_);
+      if (formula->GetNdim()==0 || formula->GetMultiplicity()!=0) {
+	delete formula;
+	formula_index[expr]=-2;
+	return -2;
+      }
+      formulas.push_back(formula);
+      formula_index[expr]=formulas.size()-1;
+      return formulas.size()-1;
+    };
+
+    struct Job { int var; int cut; unsigned index; };
+    std::vector<Job> jobs;
+    for(unsigned i=0;i<requests.size();++i){
+      std::string expr;
+      int nbins=0;
+      double xmin=0., xmax=0.;
+      if (!ParseVarBinning(requests[i].first,expr,nbins,xmin,xmax)) continue;
+      int var = get_formula(expr);
+      int cut = get_formula(requests[i].second);
+      if (var<0 || cut==-2) continue;
+      shapes[i].SetBins(nbins,xmin,xmax);
+      shapes[i].SetName("htemp");
+      shapes[i].SetTitle(expr.c_str());
+      shapes[i].Sumw2();
+      jobs.push_back({var,cut,i});
+    }
+
+    setup_lock.unlock();
+
+    //Single pass over the tree, each formula is evaluated at most once per entry
+    std::vector<double> values(formulas.size(),0.);
+    std::vector<bool> evaluated(formulas.size(),false);
+    int tree_number=-1;
+    Long64_t nentries=tree_->GetEntries();
+    for(Long64_t ientry=0;ientry<nentries;++ientry){
+      if (tree_->LoadTree(ientry)<0) break;
+      if (tree_->GetTreeNumber()!=tree_number){
+	tree_number=tree_->GetTreeNumber();
+	for(unsigned f=0;f<formulas.size();++f) formulas[f]->UpdateFormulaLeaves();
+      }
+      std::fill(evaluated.begin(),evaluated.end(),false);
+      auto eval = [&](int f) -> double {
+	if (!evaluated[f]) {
+	  formulas[f]->GetNdata();
+	  values[f]=formulas[f]->EvalInstance(0);
+	  evaluated[f]=true;
+	}
+	return values[f];
+      };
+      for(unsigned j=0;j<jobs.size();++j){
+	double w = (jobs[j].cut<0) ? 1. : eval(jobs[j].cut);
+	if (w==0.) continue;
+	shapes[jobs[j].index].Fill(eval(jobs[j].var),w*tree_->GetWeight());
+      }
+    }
+    for(unsigned j=0;j<jobs.size();++j) filled[jobs[j].index]=true;
+    setup_lock.lock();
+    for(unsigned f=0;f<formulas.size();++f) delete formulas[f];
+    return jobs.size();
+  }
+
   TTree* LTFile::GetTree(){
     return tree_;
   }
@@ -142,18 +265,22 @@ namespace ic{
 
 
   LTFiles::LTFiles(){
+    nthreads_=1;
   };
 
   LTFiles::LTFiles(std::string name, std::string set, std::string path){
+    nthreads_=1;
     files_[name]=LTFile(name,set,path);
     setlists_[set].push_back(std::pair<std::string,bool>(name,true));
   };
 
   LTFiles::LTFiles(std::string name, std::string path){
+    nthreads_=1;
     files_[name]=LTFile(name,path);
   };
   
   LTFiles::LTFiles(std::vector<std::string> names,std::vector<std::string> sets, std::vector<std::string> paths){
+    nthreads_=1;
     if(names.size()!=sets.size() || sets.size()!=paths.size()) std::cout<<"Error different numbers of names, sets and paths making empty Files object"<<std::endl;
     else{
       for(unsigned iname=0;iname<names.size();iname++){
@@ -164,6 +291,7 @@ namespace ic{
   };
 
   LTFiles::LTFiles(LTFile file){
+    nthreads_=1;
     files_[file.name()]=file;
     if(file.set()!=""){
       setlists_[file.set()].push_back(std::pair<std::string,bool>(file.name(),true));
@@ -171,6 +299,7 @@ namespace ic{
   };
   
   LTFiles::LTFiles(std::vector<LTFile> files){
+    nthreads_=1;
     for(unsigned ifile=0;ifile<files.size();ifile++){
       files_[files[ifile].name()]=files[ifile];
       if(files[ifile].set()!=""){
@@ -360,10 +489,13 @@ namespace ic{
 
   int LTFiles::AddFriend(std::string filename, std::string treename, std::string treefilename){
     files_[filename].AddFriend(treename,treefilename);
+    file_stamps_.erase(filename);
     return 0;
   };
 
   bool LTFiles::GetShape(TH1F & temp, std::string filename, std::string const& variable, std::string const& selection, std::string const& category, std::string const& weight, const bool toadd){
+    bool cached_ok=false;
+    if(GetCachedShape(temp,filename,variable,BuildCutString(selection,category,weight),toadd,cached_ok)) return cached_ok;
     if(OpenFile(filename)==1){
       std::cout<<"Problem opening file "<<filename 
 	//<< " returning empty TH1F"
@@ -373,6 +505,7 @@ namespace ic{
     }
     bool success = files_[filename].GetShape(temp,variable,selection,category,weight,toadd);
     CloseFile(filename);
+    if(success && !toadd) StoreShape(filename,variable,BuildCutString(selection,category,weight),temp);
     return success;
   };
 
@@ -394,7 +527,25 @@ namespace ic{
     //TH1F setshape;
     bool oneok = false;
     if(setlists_.count(setname)>0){
-      if(OpenSet(setname)==1){
+      //Only open the set if some of its shapes were not filled in advance
+      std::vector<double> lumixsweights;
+      bool allcached=true;
+      for(auto iter=setlists_[setname].begin(); iter!=setlists_[setname].end();++iter){
+	if (!(*iter).second) {
+	  lumixsweights.push_back(1);
+	  continue;
+	}
+	//ADAPT LUMIXS BIT
+	//std::string sample_path_=files_[*iter].path();
+	double lumixsweight=1;
+	if(do_lumixs_weights_){
+	  lumixsweight=this->GetLumiXSWeight(files_[(*iter).first]);
+	}
+	lumixsweights.push_back(lumixsweight);
+	std::string cut=BuildCutString(selection,category,weight+"*"+boost::lexical_cast<std::string>(lumixsweight));
+	if(!FindCachedShape((*iter).first,variable,cut)) allcached=false;
+      }
+      if(!allcached && OpenSet(setname)==1){
 	std::cout<<"Problem opening set "<<setname
 	  //<<" returning empty TH1F"
 		 <<std::endl;
@@ -402,17 +553,19 @@ namespace ic{
 	return false;
       }
       bool first=toadd?false:true;
-      for(auto iter=setlists_[setname].begin(); iter!=setlists_[setname].end();++iter){
+      unsigned ifile=0;
+      for(auto iter=setlists_[setname].begin(); iter!=setlists_[setname].end();++iter,++ifile){
 	if (!(*iter).second) continue;
-	//ADAPT LUMIXS BIT
-	//std::string sample_path_=files_[*iter].path();
-	double lumixsweight=1;
-	if(do_lumixs_weights_){
-	  lumixsweight=this->GetLumiXSWeight(files_[(*iter).first]);
-	}
+	double lumixsweight=lumixsweights[ifile];
 	std::cout << "Set: " << setname << ", sample " << (*iter).first << ": " ;
-	bool success = files_[(*iter).first].GetShape(setshape,variable,selection,category,weight+"*"+boost::lexical_cast<std::string>(lumixsweight),!first);
-	CloseFile((*iter).first);
+	bool success=false;
+	std::string cut=BuildCutString(selection,category,weight+"*"+boost::lexical_cast<std::string>(lumixsweight));
+	if(!GetCachedShape(setshape,(*iter).first,variable,cut,!first,success)){
+	  success = files_[(*iter).first].GetShape(setshape,variable,selection,category,weight+"*"+boost::lexical_cast<std::string>(lumixsweight),!first);
+	  CloseFile((*iter).first);
+	  if(success && first) StoreShape((*iter).first,variable,cut,setshape);
+	}
+	else if(!allcached) CloseFile((*iter).first);
 	if (!success){
 	  std::cout << " --- Error, Skipping" << std::endl;
 	  continue;
@@ -587,6 +740,143 @@ namespace ic{
     return setshape;
   };
 
+  std::string LTFiles::DiskCacheKey(std::string const& filename, std::string const& variable, std::string const& cut){
+    if (!disk_cache_ || files_.count(filename)==0) return "";
+    auto it = file_stamps_.find(filename);
+    if (it==file_stamps_.end()) {
+      LTFile & file = files_[filename];
+      std::string stamp = ShapeCache::FileStamp(file.FullPath(infolder_,dataeosfolder_,mceosfolder_));
+      //Friend trees can be drawn from too, so their files are part of the
+      //stamp. If any of them cannot be stamped the file is not cached.
+      for (auto const& friendtree : file.friend_trees()) {
+	if (stamp=="") break;
+	std::string friendstamp = ShapeCache::FileStamp(friendtree.second);
+	stamp = (friendstamp=="") ? "" : stamp+"\n"+friendtree.first+"@"+friendstamp;
+      }
+      it = file_stamps_.insert(std::make_pair(filename,stamp)).first;
+    }
+    if (it->second=="") return "";
+    return ShapeCache::MakeKey(it->second,variable,cut);
+  }
+
+  void LTFiles::StoreShape(std::string const& filename, std::string const& variable, std::string const& cut, TH1F const& shape){
+    std::string key = DiskCacheKey(filename,variable,cut);
+    if (key!="") disk_cache_->Put(filename,key,shape);
+  }
+
+  TH1F const* LTFiles::FindCachedShape(std::string const& filename, std::string const& variable, std::string const& cut){
+    std::string memkey = ShapeCacheKey(filename,variable,cut);
+    auto it = shape_cache_.find(memkey);
+    if (it!=shape_cache_.end()) return &(it->second);
+    std::string key = DiskCacheKey(filename,variable,cut);
+    TH1F shape;
+    if (key=="" || !disk_cache_->Get(filename,key,shape)) return nullptr;
+    TH1F & cached = shape_cache_[memkey];
+    cached = shape;
+    return &cached;
+  }
+
+  bool LTFiles::GetCachedShape(TH1F & shape, std::string const& filename, std::string const& variable, std::string const& cut, const bool toadd, bool & success){
+    TH1F const* cached = FindCachedShape(filename,variable,cut);
+    if (!cached) return false;
+    success=true;
+    //Same treatment as ic::GetShape gives the output of TTree::Draw
+    if (!toadd) {
+      shape=*cached;
+      shape.SetName("myshape");
+      shape.Sumw2();
+    }
+    else if (!shape.Add(cached)) {
+      std::cout << " Failed adding shape." << std::endl;
+      success=false;
+      return true;
+    }
+    std::cout << variable << " nEvtsIntegrated = " << shape.GetEntries() << " " << shape.Integral() << std::endl;
+    return true;
+  }
+
+  void LTFiles::RequestShape(std::string filename, std::string const& variable, std::string const& selection, std::string const& category, std::string const& weight){
+    if(files_.count(filename)==0) return;
+    shape_requests_[filename].insert(std::make_pair(variable,BuildCutString(selection,category,weight)));
+  }
+
+  void LTFiles::RequestSetShape(std::string setname, std::string const& variable, std::string const& selection, std::string const& category, std::string const& weight, const bool do_lumixs_weights_){
+    if(setlists_.count(setname)==0) return;
+    for(auto iter=setlists_[setname].begin(); iter!=setlists_[setname].end();++iter){
+      if (!(*iter).second) continue;
+      double lumixsweight=1;
+      if(do_lumixs_weights_){
+	lumixsweight=this->GetLumiXSWeight(files_[(*iter).first]);
+      }
+      RequestShape((*iter).first,variable,selection,category,weight+"*"+boost::lexical_cast<std::string>(lumixsweight));
+    }
+  }
+
+  void LTFiles::RequestSetsShape(std::vector<std::string> setnames, std::string const& variable, std::string const& selection, std::string const& category, std::string const& weight, const bool do_lumixs_weights_){
+    for(unsigned iset=0;iset<setnames.size();iset++){
+      RequestSetShape(setnames[iset],variable,selection,category,weight,do_lumixs_weights_);
+    }
+  }
+
+  int LTFiles::FillRequestedShapes(){
+    //Work out what is still needed from each file
+    std::vector<std::string> filenames;
+    std::vector<LTFile*> files;
+    std::vector<std::vector<std::pair<std::string,std::string> > > todo;
+    unsigned nrequests=0;
+    for(auto req=shape_requests_.begin();req!=shape_requests_.end();++req){
+      std::vector<std::pair<std::string,std::string> > filetodo;
+      for(auto it=req->second.begin();it!=req->second.end();++it){
+	if(!FindCachedShape(req->first,it->first,it->second)) filetodo.push_back(*it);
+      }
+      if(filetodo.size()==0) continue;
+      nrequests+=filetodo.size();
+      filenames.push_back(req->first);
+      files.push_back(&(files_[req->first]));
+      todo.push_back(filetodo);
+    }
+
+    //Each file is handled by a single task with its own TFile and TTree
+    std::vector<std::vector<TH1F> > shapes(files.size());
+    std::vector<std::vector<bool> > filled(files.size());
+    ParallelFor(files.size(),nthreads_,[&](unsigned ifile){
+      {
+	std::lock_guard<std::mutex> lock(root_setup_mutex);
+	if(files[ifile]->Open(infolder_,dataeosfolder_,mceosfolder_)==1){
+	  std::cout<<"Warning, could not open "<<filenames[ifile]<<", its shapes will be made on demand"<<std::endl;
+	  return;
+	}
+      }
+      files[ifile]->FillShapes(todo[ifile],shapes[ifile],filled[ifile]);
+      std::lock_guard<std::mutex> lock(root_setup_mutex);
+      files[ifile]->Close();
+    });
+
+    //Merge in file order so the result does not depend on the thread count
+    unsigned nfilled=0;
+    for(unsigned ifile=0;ifile<files.size();++ifile){
+      for(unsigned i=0;i<filled[ifile].size();++i){
+	if(!filled[ifile][i]) continue;
+	shape_cache_[ShapeCacheKey(filenames[ifile],todo[ifile][i].first,todo[ifile][i].second)]=shapes[ifile][i];
+	StoreShape(filenames[ifile],todo[ifile][i].first,todo[ifile][i].second,shapes[ifile][i]);
+	++nfilled;
+      }
+    }
+    std::cout<<"Filled "<<nfilled<<" of "<<nrequests<<" distinct shape requests with one pass over each of "<<files.size()<<" files using "<<std::max(nthreads_,1u)<<" thread(s)"<<std::endl;
+    shape_requests_.clear();
+    return 0;
+  }
+
+  void LTFiles::ClearShapeCache(){
+    shape_requests_.clear();
+    shape_cache_.clear();
+  }
+
+  void LTFiles::SetDiskCache(std::shared_ptr<ShapeCache> const& cache){
+    disk_cache_=cache;
+    file_stamps_.clear();
+  }
+
   double LTFiles::GetLumiXSWeight(LTFile file){
     std::string sample_path_=file.path();
     std::string suffix=".root";
@@ -4,8 +4,8 @@
 #include "TH1F.h"
 #include "TCanvas.h"
 #include <map>
-#include "TMVA/Reader.h"
-#include "TMVA/Tools.h"
+#include <algorithm>
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
 #include "TTreeFormula.h"
 
 namespace ic{
@@ -35,18 +35,24 @@ namespace ic{
   int MVAApply::Run(LTFiles* filemanager){
     std::cout<<module_name_<<":"<<std::endl;
     // MAKE TMVA READER                                                                                                              
-    TMVA::Reader *reader = new TMVA::Reader( "Color:!Silent" );
+    MVAReader *reader = new MVAReader( "Color:!Silent" );
 
     //ADD ALL THE VARIABLES
-    Double_t var[variables_.size()];
-    for(unsigned iVar=0;iVar<variables_.size();iVar++){
-      reader->AddVariable(variables_[iVar].c_str(),(Float_t*)&var[iVar]);
+    unsigned nvars=variables_.size();
+    std::vector<Float_t> var(nvars);
+    for(unsigned iVar=0;iVar<nvars;iVar++){
+      reader->AddVariable(variables_[iVar],&var[iVar]);
     }
 
     //BOOK METHODS
     for(unsigned iMethod=0;iMethod<methodNames_.size();iMethod++){
-      reader->BookMVA( methodNames_[iMethod].c_str(), (weightDir_+"/"+weightFiles_[iMethod]).c_str() );
+      reader->BookMVA( methodNames_[iMethod], weightDir_+"/"+weightFiles_[iMethod] );
     }
+
+    //EVENTS ARE READ IN BLOCKS AND EACH METHOD IS APPLIED TO A WHOLE BLOCK AT ONCE
+    const unsigned blocksize=1000;
+    std::vector<Float_t> inputs(blocksize*nvars);
+    std::vector<std::vector<double> > outputs(methodNames_.size(),std::vector<double>(blocksize));
     //SET LOOP
     for(unsigned iVec=0;iVec<sets_.size();iVec++){
       std::vector<LTFile> files;
@@ -79,23 +85,33 @@ namespace ic{
 	
 	//EVENT LOOP
 	static unsigned processed = 0;
-	for (Long64_t iEvt=0; iEvt<ttree_->GetEntries();iEvt++) {
-	  ttree_->GetEntry(iEvt);
-	  
-	  for(unsigned iVar=0;iVar<variables_.size();iVar++){
-	    formulas[iVar]->EvalInstance(iEvt);
-	    var[iVar]=boost::lexical_cast<double>(formulas[iVar]->PrintValue(0,0,".9f"));
+	Long64_t nentries=ttree_->GetEntries();
+	for (Long64_t first=0; first<nentries; first+=blocksize) {
+	  unsigned n=std::min<Long64_t>(blocksize,nentries-first);
+	  for(unsigned i=0;i<n;i++){
+	    ttree_->GetEntry(first+i);
+	    for(unsigned iVar=0;iVar<nvars;iVar++){
+	      formulas[iVar]->GetNdata();
+	      inputs[i*nvars+iVar]=formulas[iVar]->EvalInstance(0);
+	    }
 	  }
-	  
+
           //EVALUATE MVA
 	  for(unsigned iMethod=0;iMethod<methodNames_.size();iMethod++){
-	    mvavalues[iMethod]=reader->EvaluateMVA(methodNames_[iMethod]);
+	    reader->EvaluateBatch(methodNames_[iMethod],&inputs[0],n,nvars,&outputs[iMethod][0]);
 	  }
+
 	  //WRITE TO THE FRIEND TREE
-	  friendtree->Fill();
-	  ++processed;
-	  if (processed == 500) friendtree->OptimizeBaskets();
+	  for(unsigned i=0;i<n;i++){
+	    for(unsigned iMethod=0;iMethod<methodNames_.size();iMethod++){
+	      mvavalues[iMethod]=outputs[iMethod][i];
+	    }
+	    friendtree->Fill();
+	    ++processed;
+	    if (processed == 500) friendtree->OptimizeBaskets();
+	  }
 	}
+	for(unsigned iVar=0;iVar<formulas.size();iVar++) delete formulas[iVar];
 	//CLEAN UP
 	friendfile->cd();
 	friendtree->Write();
@@ -105,6 +121,7 @@ namespace ic{
 	files[iFile].Close();
       }
     }
+    delete reader;
     return 0;
   };
 
@@ -133,6 +133,9 @@ int main(int argc, char* argv[]){
   std::string shapePar;
 
   unsigned debug;
+  unsigned nthreads;
+  std::string shape_cache;
+  std::string shape_cache_invalidate;
 
   double lumiSF;
 
@@ -172,6 +175,9 @@ int main(int argc, char* argv[]){
     ("blindcutreg",              po::value<bool>(&blindcutreg)->default_value(true))
     ("runblindreg",              po::value<bool>(&runblindreg)->default_value(true))
     ("debug",                    po::value<unsigned>(&debug)->default_value(0))
+    ("nthreads",                 po::value<unsigned>(&nthreads)->default_value(1))
+    ("shape_cache",              po::value<std::string>(&shape_cache)->default_value(""))
+    ("shape_cache_invalidate",   po::value<std::string>(&shape_cache_invalidate)->default_value(""))
     ("do_mcbkg",                 po::value<bool>(&do_mcbkg)->default_value(true))
     ("use_nlo",                  po::value<bool>(&use_nlo)->default_value(false))
     ("jetmetdphicut",            po::value<std::string>(&jetmetdphicut)->default_value("alljetsmetnomu_mindphi>1.0"))
@@ -223,6 +229,10 @@ int main(int argc, char* argv[]){
     analysis->SetInFolder(inputfolder);
   }
   analysis->SetInputParams(inputparams);
+  analysis->SetNThreads(nthreads);
+  std::vector<std::string> invalidate;
+  if (shape_cache_invalidate!="") boost::split(invalidate, shape_cache_invalidate, boost::is_any_of(","));
+  analysis->SetShapeCache(shape_cache,invalidate);
 
   std::cout<<"Base selection: "<<basesel<<std::endl;
 
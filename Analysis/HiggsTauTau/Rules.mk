@@ -3,3 +3,10 @@ LIB_DEPS 	:= Core Utilities Modules Objects HiggsTauTau/LegacySVFit HiggsTauTau/
 LIB_EXTRA := -lCondFormatsJetMETObjects -lboost_serialization 
 DICTIONARY := interface/CrystalBallEfficiency.h
 DICTIONARY += interface/RooSpline1D.h
+
+# The svFitStandalone fits used from 2015 on need TauAnalysis/SVfitStandalone
+# checked out in the CMSSW area, build with SVFIT_STANDALONE=1 to include them
+ifeq ($(SVFIT_STANDALONE),1)
+CXXFLAGS += -DIC_SVFIT_STANDALONE
+LIB_EXTRA += -lTauAnalysisSVfitStandalone
+endif
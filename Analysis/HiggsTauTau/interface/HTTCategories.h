@@ -6,8 +6,14 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/HTTPlots.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/HistoSet.h"
+#include "UserCode/ICHiggsTauTau/interface/EventInfo.hh"
+#include "UserCode/ICHiggsTauTau/interface/CompositeCandidate.hh"
+#include "UserCode/ICHiggsTauTau/interface/Met.hh"
+#include "UserCode/ICHiggsTauTau/interface/PFJet.hh"
 
 #include <string>
+#include <vector>
+#include <utility>
 
 namespace ic {
 
@@ -48,12 +54,66 @@ class HTTCategories : public ModuleBase {
   CLASS_MEMBER(HTTCategories, bool, do_jes_vars)
   CLASS_MEMBER(HTTCategories, bool, do_z_weights)
   CLASS_MEMBER(HTTCategories, bool, do_faketaus)
+  CLASS_MEMBER(HTTCategories, bool, write_friend_inputs)
+  // Names of the variable groups to write to the ntuple, or "all"
+  CLASS_MEMBER(HTTCategories, std::vector<std::string>, variable_groups)
 
  
   TTree *outtree_;
   TTree *synctree_;
   TFile *lOFile;
 
+  // The branches are booked and filled by variable groups, each compiled
+  // in its own HTTCategories<Group>.cc. A group declares the groups it
+  // needs to have run before it, the event products it reads and records
+  // the branches it books. Only the groups requested in variable_groups
+  // (plus the sync group if make_sync_ntuple is set) and the groups they
+  // require are booked and executed.
+  struct VariableGroup {
+    std::string name;
+    std::vector<std::string> depends_on;
+    std::vector<std::string> reads;
+    void (HTTCategories::*book)();
+    void (HTTCategories::*fill)(TreeEvent *);
+    bool enabled;
+    std::vector<std::string> branches;
+  };
+  std::vector<VariableGroup> groups_;
+
+  // Objects shared between the groups for the current event. The jet
+  // collections are set by the jets group.
+  struct EventObjects {
+    EventInfo const* eventInfo;
+    CompositeCandidate const* ditau;
+    Candidate const* lep1;
+    Candidate const* lep2;
+    Met const* mets;
+    std::vector<PFJet*> jets;
+    std::vector<PFJet*> uncleaned_jets;
+    std::vector<PFJet*> lowpt_jets;
+    std::vector<PFJet*> prebjets;
+    std::vector<PFJet*> bjets;
+    std::vector<PFJet*> loose_bjets;
+    std::vector<PFJet*> jets_csv;
+    std::vector<PFJet*> bjets_csv;
+    std::vector<std::pair<PFJet*,PFJet*> > jet_csv_pairs;
+    std::string btag_label;
+  };
+  EventObjects objects_;
+
+  void RegisterGroups();
+  bool EnableGroup(std::string const& name);
+  void BookWeights();
+  void FillWeights(TreeEvent *event);
+  void BookKinematics();
+  void FillKinematics(TreeEvent *event);
+  void BookJets();
+  void FillJets(TreeEvent *event);
+  void BookMVAInputs();
+  void FillMVAInputs(TreeEvent *event);
+  void BookSync();
+  void FillSync(TreeEvent *event);
+
   struct branch_var {
       double var_double;  
       float var_float;
@@ -74,6 +134,7 @@ class HTTCategories : public ModuleBase {
   int run_;
   unsigned long long event_;
   int lumi_;
+  unsigned long long objects_hash_;
   float rho_;
   float mc_weight_;
   float pu_weight_;
@@ -988,119 +1049,16 @@ class HTTCategories : public ModuleBase {
   double wt_zpt_ttup;
   double wt_zpt_ttdown;
   
-  double scale1_;
-  double scale2_;
-  double scale3_;
-  double scale4_;
-  double scale5_;
-  double scale6_;
-  double scale7_;
-  double scale8_;
-  double scale9_;
-  
-  double wt_pdf_1_;
-  double wt_pdf_2_;
-  double wt_pdf_3_;
-  double wt_pdf_4_;
-  double wt_pdf_5_;
-  double wt_pdf_6_;
-  double wt_pdf_7_;
-  double wt_pdf_8_;
-  double wt_pdf_9_;
-  double wt_pdf_10_;
-  double wt_pdf_11_;
-  double wt_pdf_12_;
-  double wt_pdf_13_;
-  double wt_pdf_14_;
-  double wt_pdf_15_;
-  double wt_pdf_16_;
-  double wt_pdf_17_;
-  double wt_pdf_18_;
-  double wt_pdf_19_;
-  double wt_pdf_20_;
-  double wt_pdf_21_;
-  double wt_pdf_22_;
-  double wt_pdf_23_;
-  double wt_pdf_24_;
-  double wt_pdf_25_;
-  double wt_pdf_26_;
-  double wt_pdf_27_;
-  double wt_pdf_28_;
-  double wt_pdf_29_;
-  double wt_pdf_30_;
-  double wt_pdf_31_;
-  double wt_pdf_32_;
-  double wt_pdf_33_;
-  double wt_pdf_34_;
-  double wt_pdf_35_;
-  double wt_pdf_36_;
-  double wt_pdf_37_;
-  double wt_pdf_38_;
-  double wt_pdf_39_;
-  double wt_pdf_40_;
-  double wt_pdf_41_;
-  double wt_pdf_42_;
-  double wt_pdf_43_;
-  double wt_pdf_44_;
-  double wt_pdf_45_;
-  double wt_pdf_46_;
-  double wt_pdf_47_;
-  double wt_pdf_48_;
-  double wt_pdf_49_;
-  double wt_pdf_50_;
-  double wt_pdf_51_;
-  double wt_pdf_52_;
-  double wt_pdf_53_;
-  double wt_pdf_54_;
-  double wt_pdf_55_;
-  double wt_pdf_56_;
-  double wt_pdf_57_;
-  double wt_pdf_58_;
-  double wt_pdf_59_;
-  double wt_pdf_60_;
-  double wt_pdf_61_;
-  double wt_pdf_62_;
-  double wt_pdf_63_;
-  double wt_pdf_64_;
-  double wt_pdf_65_;
-  double wt_pdf_66_;
-  double wt_pdf_67_;
-  double wt_pdf_68_;
-  double wt_pdf_69_;
-  double wt_pdf_70_;
-  double wt_pdf_71_;
-  double wt_pdf_72_;
-  double wt_pdf_73_;
-  double wt_pdf_74_;
-  double wt_pdf_75_;
-  double wt_pdf_76_;
-  double wt_pdf_77_;
-  double wt_pdf_78_;
-  double wt_pdf_79_;
-  double wt_pdf_80_;
-  double wt_pdf_81_;
-  double wt_pdf_82_;
-  double wt_pdf_83_;
-  double wt_pdf_84_;
-  double wt_pdf_85_;
-  double wt_pdf_86_;
-  double wt_pdf_87_;
-  double wt_pdf_88_;
-  double wt_pdf_89_;
-  double wt_pdf_90_;
-  double wt_pdf_91_;
-  double wt_pdf_92_;
-  double wt_pdf_93_;
-  double wt_pdf_94_;
-  double wt_pdf_95_;
-  double wt_pdf_96_;
-  double wt_pdf_97_;
-  double wt_pdf_98_;
-  double wt_pdf_99_;
-  double wt_pdf_100_;
-  
-  double wt_alphasdown_;
-  double wt_alphasup_;
+  double scale_[9];
+  double wt_pdf_[100];
+  double wt_alphas_[2];
+
+  // EventInfo weight handles for the labels "1001"-"1009" and "1"-"9"
+  // (QCD scale), "2001"-"2100" (PDF) and "2101"-"2102" (alpha_s)
+  std::vector<unsigned> scale_handles_;
+  std::vector<unsigned> scale_wjets_handles_;
+  std::vector<unsigned> pdf_handles_;
+  std::vector<unsigned> alphas_handles_;
   
   double wt_ggh_t_;
   double wt_ggh_b_;
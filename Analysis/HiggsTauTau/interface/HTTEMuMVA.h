@@ -5,13 +5,10 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
 
-namespace TMVA {
-	class Reader;
-}
-
 namespace ic {
 
 class TreeEvent;
+class MVAReader;
 
 class HTTEMuMVA : public ModuleBase {
  private:
@@ -21,8 +18,8 @@ class HTTEMuMVA : public ModuleBase {
  	CLASS_MEMBER(HTTEMuMVA, std::string, gf_mva_file)
   // CLASS_MEMBER(HTTEMuMVA, std::string, vbf_mva_file)
 
- 	TMVA::Reader *gf_reader_;
-  // TMVA::Reader *vbf_reader_;
+ 	MVAReader *gf_reader_;
+  // MVAReader *vbf_reader_;
 
  	float pzetavis_;
  	float pzetamiss_;
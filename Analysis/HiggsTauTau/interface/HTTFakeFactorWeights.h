@@ -35,6 +35,9 @@ class HTTFakeFactorWeights : public ModuleBase {
   
   std::map<std::string, std::shared_ptr<FakeFactor>> fake_factors_;
   std::vector<std::string> category_names_;
+  // Nominal and systematic fake factors of the current event, see FakeFactor::values
+  std::vector<double> ff_values_1_;
+  std::vector<double> ff_values_2_;
 
   std::shared_ptr<RooWorkspace> w_;
   std::map<std::string, std::shared_ptr<RooFunctor>> fns_;
@@ -7,6 +7,7 @@
 #include "Core/interface/ModuleBase.h"
 #include "UserCode/ICHiggsTauTau/interface/GenParticle.hh"
 #include "UserCode/ICHiggsTauTau/interface/GenJet.hh"
+#include "Utilities/interface/GenGraph.h"
 
 namespace ic {
 
@@ -73,7 +74,7 @@ class HTTGenEvent : public ModuleBase {
   virtual int Execute(TreeEvent *event);
 
   GenEvent_Tau BuildTauInfo(GenParticle *tau,
-                            std::vector<GenParticle *> const &parts,
+                            GenGraph const &graph,
                             bool is_pythia8);
   virtual int PostAnalysis();
   // virtual void PrintInfo();
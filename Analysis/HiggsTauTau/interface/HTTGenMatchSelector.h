@@ -6,7 +6,8 @@
 #include "PhysicsTools/FWLite/interface/TFileService.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/HistoSet.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
-#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/DRMatrix.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
 
 
 #include <string>
@@ -61,7 +62,7 @@ int HTTGenMatchSelector<T>::Execute(TreeEvent *event) {
       }
     }
     
-    std::vector<GenJet> gen_taus = BuildTauJets(particles, false,true);
+    std::vector<GenJet> gen_taus = GenGraph::Get(event, "genParticles").TauJets(false, true);
     for (auto & x : gen_taus) gen_taus_ptr.push_back(new GenJet(x));
     ic::erase_if(gen_taus_ptr, !boost::bind(MinPtMaxEta, _1, 15.0, 999.));
     
@@ -69,36 +70,36 @@ int HTTGenMatchSelector<T>::Execute(TreeEvent *event) {
     event->Add("genLeps", sel_particles);
   }
   
+  DRMatrix lepton_dr(input_vec, sel_particles);
+  DRMatrix tau_dr(input_vec, gen_taus_ptr);
+  std::vector<int> lepton_best = lepton_dr.BestMatch(0.2);
+  std::vector<int> tau_best = tau_dr.BestMatch(0.2);
+
   for(unsigned i=0; i<input_vec.size(); ++i){
-    std::vector<T *> lepton;
-    lepton.push_back(input_vec[i]);
-    std::vector<std::pair<T*, GenParticle*> > lepton_match = MatchByDR(lepton, sel_particles, 0.2, true, true);
-    std::vector<std::pair<T*, GenJet*> > tau_match  = MatchByDR(lepton, gen_taus_ptr, 0.2, true, true);
-    
     mcorigin gen_match_1 = mcorigin::fake;
-    int leptonsize = lepton_match.size();
-    int tausize = tau_match.size();
+    int leptonsize = lepton_best[i] >= 0 ? 1 : 0;
+    int tausize = tau_best[i] >= 0 ? 1 : 0;
     
     if(leptonsize!=0&&tausize!=0){
-      DR(lepton_match.at(0).first,lepton_match.at(0).second) < DR(tau_match.at(0).first,tau_match.at(0).second) ? tausize=0 : leptonsize = 0;
+      lepton_dr.DR2(i, lepton_best[i]) < tau_dr.DR2(i, tau_best[i]) ? tausize=0 : leptonsize = 0;
     }
     
     if(leptonsize==0&&tausize==0) gen_match_1 = mcorigin::fake;
     if(leptonsize!=0) {
-      std::vector<bool> status_flags = lepton_match.at(0).second->statusFlags();
+      std::vector<bool> status_flags = sel_particles[lepton_best[i]]->statusFlags();
       
       if(status_flags[IsPrompt]){
-        if(abs(lepton_match.at(0).second->pdgid())==11){
+        if(abs(sel_particles[lepton_best[i]]->pdgid())==11){
           gen_match_1 = mcorigin::promptE;
          } else gen_match_1 = mcorigin::promptMu;
       }
       if(status_flags[IsDirectPromptTauDecayProduct]){
-       if(abs(lepton_match.at(0).second->pdgid())==11){
+       if(abs(sel_particles[lepton_best[i]]->pdgid())==11){
          gen_match_1 = mcorigin::tauE;
         } else gen_match_1 = mcorigin::tauMu;
        }
       if(status_flags[IsDirectHadronDecayProduct]){
-        if(abs(lepton_match.at(0).second->pdgid())==11){
+        if(abs(sel_particles[lepton_best[i]]->pdgid())==11){
           gen_match_1 = mcorigin::hadE;
          } else gen_match_1 = mcorigin::hadMu;
        } 
@@ -0,0 +1,49 @@
+#ifndef ICHiggsTauTau_HiggsTauTau_HTTJobConfig_h
+#define ICHiggsTauTau_HiggsTauTau_HTTJobConfig_h
+
+#include <vector>
+#include <string>
+#include "Utilities/interface/json.h"
+
+namespace ic {
+
+/**
+ * The schema (see ic::ValidateJson) for the configuration of one
+ * HTTSequence, i.e. the "sequence" block and each entry of the "channels"
+ * and "sequences" blocks of an HTT.cpp config.
+ *
+ * This lists every key HTTSequence reads, with the type it is read as, so
+ * it must be updated when HTTSequence starts reading a new key.
+ */
+Json::Value HTTSequenceSchema();
+
+/**
+ * The schema for a complete HTT.cpp configuration
+ */
+Json::Value HTTJobSchema();
+
+/**
+ * Resolves a merged HTT.cpp configuration into the list of sequences the job
+ * will run
+ *
+ * The channels to skip (ignored, duplicated, or not matching the data or
+ * embedded sample) are dropped and the "sequence", "channels" and
+ * "sequences" blocks are merged once for every remaining channel and
+ * variation. The result has the form:
+ *
+ *     {"job": {...}, "sequences": [{"name": "mt_default", "channel": "mt",
+ *      "config": {...}}, ...]}
+ *
+ * and can be saved with ic::WriteJsonToBinaryFile so that jobs start from
+ * it directly.
+ *
+ * @param js The merged configuration
+ * @param errors Unknown keys and values of the wrong type are appended here
+ * @param warnings Keys that are accepted but unused are appended here
+ */
+Json::Value CompileHTTJobConfig(Json::Value const& js,
+                                std::vector<std::string>& errors,
+                                std::vector<std::string>& warnings);
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <memory>
 #include "boost/lexical_cast.hpp"
 #include "boost/algorithm/string.hpp"
 #include "boost/format.hpp"
@@ -11,6 +12,7 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TextElement.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/SimpleParamParser.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnRootTools.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/ShapeCache.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTAnalysisTools.h"
 #include "RooWorkspace.h"
@@ -319,6 +321,13 @@ namespace ic {
                               std::string const& weight);
 
       void SetQCDRatio(double const& ratio);
+
+      //! Use a persistent cache for the histograms made with TTree::Draw
+      /*! GetShape and GetRate look up each (input file, variable, selection)
+          query in \p cache before drawing it, and store the result on a miss.
+          The same cache can be shared between several HTTRun2Analysis objects.
+      */
+      inline void SetShapeCache(std::shared_ptr<ShapeCache> const& cache) { shape_cache_ = cache; }
       inline void SetVerbosity(unsigned const& verbosity) { verbosity_ = verbosity; }
       inline void SetSS(){do_ss_ = true;}
 
@@ -338,6 +347,8 @@ namespace ic {
       std::map<std::string, std::pair<double, double>> sample_info_;
       std::map<std::string, TFile *> tfiles_;
       std::map<std::string, TTree *> ttrees_;
+      std::map<std::string, std::string> file_stamps_;
+      std::shared_ptr<ShapeCache> shape_cache_;
       std::map<std::string, std::string> alias_map_;
       std::map<std::string, std::vector<std::string>> samples_alias_map_;
 
@@ -345,6 +356,11 @@ namespace ic {
                                  std::string const& category,
                                  std::string const& weight);
       std::string BuildVarString(std::string const& variable);
+      // Key of a TTree::Draw query in the shape cache, or an empty string
+      // if it should not be cached
+      std::string ShapeCacheKey(std::string const& sample,
+                                std::string const& variable,
+                                std::string const& full_selection);
 
   };
  
@@ -31,6 +31,7 @@ class HTTRun2RecoilCorrector : public ModuleBase {
   CLASS_MEMBER(HTTRun2RecoilCorrector, int, met_res_mode)
   CLASS_MEMBER(HTTRun2RecoilCorrector, unsigned, njets_mode)
   CLASS_MEMBER(HTTRun2RecoilCorrector, bool, do_recoil)
+  CLASS_MEMBER(HTTRun2RecoilCorrector, bool, check_recoil_tables)
 
 
 
@@ -45,6 +45,17 @@ class HTTSequence {
   HTTSequence() = default;
   ~HTTSequence();
   ModuleSequence* getSequence(){return &seq;}
+  // The output file, or an empty string if there isn't one
+  std::string getOutputFile() const;
+  // Saves the output file as it is, stamped with the checkpoint number,
+  // see AnalysisBase::SetCheckpoint
+  void Checkpoint(unsigned number);
+  // The checkpoint number stamped in an output file, or -1 if there is none
+  static int SavedCheckpoint(std::string const& filename);
+  // Removes the checkpoint stamp from a finished output file
+  static void RemoveCheckpointStamp(std::string const& filename);
+  // Applies the job's output tree settings, see ic::ConfigureOutputTrees
+  void ConfigureOutputTrees(Json::Value const& cfg);
   void BuildSequence();
   void BuildETPairs();
   void BuildMTPairs();
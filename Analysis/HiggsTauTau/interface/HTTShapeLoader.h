@@ -0,0 +1,124 @@
+#ifndef ICHiggsTauTau_HiggsTauTau_HTTShapeLoader_h
+#define ICHiggsTauTau_HiggsTauTau_HTTShapeLoader_h
+
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include "TH1.h"
+#include "TH1F.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTStatTools.h"
+
+//! HTTShapeLoader
+/*!
+  Bulk loading of datacards and shape files into an HTTSetup. Each datacard
+  is read and tokenised in a single pass, and each ROOT file is opened once:
+  the keys of every category directory are listed a single time and all the
+  requested histograms are read in one go. Bin contents and errors are
+  collected contiguously in an HTTShapeStore, from which the TH1F copies held
+  by the HTTSetup are built; the store itself is released at the end of Load.
+  Independent datacards and ROOT files can be processed in parallel.
+
+  Usage mirrors the existing HTTSetup::ParseDatacard/ParseROOTFile calls:
+
+      HTTSetup setup;
+      HTTShapeLoader loader;
+      loader.AddDatacard("htt_mt_1_8TeV.txt", "mt", 1, "8TeV", "125");
+      loader.AddROOTFile("htt_mt.input_8TeV.root", "mt", "8TeV");
+      loader.set_threads(4).Load(setup);
+*/
+
+namespace ic {
+
+class HTTShapeStore {
+ public:
+  struct Block {
+    std::size_t offset;   // index of the underflow bin in contents/errors
+    std::size_t edge;     // index of the first bin edge in edges
+    unsigned nbins;       // number of bins, excluding under/overflow
+  };
+
+ private:
+  std::vector<double> contents_;
+  std::vector<double> errors_;
+  std::vector<double> edges_;
+  std::vector<Block> blocks_;
+  std::map<std::string, unsigned> index_;
+
+ public:
+  // Copies the bins of hist into the store under the given key. If the
+  // key already exists the existing index is returned and nothing is copied.
+  unsigned Add(std::string const& key, TH1 const& hist);
+  // Appends all the shapes of other, skipping keys that already exist
+  void Merge(HTTShapeStore const& other);
+  // Returns the index of key or -1 if not present
+  int Find(std::string const& key) const;
+
+  inline unsigned size() const { return blocks_.size(); }
+  inline Block const& block(unsigned i) const { return blocks_[i]; }
+  // Pointers to the nbins+2 contents/errors (including under/overflow)
+  // and nbins+1 edges of shape i
+  inline double const* contents(unsigned i) const { return &(contents_[blocks_[i].offset]); }
+  inline double const* errors(unsigned i) const { return &(errors_[blocks_[i].offset]); }
+  inline double const* edges(unsigned i) const { return &(edges_[blocks_[i].edge]); }
+
+  // Equivalent to TH1::Integral(), i.e. excluding under/overflow
+  double Integral(unsigned i) const;
+  // Builds a new, directory-less TH1F from shape i
+  TH1F * MakeTH1F(unsigned i, std::string const& name) const;
+
+  static std::string MakeKey(std::string const& channel, std::string const& era,
+                             std::string const& category, std::string const& name);
+};
+
+class HTTShapeLoader {
+ private:
+  struct CardInput {
+    std::string filename;
+    std::string channel;
+    int category_id;
+    std::string era;
+    std::string mass;
+  };
+  struct FileInput {
+    std::string filename;
+    std::string channel;
+    std::string era;
+  };
+  struct CardContent {
+    std::vector<Observation> obs;
+    std::vector<Process> processes;
+    std::vector<Nuisance> params;
+  };
+
+  // category -> set of histogram names to read from one file
+  typedef std::map<std::string, std::set<std::string>> RequestMap;
+
+  std::vector<CardInput> cards_;
+  std::vector<FileInput> files_;
+  unsigned threads_;
+  bool verbose_;
+
+  static int ParseCard(CardInput const& input, CardContent & content);
+  static int ReadFile(FileInput const& input, RequestMap const& requests,
+                      HTTShapeStore & store);
+
+ public:
+  HTTShapeLoader();
+
+  HTTShapeLoader & AddDatacard(std::string const& filename, std::string const& channel,
+                               int category_id, std::string const& era, std::string const& mass);
+  HTTShapeLoader & AddROOTFile(std::string const& filename, std::string const& channel,
+                               std::string const& era);
+  inline HTTShapeLoader & set_threads(unsigned const& val) { threads_ = val; return *this; }
+  inline HTTShapeLoader & set_verbose(bool const& val) { verbose_ = val; return *this; }
+
+  // Parses all the datacards, reads all the shapes they refer to and
+  // appends the result to setup. Returns the number of inputs that could
+  // not be processed.
+  int Load(HTTSetup & setup);
+};
+
+}
+
+#endif
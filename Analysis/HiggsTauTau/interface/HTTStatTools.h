@@ -116,7 +116,19 @@ struct Observation {
 	static void PrintHeader(std::ostream &out);
 };
 
+// Reads the observation, process and nuisance entries of a datacard,
+// labelling each with the channel, category id, era and mass given. This is
+// the parser behind HTTSetup::ParseDatacard and HTTShapeLoader. Returns 1
+// if the file cannot be opened.
+int ParseDatacardEntries(std::string const& filename, std::string const& channel,
+		int category_id, std::string const& era, std::string const& mass,
+		std::vector<Observation> & obs, std::vector<Process> & processes,
+		std::vector<Nuisance> & params);
+
+class HTTShapeLoader;
+
 class HTTSetup {
+	friend class HTTShapeLoader;
 	private:
 		std::vector<Nuisance> params_;
 		std::vector<Process> processes_;
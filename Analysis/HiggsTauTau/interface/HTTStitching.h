@@ -6,9 +6,11 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/BTagWeight.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/json.h"
 #include "PhysicsTools/FWLite/interface/TFileService.h"
 
 #include <string>
+#include <vector>
 
 
 namespace ic {
@@ -22,6 +24,9 @@ class HTTStitching : public ModuleBase {
   CLASS_MEMBER(HTTStitching, bool, do_dy_soup_high_mass)
   CLASS_MEMBER(HTTStitching, bool, do_dy_soup_htbinned)
   CLASS_MEMBER(HTTStitching, fwlite::TFileService*, fs)
+  // Take the number of LHE partons, the LHE HT and mll from the EventInfo
+  // (ICEventInfoProducer with includeHT) instead of the lheParticles
+  CLASS_MEMBER(HTTStitching, bool, use_gen_summary)
 
   TTree *t_gen_info_;
   int t_decay_;
@@ -37,6 +42,26 @@ class HTTStitching : public ModuleBase {
   double wxs0_,wxs1_,wxs2_,wxs3_,wxs4_,w_lo_nlo_corr_;
   double wt_lumi_;
 
+  // The weight of each (partons, HT, mll) bin of a soup, compiled in
+  // PreAnalysis from the yields and cross sections. Bins of the phase space
+  // covered only by the inclusive sample hold -1 and set no weight.
+  struct Table {
+    std::string weight;
+    unsigned n_partons;
+    // Lower edges of the HT bins above the first
+    std::vector<double> ht_edges;
+    // A separate bin for Z->tautau with mll > 150 GeV
+    bool split_high_mass;
+    std::vector<double> values;
+    unsigned Index(unsigned partons, double ht, bool high_mass) const;
+  };
+  std::vector<Table> tables_;
+
+  void AddTable(std::string const& weight, unsigned n_partons,
+                std::vector<double> const& ht_edges, bool split_high_mass,
+                std::vector<double> const& values);
+  unsigned CountStatus3Partons(TreeEvent *event, unsigned boson);
+
 
  public:
   HTTStitching(std::string const& name);
@@ -54,6 +79,15 @@ class HTTStitching : public ModuleBase {
   void SetDYInputCrossSections(double zxs0, double zxs1, double zxs2, double zxs3, double zxs4);
   void SetDYInputCrossSectionsHighMass(double zxsinc, double zxs1, double zxs2, double zxs3, double zxs4, double zxshm);
   void SetWInputCrossSections(double wxs0, double wxs1, double wxs2, double wxs3, double wxs4);
+  // Takes the cross sections ("xs") and event counts ("evt") of the
+  // inclusive sample followed by the 1-4 jet (or HT) binned samples from
+  // a Params json, e.g. scripts/Params_2016_summer16.json
+  void SetWInputsFromParams(Json::Value const& params, std::vector<std::string> const& samples);
+  void SetDYInputsFromParams(Json::Value const& params, std::vector<std::string> const& samples);
+  // The weight the tables give to an event, or -1 if none, for checking
+  // the stitching offline
+  double StitchingWeight(std::string const& weight, unsigned partons, double ht,
+                         double mll, bool is_ztt) const;
 };
 
 }
@@ -123,6 +123,27 @@ class HTTWeights : public ModuleBase {
   BTagWeight btag_weight;
   TF1 *tau_fake_weights_;
   std::map<std::string, std::shared_ptr<RooFunctor>> fns_;
+  // EventInfo weight handles of the weights set in Execute, see
+  // EventInfo::weight_handle
+  unsigned ggh_handle_;
+  unsigned wt_embedding_handle_;
+  unsigned wt_stitching_handle_;
+  unsigned wt_embedding_yield_handle_;
+  unsigned topquark_weight_handle_;
+  unsigned tau_fake_weight_handle_;
+  unsigned wt_tau_id_sf_handle_;
+  unsigned jeteta_weight_handle_;
+  unsigned wt_zpt_handle_;
+  unsigned wt_z_handle_;
+  unsigned wt_tracking_eff_handle_;
+  unsigned filter_eff_handle_;
+  unsigned lepton_handle_;
+  unsigned tt_muon_weight_handle_;
+  unsigned emu_e_fakerate_handle_;
+  unsigned emu_m_fakerate_handle_;
+  unsigned etau_fakerate_handle_;
+  unsigned mtau_fakerate_handle_;
+  unsigned tau_mode_scale_handle_;
 
 
  public:
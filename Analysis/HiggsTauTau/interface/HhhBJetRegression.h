@@ -5,13 +5,10 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
 
-namespace TMVA {
-	class Reader;
-}
-
 namespace ic {
 
 class TreeEvent;
+class MVAReader;
 
 class HhhBJetRegression : public ModuleBase {
  private:
@@ -19,7 +16,7 @@ class HhhBJetRegression : public ModuleBase {
  	CLASS_MEMBER(HhhBJetRegression, std::string, jets_label)
  	CLASS_MEMBER(HhhBJetRegression, std::string, regression_mva_file)
 
- 	TMVA::Reader *regression_reader_;
+ 	MVAReader *regression_reader_;
 
  	float prebjet_bcsv;
  	float prebjet_pt;
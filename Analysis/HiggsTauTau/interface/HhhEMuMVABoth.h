@@ -5,13 +5,10 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
 
-namespace TMVA {
-	class Reader;
-}
-
 namespace ic {
 
 class TreeEvent;
+class MVAReader;
 
 class HhhEMuMVABoth : public ModuleBase {
  private:
@@ -23,9 +20,9 @@ class HhhEMuMVABoth : public ModuleBase {
   CLASS_MEMBER(HhhEMuMVABoth, std::string, gf_mva_file_bdtg)
 	CLASS_MEMBER(HhhEMuMVABoth, std::string, mva_input_data)
 
- 	TMVA::Reader *gf_reader_bdt_;
-	TMVA::Reader *gf_reader_bdtg_;
-  // TMVA::Reader *vbf_reader_;
+ 	MVAReader *gf_reader_bdt_;
+	MVAReader *gf_reader_bdtg_;
+  // MVAReader *vbf_reader_;
 
   float fpzeta_;
  	float fpzetamiss_;
@@ -5,13 +5,10 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
 
-namespace TMVA {
-	class Reader;
-}
-
 namespace ic {
 
 class TreeEvent;
+class MVAReader;
 
 class HhhEMuMVATwoStage : public ModuleBase {
  private:
@@ -22,9 +19,9 @@ class HhhEMuMVATwoStage : public ModuleBase {
  	CLASS_MEMBER(HhhEMuMVATwoStage, std::string, gf_mva_file)
   CLASS_MEMBER(HhhEMuMVATwoStage, std::string, gf_mva_file_2)
 
- 	TMVA::Reader *gf_reader_;
-	TMVA::Reader *gf_reader_2_;
-  // TMVA::Reader *vbf_reader_;
+ 	MVAReader *gf_reader_;
+	MVAReader *gf_reader_2_;
+  // MVAReader *vbf_reader_;
 
  	float fpzeta_;
  	float fpzetamiss_;
@@ -5,13 +5,10 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
 
-namespace TMVA {
-	class Reader;
-}
-
 namespace ic {
 
 class TreeEvent;
+class MVAReader;
 
 class HhhMTMVABoth : public ModuleBase {
  private:
@@ -22,8 +19,8 @@ class HhhMTMVABoth : public ModuleBase {
  	CLASS_MEMBER(HhhMTMVABoth, std::string, gf_mva_file_bdt)
 	CLASS_MEMBER(HhhMTMVABoth, std::string, mva_input_data)
 
- 	TMVA::Reader *gf_reader_bdt_;
-  // TMVA::Reader *vbf_reader_;
+ 	MVAReader *gf_reader_bdt_;
+  // MVAReader *vbf_reader_;
 
  	float fmet_;
  	float fpt_1_;
@@ -6,6 +6,11 @@
 #include "UserCode/ICHiggsTauTau/interface/Candidate.hh"
 #include "UserCode/ICHiggsTauTau/interface/Met.hh"
 #include "HiggsTauTau/LegacySVFit/interface/NSVfitStandaloneAlgorithm.h"
+// svFitStandalone, used from 2015 on, needs TauAnalysis/SVfitStandalone in
+// the CMSSW area and is only built with SVFIT_STANDALONE=1
+#ifdef IC_SVFIT_STANDALONE
+#include "TauAnalysis/SVfitStandalone/interface/SVfitStandaloneAlgorithm.h"
+#endif
 
 #include "TTree.h"
 
@@ -27,11 +32,13 @@ namespace ic {
     static double SVFitMassMuHad(Candidate const* lep, Candidate const* had, int decm2, Met const* met, bool MC=false);
     static double SVFitMassEleMu(Candidate const* lep1, Candidate const* lep2, Met const* met, bool MC=false);
     static double SVFitMassHadHad(Candidate const* had1, int decm1, Candidate const* had2, int decm2, Met const* met, bool MC=false);
+*/
+#ifdef IC_SVFIT_STANDALONE
     static std::pair<Candidate, double> SVFitCandidateEleHad(Candidate const* lep, Candidate const* had, int decm2,  Met const* met, bool MC=false);
     static std::pair<Candidate, double> SVFitCandidateMuHad(Candidate const* lep, Candidate const* had, int decm2, Met const* met, bool MC=false);
     static std::pair<Candidate, double> SVFitCandidateEleMu(Candidate const* lep1, Candidate const* lep2, Met const* met, bool MC=false);
     static std::pair<Candidate, double> SVFitCandidateHadHad(Candidate const* had1, int decm1, Candidate const* had2,int decm2,  Met const* met, bool MC=false);
-*/
+#endif
 
 
   };
@@ -5,6 +5,10 @@
 #include "TObjString.h"
 #include <iostream>
 #include <cmath>
+#include <vector>
+#include <string>
+#include <map>
+#include <utility>
 
 class mssm_xs_tools{
  public:
@@ -187,6 +191,29 @@ Double_t GiveXsec_UncDown_Santander_H(Double_t mA, Double_t tanb, TString PDFCL)
   Double_t GiveXsec_UncDown_Santander_h(Double_t mA, Double_t tanb, TString PDFCL);
   Double_t GiveXsec_UncDown_Santander_A(Double_t mA, Double_t tanb, TString PDFCL);
 
+  // batch access, for scans over many (mA, tanb) points
+  // every TH2F in the input file is copied by SetInput into one table per
+  // binning, with the quantities of each bin next to each other. Quantities
+  // are named as the histograms without the "h_" prefix, e.g. "ggF_xsec_A"
+  // or "brtautau_A"
+  std::vector<std::string> Give_Quantities() const;
+  // fills values[p*names.size()+q] with quantity names[q] at the point
+  // (mA[p], tanb[p]). By default this is the content of the bin found as
+  // in the methods above, in the units of the file (the ggF xsections are
+  // in pb, not fb). With interpolate it is the bilinear interpolation
+  // between bin centres, constant beyond the outermost centres
+  void Give_Values(std::vector<std::string> const& names,
+                   std::vector<Double_t> const& mA, std::vector<Double_t> const& tanb,
+                   std::vector<Double_t> & values, bool interpolate=false) const;
+  // xsection times BR in fb for each production, one of "ggF", "bbH" (5f),
+  // "bbH4f" or "ggFplusbbH" (others throw, as their units are not known),
+  // and decay, e.g. "tautau".
+  // values[(p*productions.size()+i)*3+j] is production i of boson j at
+  // point p, with the bosons in the order h, H, A
+  void Give_XsecBR(std::vector<std::string> const& productions, std::string const& decay,
+                   std::vector<Double_t> const& mA, std::vector<Double_t> const& tanb,
+                   std::vector<Double_t> & values, bool interpolate=false) const;
+
 
  private:
   /////////////////////////////////////////////////////////////////////
@@ -325,6 +352,27 @@ Double_t GiveXsec_UncDown_Santander_H(Double_t mA, Double_t tanb, TString PDFCL)
   TH2F*	m_h_mh;  //	mh (mA,tan(beta))
   TH2F*	m_h_mH;  //	mH (mA,tan(beta))
 
+  // the tables for the batch access
+  struct Axis {
+    std::vector<Double_t> edges;
+    bool uniform;
+    // as TAxis::FindBin, 0 and nbins+1 for under- and overflow
+    int FindBin(Double_t x) const;
+    Double_t Centre(int bin) const { return 0.5*(edges[bin-1]+edges[bin]); }
+    // the bins either side of x and the weight of the upper one
+    void Bracket(Double_t x, int & lo, int & hi, Double_t & w) const;
+  };
+  struct Grid {
+    Axis x, y;
+    unsigned n_columns;
+    // n_columns values for each global bin, including under- and overflows
+    std::vector<Double_t> table;
+  };
+  std::vector<Grid> m_grids;
+  // (grid, column) of each quantity
+  std::map<std::string, std::pair<unsigned, unsigned> > m_columns;
+  void BuildGrids();
+
 };
 
 #endif // MSSM_XS_TOOLS_H
@@ -11,7 +11,6 @@
 #include "boost/filesystem.hpp"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/SimpleParamParser.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnRootTools.h"
-#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/th1fmorph.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
 #include "TPad.h"
 #include "TCanvas.h"
@@ -862,7 +861,7 @@ namespace ic {
             } else {
               yield = y1 + ((y2 - y1)/(x2 - x1))*(x-x1);
             }
-            hmap[p+infix+m+postfix].first = *(th1fmorph("morphed","morphed", &(hmap[p+infix+s1+postfix].first), &(hmap[p+infix+s2+postfix].first), x1, x2, x, yield, 0));
+            hmap[p+infix+m+postfix].first = HorizontalMorph(hmap[p+infix+s1+postfix].first, hmap[p+infix+s2+postfix].first, x1, x2, {x}, {yield})[0];
             hmap[p+infix+m+postfix].second = std::make_pair(yield,0.0);
           }
         }
@@ -909,24 +908,24 @@ namespace ic {
       std::cout << "[HTTAnalysis::InterpolateSMSignal] Running horizontal morphing for: ";
       for (auto p : new_points) std::cout << p << " ";
       std::cout << std::endl;
+      if (new_points.empty()) continue;
       for (unsigned j = 0; j < procs.size(); ++j) {
         TH1F h_low = this->GenerateSignal(names[j]+masses[i], var, sel, cat, wt, fixed_xs).first;
         TH1F h_high = this->GenerateSignal(names[j]+masses[i+1], var, sel, cat, wt, fixed_xs).first;
+        TH1F h_ref = this->GenerateSignal(names[j]+masses[i], var_final, sel, cat, wt, fixed_xs).first;
+        double y1 = h_low.Integral();
+        double y2 = h_high.Integral();
+        std::vector<double> yields;
         for (unsigned k = 0; k < new_points.size(); ++k) {
-          double yield = 1.0;
-          double y1 = h_low.Integral();
-          double y2 = h_high.Integral();
-          if (m_high == m_low) {
-            yield =  0.5*(y1+y2);
-          } else {
-            yield = y1 + ((y2 - y1)/(m_high - m_low))*(new_points[k]-m_low);
-          }
-          TH1F result = *(th1fmorph("morphed","morphed", &h_low, &h_high, m_low, m_high, new_points[k], yield, 0));
-          TH1F h_ref = this->GenerateSignal(names[j]+masses[i], var_final, sel, cat, wt, fixed_xs).first;
-          result = * ( (TH1F*)result.Rebin(h_ref.GetNbinsX(),"",h_ref.GetXaxis()->GetXbins()->GetArray())  );
+          yields.push_back(y1 + ((y2 - y1)/(m_high - m_low))*(new_points[k]-m_low));
+        }
+        // All the points between this pair of masses in one go
+        std::vector<TH1F> morphed = HorizontalMorph(h_low, h_high, m_low, m_high, new_points, yields);
+        for (unsigned k = 0; k < new_points.size(); ++k) {
+          TH1F result = * ( (TH1F*)morphed[k].Rebin(h_ref.GetNbinsX(),"",h_ref.GetXaxis()->GetXbins()->GetArray())  );
           std::string m_str = boost::lexical_cast<std::string>(int(new_points[k]+0.5));
           hmap[procs[j]+infix+m_str+postfix].first = result;
-          hmap[procs[j]+infix+m_str+postfix].second = std::make_pair(yield,0.0);
+          hmap[procs[j]+infix+m_str+postfix].second = std::make_pair(yields[k],0.0);
         }
       }
     }
@@ -0,0 +1,796 @@
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTCategories.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+#include "UserCode/ICHiggsTauTau/interface/PFJet.hh"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
+
+#include "TMath.h"
+#include "TLorentzVector.h"
+
+namespace ic {
+
+  void HTTCategories::BookJets() {
+    outtree_->Branch("n_jets",            &n_jets_);
+    outtree_->Branch("n_bjets",           &n_bjets_);
+    outtree_->Branch("n_loose_bjets",     &n_loose_bjets_);
+    outtree_->Branch("mjj",               &mjj_.var_double);
+    outtree_->Branch("n_jetsingap",       &n_jetsingap_);
+    outtree_->Branch("jdeta",             &jdeta_.var_double);
+    outtree_->Branch("jdphi",             &jdphi_);
+    outtree_->Branch("dijetpt",           &dijetpt_);
+    if (strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16 || strategy_ == strategy::cpsummer17){
+      outtree_->Branch("sjdphi",             &sjdphi_);
+      outtree_->Branch("D0", &D0_);
+      outtree_->Branch("DCP", &DCP_);
+      outtree_->Branch("spjdphi", &spjdphi_     );
+      outtree_->Branch("min_hj_deta", &min_hj_deta_ );
+      outtree_->Branch("pjdeta", &pjdeta_      );
+      outtree_->Branch("pjahdeta", &pjahdeta_    );
+      outtree_->Branch("pjbhdeta", &pjbhdeta_    );
+      outtree_->Branch("prob_region", &prob_region_ );
+      outtree_->Branch("n_pjets", &n_pjets_ );
+      outtree_->Branch("opp_sides",             &opp_sides_);
+    }
+    outtree_->Branch("n_lowpt_jets",      &n_lowpt_jets_);
+    outtree_->Branch("n_jetsingap_lowpt", &n_jetsingap_lowpt_);
+    outtree_->Branch("mjj_lowpt",         &mjj_lowpt_);
+    outtree_->Branch("jpt_1",             &jpt_1_.var_double);
+    outtree_->Branch("jpt_2",             &jpt_2_.var_double);
+    outtree_->Branch("jeta_1",            &jeta_1_.var_double);
+    outtree_->Branch("jeta_2",            &jeta_2_.var_double);
+    outtree_->Branch("jdeta_lowpt",       &jdeta_lowpt_);
+    if(qcd_study_){
+      outtree_->Branch("jet_flav_1", &jet_flav_1_);
+      outtree_->Branch("jet_flav_2", &jet_flav_2_);
+      outtree_->Branch("jet_flav_3", &jet_flav_3_);
+    }
+
+    if(do_jes_vars_){
+      outtree_->Branch("n_jets_1",    &n_jets_1_   );
+      outtree_->Branch("n_jets_2",    &n_jets_2_   );
+      outtree_->Branch("n_jets_3",    &n_jets_3_   );
+      outtree_->Branch("n_jets_4",    &n_jets_4_   );
+      outtree_->Branch("n_jets_5",    &n_jets_5_   );
+      outtree_->Branch("n_jets_6",    &n_jets_6_   );
+      outtree_->Branch("n_jets_7",    &n_jets_7_   );
+      outtree_->Branch("n_jets_8",    &n_jets_8_   );
+      outtree_->Branch("n_jets_9",    &n_jets_9_   );
+      outtree_->Branch("n_jets_10",   &n_jets_10_  );
+      outtree_->Branch("n_jets_11",   &n_jets_11_  );
+      outtree_->Branch("n_jets_12",   &n_jets_12_  );
+      outtree_->Branch("n_jets_13",   &n_jets_13_  );
+      outtree_->Branch("n_jets_14",   &n_jets_14_  );
+      outtree_->Branch("n_jets_15",   &n_jets_15_  );
+      outtree_->Branch("n_jets_16",   &n_jets_16_  );
+      outtree_->Branch("n_jets_17",   &n_jets_17_  );
+      outtree_->Branch("n_jets_18",   &n_jets_18_  );
+      outtree_->Branch("n_jets_19",   &n_jets_19_  );
+      outtree_->Branch("n_jets_20",   &n_jets_20_  );
+      outtree_->Branch("n_jets_21",   &n_jets_21_  );
+      outtree_->Branch("n_jets_22",   &n_jets_22_  );
+      outtree_->Branch("n_jets_23",   &n_jets_23_  );
+      outtree_->Branch("n_jets_24",   &n_jets_24_  );
+      outtree_->Branch("n_jets_25",   &n_jets_25_  );
+      outtree_->Branch("n_jets_26",   &n_jets_26_  );
+      outtree_->Branch("n_jets_27",   &n_jets_27_  );
+      outtree_->Branch("n_jets_28",   &n_jets_28_  );
+      outtree_->Branch("n_bjets_1",   &n_bjets_1_  );
+      outtree_->Branch("n_bjets_2",   &n_bjets_2_  );
+      outtree_->Branch("n_bjets_3",   &n_bjets_3_  );
+      outtree_->Branch("n_bjets_4",   &n_bjets_4_  );
+      outtree_->Branch("n_bjets_5",   &n_bjets_5_  );
+      outtree_->Branch("n_bjets_6",   &n_bjets_6_  );
+      outtree_->Branch("n_bjets_7",   &n_bjets_7_  );
+      outtree_->Branch("n_bjets_8",   &n_bjets_8_  );
+      outtree_->Branch("n_bjets_9",   &n_bjets_9_  );
+      outtree_->Branch("n_bjets_10",  &n_bjets_10_ );
+      outtree_->Branch("n_bjets_11",  &n_bjets_11_ );
+      outtree_->Branch("n_bjets_12",  &n_bjets_12_ );
+      outtree_->Branch("n_bjets_13",  &n_bjets_13_ );
+      outtree_->Branch("n_bjets_14",  &n_bjets_14_ );
+      outtree_->Branch("n_bjets_15",  &n_bjets_15_ );
+      outtree_->Branch("n_bjets_16",  &n_bjets_16_ );
+      outtree_->Branch("n_bjets_17",  &n_bjets_17_ );
+      outtree_->Branch("n_bjets_18",  &n_bjets_18_ );
+      outtree_->Branch("n_bjets_19",  &n_bjets_19_ );
+      outtree_->Branch("n_bjets_20",  &n_bjets_20_ );
+      outtree_->Branch("n_bjets_21",  &n_bjets_21_ );
+      outtree_->Branch("n_bjets_22",  &n_bjets_22_ );
+      outtree_->Branch("n_bjets_23",  &n_bjets_23_ );
+      outtree_->Branch("n_bjets_24",  &n_bjets_24_ );
+      outtree_->Branch("n_bjets_25",  &n_bjets_25_ );
+      outtree_->Branch("n_bjets_26",  &n_bjets_26_ );
+      outtree_->Branch("n_bjets_27",  &n_bjets_27_ );
+      outtree_->Branch("n_bjets_28",  &n_bjets_28_ );
+      outtree_->Branch("mjj_1",       &mjj_1_      );
+      outtree_->Branch("mjj_2",       &mjj_2_      );
+      outtree_->Branch("mjj_3",       &mjj_3_      );
+      outtree_->Branch("mjj_4",       &mjj_4_      );
+      outtree_->Branch("mjj_5",       &mjj_5_      );
+      outtree_->Branch("mjj_6",       &mjj_6_      );
+      outtree_->Branch("mjj_7",       &mjj_7_      );
+      outtree_->Branch("mjj_8",       &mjj_8_      );
+      outtree_->Branch("mjj_9",       &mjj_9_      );
+      outtree_->Branch("mjj_10",      &mjj_10_     );
+      outtree_->Branch("mjj_11",      &mjj_11_     );
+      outtree_->Branch("mjj_12",      &mjj_12_     );
+      outtree_->Branch("mjj_13",      &mjj_13_     );
+      outtree_->Branch("mjj_14",      &mjj_14_     );
+      outtree_->Branch("mjj_15",      &mjj_15_     );
+      outtree_->Branch("mjj_16",      &mjj_16_     );
+      outtree_->Branch("mjj_17",      &mjj_17_     );
+      outtree_->Branch("mjj_18",      &mjj_18_     );
+      outtree_->Branch("mjj_19",      &mjj_19_     );
+      outtree_->Branch("mjj_20",      &mjj_20_     );
+      outtree_->Branch("mjj_21",      &mjj_21_     );
+      outtree_->Branch("mjj_22",      &mjj_22_     );
+      outtree_->Branch("mjj_23",      &mjj_23_     );
+      outtree_->Branch("mjj_24",      &mjj_24_     );
+      outtree_->Branch("mjj_25",      &mjj_25_     );
+      outtree_->Branch("mjj_26",      &mjj_26_     );
+      outtree_->Branch("mjj_27",      &mjj_27_     );
+      outtree_->Branch("mjj_28",      &mjj_28_     );
+      if( strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16){
+        outtree_->Branch("sjdphi_1",     &sjdphi_1_    );
+        outtree_->Branch("sjdphi_2",     &sjdphi_2_    );
+        outtree_->Branch("sjdphi_3",     &sjdphi_3_    );
+        outtree_->Branch("sjdphi_4",     &sjdphi_4_    );
+        outtree_->Branch("sjdphi_5",     &sjdphi_5_    );
+        outtree_->Branch("sjdphi_6",     &sjdphi_6_    );
+        outtree_->Branch("sjdphi_7",     &sjdphi_7_    );
+        outtree_->Branch("sjdphi_8",     &sjdphi_8_    );
+        outtree_->Branch("sjdphi_9",     &sjdphi_9_    );
+        outtree_->Branch("sjdphi_10",    &sjdphi_10_   );
+        outtree_->Branch("sjdphi_11",    &sjdphi_11_   );
+        outtree_->Branch("sjdphi_12",    &sjdphi_12_   );
+        outtree_->Branch("sjdphi_13",    &sjdphi_13_   );
+        outtree_->Branch("sjdphi_14",    &sjdphi_14_   );
+        outtree_->Branch("sjdphi_15",    &sjdphi_15_   );
+        outtree_->Branch("sjdphi_16",    &sjdphi_16_   );
+        outtree_->Branch("sjdphi_17",    &sjdphi_17_   );
+        outtree_->Branch("sjdphi_18",    &sjdphi_18_   );
+        outtree_->Branch("sjdphi_19",    &sjdphi_19_   );
+        outtree_->Branch("sjdphi_20",    &sjdphi_20_   );
+        outtree_->Branch("sjdphi_21",    &sjdphi_21_   );
+        outtree_->Branch("sjdphi_22",    &sjdphi_22_   );
+        outtree_->Branch("sjdphi_23",    &sjdphi_23_   );
+        outtree_->Branch("sjdphi_24",    &sjdphi_24_   );
+        outtree_->Branch("sjdphi_25",    &sjdphi_25_   );
+        outtree_->Branch("sjdphi_26",    &sjdphi_26_   );
+        outtree_->Branch("sjdphi_27",    &sjdphi_27_   );
+        outtree_->Branch("sjdphi_28",    &sjdphi_28_   );
+        outtree_->Branch("D0_1"   , &D0_1_  );
+        outtree_->Branch("D0_2"   , &D0_2_  );
+        outtree_->Branch("D0_3"   , &D0_3_  );
+        outtree_->Branch("D0_4"   , &D0_4_  );
+        outtree_->Branch("D0_5"   , &D0_5_  );
+        outtree_->Branch("D0_6"   , &D0_6_  );
+        outtree_->Branch("D0_7"   , &D0_7_  );
+        outtree_->Branch("D0_8"   , &D0_8_  );
+        outtree_->Branch("D0_9"   , &D0_9_  );
+        outtree_->Branch("D0_10"  , &D0_10_ );
+        outtree_->Branch("D0_11"  , &D0_11_ );
+        outtree_->Branch("D0_12"  , &D0_12_ );
+        outtree_->Branch("D0_13"  , &D0_13_ );
+        outtree_->Branch("D0_14"  , &D0_14_ );
+        outtree_->Branch("D0_15"  , &D0_15_ );
+        outtree_->Branch("D0_16"  , &D0_16_ );
+        outtree_->Branch("D0_17"  , &D0_17_ );
+        outtree_->Branch("D0_18"  , &D0_18_ );
+        outtree_->Branch("D0_19"  , &D0_19_ );
+        outtree_->Branch("D0_20"  , &D0_20_ );
+        outtree_->Branch("D0_21"  , &D0_21_ );
+        outtree_->Branch("D0_22"  , &D0_22_ );
+        outtree_->Branch("D0_23"  , &D0_23_ );
+        outtree_->Branch("D0_24"  , &D0_24_ );
+        outtree_->Branch("D0_25"  , &D0_25_ );
+        outtree_->Branch("D0_26"  , &D0_26_ );
+        outtree_->Branch("D0_27"  , &D0_27_ );
+        outtree_->Branch("D0_28"  , &D0_28_ );
+        
+        outtree_->Branch("DCP_1"   , &DCP_1_  );
+        outtree_->Branch("DCP_2"   , &DCP_2_  );
+        outtree_->Branch("DCP_3"   , &DCP_3_  );
+        outtree_->Branch("DCP_4"   , &DCP_4_  );
+        outtree_->Branch("DCP_5"   , &DCP_5_  );
+        outtree_->Branch("DCP_6"   , &DCP_6_  );
+        outtree_->Branch("DCP_7"   , &DCP_7_  );
+        outtree_->Branch("DCP_8"   , &DCP_8_  );
+        outtree_->Branch("DCP_9"   , &DCP_9_  );
+        outtree_->Branch("DCP_10"  , &DCP_10_ );
+        outtree_->Branch("DCP_11"  , &DCP_11_ );
+        outtree_->Branch("DCP_12"  , &DCP_12_ );
+        outtree_->Branch("DCP_13"  , &DCP_13_ );
+        outtree_->Branch("DCP_14"  , &DCP_14_ );
+        outtree_->Branch("DCP_15"  , &DCP_15_ );
+        outtree_->Branch("DCP_16"  , &DCP_16_ );
+        outtree_->Branch("DCP_17"  , &DCP_17_ );
+        outtree_->Branch("DCP_18"  , &DCP_18_ );
+        outtree_->Branch("DCP_19"  , &DCP_19_ );
+        outtree_->Branch("DCP_20"  , &DCP_20_ );
+        outtree_->Branch("DCP_21"  , &DCP_21_ );
+        outtree_->Branch("DCP_22"  , &DCP_22_ );
+        outtree_->Branch("DCP_23"  , &DCP_23_ );
+        outtree_->Branch("DCP_24"  , &DCP_24_ );
+        outtree_->Branch("DCP_25"  , &DCP_25_ );
+        outtree_->Branch("DCP_26"  , &DCP_26_ );
+        outtree_->Branch("DCP_27"  , &DCP_27_ );
+        outtree_->Branch("DCP_28"  , &DCP_28_ );
+      }
+    }
+
+    //Variables needed for control plots need only be generated for central systematics
+    if(!systematic_shift_) {
+      outtree_->Branch("n_prebjets",        &n_prebjets_);
+      outtree_->Branch("nearjpt_1",             &nearjpt_1_);
+      outtree_->Branch("j1_dm",             &j1_dm_);
+      outtree_->Branch("jphi_1",            &jphi_1_, "jphi_1/F");
+      outtree_->Branch("jphi_2",            &jphi_2_, "jphi_1/F");
+      outtree_->Branch("bpt_1",             &bpt_1_.var_double);
+      outtree_->Branch("bpt_2",             &bpt_2_.var_double);
+      outtree_->Branch("beta_1",            &beta_1_.var_double);
+      outtree_->Branch("bcsv_1",            &bcsv_1_.var_double);
+      if((strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16) && do_sm_scale_wts_){
+        outtree_->Branch("wt_scale_et_0jet"   , &wt_scale_et_0jet_    );
+        outtree_->Branch("wt_scale_et_boosted" , &wt_scale_et_boosted_ );
+        outtree_->Branch("wt_scale_et_vbf"    , &wt_scale_et_vbf_     );
+        outtree_->Branch("wt_scale_mt_0jet"   , &wt_scale_mt_0jet_    );
+        outtree_->Branch("wt_scale_mt_boosted" , &wt_scale_mt_boosted_ );
+        outtree_->Branch("wt_scale_mt_vbf"    , &wt_scale_mt_vbf_     );
+        outtree_->Branch("wt_scale_em_0jet"   , &wt_scale_em_0jet_    );
+        outtree_->Branch("wt_scale_em_boosted" , &wt_scale_em_boosted_ );
+        outtree_->Branch("wt_scale_em_vbf"    , &wt_scale_em_vbf_     );
+        outtree_->Branch("wt_scale_tt_0jet"   , &wt_scale_tt_0jet_    );
+        outtree_->Branch("wt_scale_tt_boosted" , &wt_scale_tt_boosted_ );
+        outtree_->Branch("wt_scale_tt_vbf"    , &wt_scale_tt_vbf_     );
+      }
+      if (channel_ == channel::em) {
+        outtree_->Branch("emu_csv",           &emu_csv_);
+      }
+    }
+  }
+
+  void HTTCategories::FillJets(TreeEvent *event) {
+    CompositeCandidate const* ditau = objects_.ditau;
+    Candidate const* lep1 = objects_.lep1;
+    Candidate const* lep2 = objects_.lep2;
+
+    std::vector<PFJet*> jets = event->GetPtrVec<PFJet>(jets_label_);
+    std::vector<PFJet*> uncleaned_jets = event->GetPtrVec<PFJet>(jets_label_+"UnFiltered");
+    std::vector<PFJet*> corrected_jets;
+    if(bjet_regression_) corrected_jets = event->GetPtrVec<PFJet>(jets_label_+"Corrected");
+    std::sort(jets.begin(), jets.end(), bind(&Candidate::pt, _1) > bind(&Candidate::pt, _2));
+    std::vector<PFJet*> lowpt_jets = jets;
+    ic::erase_if(jets,!boost::bind(MinPtMaxEta, _1, 30.0, 4.7));
+    ic::erase_if(lowpt_jets,!boost::bind(MinPtMaxEta, _1, 20.0, 4.7));
+    std::vector<PFJet*> prebjets = lowpt_jets;
+    ic::erase_if(prebjets,!boost::bind(MinPtMaxEta, _1, 20.0, 2.4));
+    std::vector<PFJet*> bjets = prebjets;
+    std::vector<PFJet*> loose_bjets = prebjets;
+    std::string btag_label="combinedSecondaryVertexBJetTags";
+    double btag_wp =  0.679;
+    double loose_btag_wp = 0.244;
+    if(strategy_ == strategy::phys14) btag_label = "combinedInclusiveSecondaryVertexV2BJetTags";
+    if(strategy_ == strategy::phys14) btag_wp = 0.814 ;
+    if(strategy_ == strategy::spring15) btag_label = "pfCombinedInclusiveSecondaryVertexV2BJetTags";
+    if(strategy_ == strategy::spring15) btag_wp = 0.89 ;
+    if(strategy_ == strategy::fall15 || strategy_ == strategy::mssmspring16 ||
+      strategy_ == strategy::smspring16  || strategy_ == strategy::mssmsummer16 || 
+      strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16 || 
+      strategy_ == strategy::cpsummer17) btag_label = "pfCombinedInclusiveSecondaryVertexV2BJetTags";
+    if(strategy_ == strategy::fall15 || strategy_ == strategy::mssmspring16 ||strategy_ ==strategy::smspring16) btag_wp = 0.8;
+    if(strategy_ == strategy::mssmsummer16 || strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16) btag_wp = 0.8484;
+    if(strategy_ == strategy::cpsummer17) btag_wp = 0.8838;
+    if(strategy_ == strategy::fall15 || strategy_ == strategy::mssmspring16 || 
+      strategy_ == strategy::smspring16 || strategy_ == strategy::mssmsummer16 || 
+      strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16) loose_btag_wp = 0.46;
+    if(strategy_ == strategy::cpsummer17) loose_btag_wp = 0.5803;
+
+   //Extra set of jets which are CSV ordered is required for the H->hh analysis
+    std::vector<PFJet*> jets_csv = prebjets;
+    std::vector<PFJet*> bjets_csv = prebjets;
+    std::sort(jets_csv.begin(), jets_csv.end(), bind(&PFJet::GetBDiscriminator, _1, btag_label) > bind(&PFJet::GetBDiscriminator, _2, btag_label));
+    std::vector<std::pair<PFJet*,PFJet*> > jet_csv_pairs;
+    if(bjet_regression_) jet_csv_pairs = MatchByDR(jets_csv, corrected_jets, 0.5, true, true);
+
+    //Sort out the loose (em,mt,et) or medium (tt) b-jets
+    if(era_ != era::data_2016 && era_ != era::data_2017){
+      if(channel_!= channel::tt){
+        ic::erase_if(loose_bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < loose_btag_wp);
+      } else {
+        ic::erase_if(bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) <btag_wp);
+        ic::erase_if(bjets_csv, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) <btag_wp);
+      }
+      // Instead of changing b-tag value in the promote/demote method we look for a map of bools
+      // that say whether a jet should pass the WP or not
+      if (event->Exists("retag_result")) {
+        auto const& retag_result = event->Get<std::map<std::size_t,bool>>("retag_result"); 
+         if(channel_ != channel::tt ){
+            ic::erase_if(bjets, !boost::bind(IsReBTagged, _1, retag_result));
+            ic::erase_if(bjets_csv, !boost::bind(IsReBTagged, _1, retag_result));
+         } else {
+            ic::erase_if(loose_bjets, !boost::bind(IsReBTagged, _1, retag_result));
+        }
+      } else{ 
+        if(channel_ != channel::tt){
+          ic::erase_if(bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < btag_wp);
+          ic::erase_if(bjets_csv, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < btag_wp);
+        } else {
+          ic::erase_if(loose_bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < loose_btag_wp);
+        }
+      } 
+    } else {
+      ic::erase_if(loose_bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < loose_btag_wp);
+      // Instead of changing b-tag value in the promote/demote method we look for a map of bools
+      // that say whether a jet should pass the WP or not
+      if (event->Exists("retag_result")) {
+        auto const& retag_result = event->Get<std::map<std::size_t,bool>>("retag_result"); 
+        ic::erase_if(bjets, !boost::bind(IsReBTagged, _1, retag_result));
+        ic::erase_if(bjets_csv, !boost::bind(IsReBTagged, _1, retag_result));
+      } else{ 
+        ic::erase_if(bjets, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < btag_wp);
+        ic::erase_if(bjets_csv, boost::bind(&PFJet::GetBDiscriminator, _1, btag_label) < btag_wp);
+      } 
+    }
+
+    
+
+    objects_.jets = jets;
+    objects_.uncleaned_jets = uncleaned_jets;
+    objects_.lowpt_jets = lowpt_jets;
+    objects_.prebjets = prebjets;
+    objects_.bjets = bjets;
+    objects_.loose_bjets = loose_bjets;
+    objects_.jets_csv = jets_csv;
+    objects_.bjets_csv = bjets_csv;
+    objects_.jet_csv_pairs = jet_csv_pairs;
+    objects_.btag_label = btag_label;
+
+    n_jets_ = jets.size();
+    n_lowpt_jets_ = lowpt_jets.size();
+    n_bjets_ = bjets.size();
+    n_prebjets_ = prebjets.size();
+    n_jets_csv_ = jets_csv.size();
+    n_loose_bjets_ = loose_bjets.size();
+
+    if(uncleaned_jets.size() > 0 && (channel_ == channel::mt || channel_ == channel::et) && jetfake_study_) {
+      std::vector<Candidate *> subleading_lepton;
+      subleading_lepton.push_back(ditau->GetCandidate("lepton2")); 
+      std::vector<std::pair<ic::PFJet *, ic::Candidate *>> matches = MatchByDR(uncleaned_jets, subleading_lepton, 0.5, true, true);
+      if(matches.size() > 0) {
+        nearjpt_1_ = (matches.at(0)).first->pt();
+      } else {
+        nearjpt_1_ = -9999;
+      }
+    }
+    
+
+    if(qcd_study_ && (channel_ == channel::mt || channel_ == channel::et)){
+      std::vector<Candidate *> leading_lepton;
+      std::vector<Candidate *> subleading_lepton;
+      leading_lepton.push_back(ditau->GetCandidate("lepton1"));
+      subleading_lepton.push_back(ditau->GetCandidate("lepton2")); 
+      std::vector<std::pair<ic::PFJet *, ic::Candidate *>> mu_matches = MatchByDR(uncleaned_jets, leading_lepton, 0.5, true, true);
+      std::vector<std::pair<ic::PFJet *, ic::Candidate *>> tau_matches = MatchByDR(uncleaned_jets, subleading_lepton, 0.5, true, true);
+      if(mu_matches.size() > 0) {
+          jet_flav_1_ = (mu_matches.at(0)).first->parton_flavour();
+      } else jet_flav_1_ = -9999;
+      if(tau_matches.size() > 0) {
+          jet_flav_2_ = (tau_matches.at(0)).first->parton_flavour();
+      } else jet_flav_2_ = -9999;
+      if(jets.size() > 0) {
+          jet_flav_3_ = jets[0]->parton_flavour();
+      } else jet_flav_3_ = -9999;
+    }
+    
+    if (n_lowpt_jets_ >= 1) {
+      jpt_1_ = lowpt_jets[0]->pt();
+      jeta_1_ = lowpt_jets[0]->eta();
+      jphi_1_ = lowpt_jets[0]->phi();
+      jrawf_1_ = lowpt_jets[0]->uncorrected_energy()/lowpt_jets[0]->energy();//* (jets[0]->pt() / jets[0]->energy());
+      jptunc_1_ = 0.0;
+      jmva_1_ = lowpt_jets[0]->pu_id_mva_value();
+      jlrm_1_ = lowpt_jets[0]->linear_radial_moment();
+      jctm_1_ = lowpt_jets[0]->charged_multiplicity_nopu();
+      std::vector<ic::Tau *> taus = event->GetPtrVec<Tau>("taus");
+      std::vector<ic::Jet *> leadjet = { jets[0] };
+      std::vector<std::pair<ic::Jet *, ic::Tau *>> matches = MatchByDR(leadjet, taus, 0.5, true, true);
+      if (matches.size() == 1) {
+        j1_dm_ = matches[0].second->decay_mode();
+      } else {
+        j1_dm_ = -1;
+      }
+    } else {
+      jpt_1_ = -9999;
+      jeta_1_ = -9999;
+      jphi_1_ = -9999;
+      jrawf_1_ = -9999;
+      jptunc_1_ = -9999;
+      jmva_1_ = -9999;
+      jlrm_1_ = -9999;
+      jctm_1_ = -9999;
+    }
+
+    if (n_lowpt_jets_ >= 2) {
+      jpt_2_ = lowpt_jets[1]->pt();
+      jeta_2_ = lowpt_jets[1]->eta();
+      jphi_2_ = lowpt_jets[1]->phi();
+      jrawf_2_ = lowpt_jets[1]->uncorrected_energy()/lowpt_jets[1]->energy();// * (jets[1]->pt() / jets[1]->energy());
+      jptunc_2_ = 0.0;
+      jmva_2_ = lowpt_jets[1]->pu_id_mva_value();
+      jlrm_2_ = lowpt_jets[1]->linear_radial_moment();
+      jctm_2_ = lowpt_jets[1]->charged_multiplicity_nopu();
+      mjj_ = (lowpt_jets[0]->vector() + lowpt_jets[1]->vector()).M();
+      jdeta_ = fabs(lowpt_jets[0]->eta() - lowpt_jets[1]->eta());
+      jdphi_ =  ROOT::Math::VectorUtil::DeltaPhi(lowpt_jets[0]->vector(), lowpt_jets[1]->vector());
+      dijetpt_ =  (lowpt_jets[0]->vector() + lowpt_jets[1]->vector()).pt();
+      
+      if (strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16 || strategy_ == strategy::cpsummer17){
+        if (event->Exists("D0")) D0_ = event->Get<float>("D0");
+        else D0_ = -9999;
+        if (event->Exists("DCP")) DCP_ = event->Get<float>("DCP");
+        else DCP_ = -9999;
+
+        if(lowpt_jets[0]->eta() > lowpt_jets[1]->eta()){
+          sjdphi_ =  ROOT::Math::VectorUtil::DeltaPhi(lowpt_jets[0]->vector(), lowpt_jets[1]->vector());
+        }
+        else{
+          sjdphi_ =  ROOT::Math::VectorUtil::DeltaPhi(lowpt_jets[1]->vector(), lowpt_jets[0]->vector());
+        }
+        opp_sides_ = lowpt_jets[0]->eta()*lowpt_jets[1]->eta() < 0 ? 1 : 0;
+        
+        n_pjets_=0;
+        if (jets.size()==1) n_pjets_=1;
+        if(jets.size()>=2){
+          double higgs_eta = 0;
+          if (event->Exists("svfitHiggs")) {
+            Candidate const& higgs = event->Get<Candidate>("svfitHiggs");
+            higgs_eta = higgs.eta();
+          }
+          else higgs_eta = (lep1->vector()+lep2->vector()).Rapidity();
+          // sort jets higher and lower than higgs eta_1
+          std::vector<PFJet*> jets_high;
+          std::vector<PFJet*> jets_low;
+          for (unsigned i=0; i<jets.size(); ++i){
+            if (jets[i]->eta() > higgs_eta) jets_high.push_back(jets[i]);    
+            else jets_low.push_back(jets[i]);
+          }
+          if(jets_low.size()>0) n_pjets_++;
+          if(jets_high.size()>0) n_pjets_++;
+          Candidate pseudo_jet_a;
+          Candidate pseudo_jet_b;
+          for (auto j : jets_low) pseudo_jet_a.set_vector(pseudo_jet_a.vector()+j->vector());
+          for (auto j : jets_high) pseudo_jet_b.set_vector(pseudo_jet_b.vector()+j->vector());
+          spjdphi_ =  ROOT::Math::VectorUtil::DeltaPhi(pseudo_jet_a.vector(),pseudo_jet_b.vector());
+          for (unsigned i=0; i<jets.size(); ++i){
+            double dEta = std::fabs(higgs_eta - jets[i]->eta());  
+            if(i==0 || dEta<min_hj_deta_) min_hj_deta_ = dEta;    
+          }
+          pjdeta_ = std::fabs(pseudo_jet_a.vector().Rapidity() - pseudo_jet_b.vector().Rapidity());
+          pjahdeta_ = std::fabs(pseudo_jet_a.vector().Rapidity() - higgs_eta);
+          pjbhdeta_ = std::fabs(pseudo_jet_a.vector().Rapidity() - higgs_eta);
+          if((jets[0]->eta()>higgs_eta&&jets[1]->eta()>higgs_eta)||(jets[0]->eta()<higgs_eta&&jets[1]->eta()<higgs_eta)) prob_region_ = 1;
+          else prob_region_ = 0;
+        }
+        else {
+          spjdphi_ = -9999;
+          min_hj_deta_ = -9999;
+          pjdeta_ =-9999;
+          pjahdeta_ = -9999;
+          pjbhdeta_ = -9999;
+          prob_region_ = -9999;
+        }
+      }
+      
+      double eta_high = (lowpt_jets[0]->eta() > lowpt_jets[1]->eta()) ? lowpt_jets[0]->eta() : lowpt_jets[1]->eta();
+      double eta_low = (lowpt_jets[0]->eta() > lowpt_jets[1]->eta()) ? lowpt_jets[1]->eta() : lowpt_jets[0]->eta();
+      n_jetsingap_ = 0;
+      n_jetsingap20_ = 0;
+ 
+      if (n_lowpt_jets_ > 2) {
+        for (unsigned i = 2; i < lowpt_jets.size(); ++i) {
+         if (lowpt_jets[i]->pt() > 30.0 &&  lowpt_jets[i]->eta() > eta_low && lowpt_jets[i]->eta() < eta_high) ++n_jetsingap_;
+         if (lowpt_jets[i]->pt() > 20.0 &&  lowpt_jets[i]->eta() > eta_low && lowpt_jets[i]->eta() < eta_high) ++n_jetsingap20_;
+        }
+      }
+    } else {
+      jpt_2_ = -9999;
+      jeta_2_ = -9999;
+      jphi_2_ = -9999;
+      mjj_ = -9999;
+      jdeta_ = -9999;
+      jdphi_ = -9999;
+      dijetpt_ = -9999;
+      jrawf_2_ = -9999;
+      jptunc_2_ = -9999;
+      jmva_2_ = -9999;
+      jlrm_2_ = -9999;
+      jctm_2_ = -9999;
+      n_jetsingap_ = 9999;
+      n_jetsingap20_ = 9999;
+    }
+
+    if (n_lowpt_jets_ >= 2) {
+      mjj_lowpt_ = (lowpt_jets[0]->vector() + lowpt_jets[1]->vector()).M();
+      jdeta_lowpt_ = fabs(lowpt_jets[0]->eta() - lowpt_jets[1]->eta());
+      double eta_high = (lowpt_jets[0]->eta() > lowpt_jets[1]->eta()) ? lowpt_jets[0]->eta() : lowpt_jets[1]->eta();
+      double eta_low = (lowpt_jets[0]->eta() > lowpt_jets[1]->eta()) ? lowpt_jets[1]->eta() : lowpt_jets[0]->eta();
+      n_jetsingap_lowpt_ = 0;
+      if (n_lowpt_jets_ > 2) {
+        for (unsigned i = 2; i < lowpt_jets.size(); ++i) {
+         if (lowpt_jets[i]->pt() > 30.0 &&  lowpt_jets[i]->eta() > eta_low && lowpt_jets[i]->eta() < eta_high) ++n_jetsingap_lowpt_;
+        }
+      }
+    } else {
+      mjj_lowpt_ = -9999;
+      jdeta_lowpt_ = -9999;
+      n_jetsingap_lowpt_ = 9999;
+    }
+    
+    if((strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16) && do_sm_scale_wts_ && !systematic_shift_){
+      // weights needed for SM scale uncertainties are computer here rather than in HTTWeights - since these are parametarized as a function of the offline mjj and pt_tt which are computer in HTTCategories anyway
+      wt_scale_et_0jet_  = 0.973 + 0.0003405 * pt_2_.var_double;
+      wt_scale_et_boosted_ = 0.986 - 0.0000278 *pt_tt_.var_double;
+      wt_scale_et_vbf_  = 0.971 + 0.0000327 * mjj_.var_double;
+      wt_scale_mt_0jet_ = 0.929 + 0.0001702 * pt_2_.var_double;
+      wt_scale_mt_boosted_ = 0.919 + 0.0010055 * pt_tt_.var_double;
+      wt_scale_mt_vbf_ = 1.026 +0.000066 * mjj_.var_double;
+      wt_scale_em_0jet_ = 0.942 - 0.0000170 * pt_2_.var_double;
+      wt_scale_em_boosted_ = 0.936 + 0.0008871 * pt_tt_.var_double;
+      wt_scale_em_vbf_ = 1.032 + 0.000102 * mjj_.var_double;
+      wt_scale_tt_0jet_ = 0.814 + 0.0027094 * pt_1_.var_double;
+      wt_scale_tt_boosted_ = 0.973 + 0.0008596 * pt_tt_.var_double;
+      wt_scale_tt_vbf_ = 1.094 + 0.0000545 * mjj_.var_double;     
+    }
+
+    if(do_jes_vars_){
+      n_jets_1_    = event->Exists("n_jets_1")    ? event->Get<double>("n_jets_1")   : -9999;                
+      n_jets_2_    = event->Exists("n_jets_2")    ? event->Get<double>("n_jets_2")   : -9999;
+      n_jets_3_    = event->Exists("n_jets_3")    ? event->Get<double>("n_jets_3")   : -9999;
+      n_jets_4_    = event->Exists("n_jets_4")    ? event->Get<double>("n_jets_4")   : -9999;
+      n_jets_5_    = event->Exists("n_jets_5")    ? event->Get<double>("n_jets_5")   : -9999;
+      n_jets_6_    = event->Exists("n_jets_6")    ? event->Get<double>("n_jets_6")   : -9999;
+      n_jets_7_    = event->Exists("n_jets_7")    ? event->Get<double>("n_jets_7")   : -9999;
+      n_jets_8_    = event->Exists("n_jets_8")    ? event->Get<double>("n_jets_8")   : -9999;
+      n_jets_9_    = event->Exists("n_jets_9")    ? event->Get<double>("n_jets_9")   : -9999;
+      n_jets_10_   = event->Exists("n_jets_10")   ? event->Get<double>("n_jets_10")  : -9999;
+      n_jets_11_   = event->Exists("n_jets_11")   ? event->Get<double>("n_jets_11")  : -9999;
+      n_jets_12_   = event->Exists("n_jets_12")   ? event->Get<double>("n_jets_12")  : -9999;
+      n_jets_13_   = event->Exists("n_jets_13")   ? event->Get<double>("n_jets_13")  : -9999;
+      n_jets_14_   = event->Exists("n_jets_14")   ? event->Get<double>("n_jets_14")  : -9999;
+      n_jets_15_   = event->Exists("n_jets_15")   ? event->Get<double>("n_jets_15")  : -9999;
+      n_jets_16_   = event->Exists("n_jets_16")   ? event->Get<double>("n_jets_16")  : -9999;
+      n_jets_17_   = event->Exists("n_jets_17")   ? event->Get<double>("n_jets_17")  : -9999;
+      n_jets_18_   = event->Exists("n_jets_18")   ? event->Get<double>("n_jets_18")  : -9999;
+      n_jets_19_   = event->Exists("n_jets_19")   ? event->Get<double>("n_jets_19")  : -9999;
+      n_jets_20_   = event->Exists("n_jets_20")   ? event->Get<double>("n_jets_20")  : -9999;
+      n_jets_21_   = event->Exists("n_jets_21")   ? event->Get<double>("n_jets_21")  : -9999;
+      n_jets_22_   = event->Exists("n_jets_22")   ? event->Get<double>("n_jets_22")  : -9999;
+      n_jets_23_   = event->Exists("n_jets_23")   ? event->Get<double>("n_jets_23")  : -9999;
+      n_jets_24_   = event->Exists("n_jets_24")   ? event->Get<double>("n_jets_24")  : -9999;
+      n_jets_25_   = event->Exists("n_jets_25")   ? event->Get<double>("n_jets_25")  : -9999;
+      n_jets_26_   = event->Exists("n_jets_26")   ? event->Get<double>("n_jets_26")  : -9999;
+      n_jets_27_   = event->Exists("n_jets_27")   ? event->Get<double>("n_jets_27")  : -9999;
+      n_jets_28_   = event->Exists("n_jets_28")   ? event->Get<double>("n_jets_28")  : -9999;
+      n_bjets_1_   = event->Exists("n_bjets_1")   ? event->Get<double>("n_bjets_1")  : -9999;
+      n_bjets_2_   = event->Exists("n_bjets_2")   ? event->Get<double>("n_bjets_2")  : -9999;
+      n_bjets_3_   = event->Exists("n_bjets_3")   ? event->Get<double>("n_bjets_3")  : -9999;
+      n_bjets_4_   = event->Exists("n_bjets_4")   ? event->Get<double>("n_bjets_4")  : -9999;
+      n_bjets_5_   = event->Exists("n_bjets_5")   ? event->Get<double>("n_bjets_5")  : -9999;
+      n_bjets_6_   = event->Exists("n_bjets_6")   ? event->Get<double>("n_bjets_6")  : -9999;
+      n_bjets_7_   = event->Exists("n_bjets_7")   ? event->Get<double>("n_bjets_7")  : -9999;
+      n_bjets_8_   = event->Exists("n_bjets_8")   ? event->Get<double>("n_bjets_8")  : -9999;
+      n_bjets_9_   = event->Exists("n_bjets_9")   ? event->Get<double>("n_bjets_9")  : -9999;
+      n_bjets_10_  = event->Exists("n_bjets_10")  ? event->Get<double>("n_bjets_10") : -9999;
+      n_bjets_11_  = event->Exists("n_bjets_11")  ? event->Get<double>("n_bjets_11") : -9999;
+      n_bjets_12_  = event->Exists("n_bjets_12")  ? event->Get<double>("n_bjets_12") : -9999;
+      n_bjets_13_  = event->Exists("n_bjets_13")  ? event->Get<double>("n_bjets_13") : -9999;
+      n_bjets_14_  = event->Exists("n_bjets_14")  ? event->Get<double>("n_bjets_14") : -9999;
+      n_bjets_15_  = event->Exists("n_bjets_15")  ? event->Get<double>("n_bjets_15") : -9999;
+      n_bjets_16_  = event->Exists("n_bjets_16")  ? event->Get<double>("n_bjets_16") : -9999;
+      n_bjets_17_  = event->Exists("n_bjets_17")  ? event->Get<double>("n_bjets_17") : -9999;
+      n_bjets_18_  = event->Exists("n_bjets_18")  ? event->Get<double>("n_bjets_18") : -9999;
+      n_bjets_19_  = event->Exists("n_bjets_19")  ? event->Get<double>("n_bjets_19") : -9999;
+      n_bjets_20_  = event->Exists("n_bjets_20")  ? event->Get<double>("n_bjets_20") : -9999;
+      n_bjets_21_  = event->Exists("n_bjets_21")  ? event->Get<double>("n_bjets_21") : -9999;
+      n_bjets_22_  = event->Exists("n_bjets_22")  ? event->Get<double>("n_bjets_22") : -9999;
+      n_bjets_23_  = event->Exists("n_bjets_23")  ? event->Get<double>("n_bjets_23") : -9999;
+      n_bjets_24_  = event->Exists("n_bjets_24")  ? event->Get<double>("n_bjets_24") : -9999;
+      n_bjets_25_  = event->Exists("n_bjets_25")  ? event->Get<double>("n_bjets_25") : -9999;
+      n_bjets_26_  = event->Exists("n_bjets_26")  ? event->Get<double>("n_bjets_26") : -9999;
+      n_bjets_27_  = event->Exists("n_bjets_27")  ? event->Get<double>("n_bjets_27") : -9999;
+      n_bjets_28_  = event->Exists("n_bjets_28")  ? event->Get<double>("n_bjets_28") : -9999;
+      mjj_1_       = event->Exists("mjj_1")       ? event->Get<double>("mjj_1")      : -9999;
+      mjj_2_       = event->Exists("mjj_2")       ? event->Get<double>("mjj_2")      : -9999;
+      mjj_3_       = event->Exists("mjj_3")       ? event->Get<double>("mjj_3")      : -9999;
+      mjj_4_       = event->Exists("mjj_4")       ? event->Get<double>("mjj_4")      : -9999;
+      mjj_5_       = event->Exists("mjj_5")       ? event->Get<double>("mjj_5")      : -9999;
+      mjj_6_       = event->Exists("mjj_6")       ? event->Get<double>("mjj_6")      : -9999;
+      mjj_7_       = event->Exists("mjj_7")       ? event->Get<double>("mjj_7")      : -9999;
+      mjj_8_       = event->Exists("mjj_8")       ? event->Get<double>("mjj_8")      : -9999;
+      mjj_9_       = event->Exists("mjj_9")       ? event->Get<double>("mjj_9")      : -9999;
+      mjj_10_      = event->Exists("mjj_10")      ? event->Get<double>("mjj_10")     : -9999;
+      mjj_11_      = event->Exists("mjj_11")      ? event->Get<double>("mjj_11")     : -9999;
+      mjj_12_      = event->Exists("mjj_12")      ? event->Get<double>("mjj_12")     : -9999;
+      mjj_13_      = event->Exists("mjj_13")      ? event->Get<double>("mjj_13")     : -9999;
+      mjj_14_      = event->Exists("mjj_14")      ? event->Get<double>("mjj_14")     : -9999;
+      mjj_15_      = event->Exists("mjj_15")      ? event->Get<double>("mjj_15")     : -9999;
+      mjj_16_      = event->Exists("mjj_16")      ? event->Get<double>("mjj_16")     : -9999;
+      mjj_17_      = event->Exists("mjj_17")      ? event->Get<double>("mjj_17")     : -9999;
+      mjj_18_      = event->Exists("mjj_18")      ? event->Get<double>("mjj_18")     : -9999;
+      mjj_19_      = event->Exists("mjj_19")      ? event->Get<double>("mjj_19")     : -9999;
+      mjj_20_      = event->Exists("mjj_20")      ? event->Get<double>("mjj_20")     : -9999;
+      mjj_21_      = event->Exists("mjj_21")      ? event->Get<double>("mjj_21")     : -9999;
+      mjj_22_      = event->Exists("mjj_22")      ? event->Get<double>("mjj_22")     : -9999;
+      mjj_23_      = event->Exists("mjj_23")      ? event->Get<double>("mjj_23")     : -9999;
+      mjj_24_      = event->Exists("mjj_24")      ? event->Get<double>("mjj_24")     : -9999;
+      mjj_25_      = event->Exists("mjj_25")      ? event->Get<double>("mjj_25")     : -9999;
+      mjj_26_      = event->Exists("mjj_26")      ? event->Get<double>("mjj_26")     : -9999;
+      mjj_27_      = event->Exists("mjj_27")      ? event->Get<double>("mjj_27")     : -9999;
+      mjj_28_      = event->Exists("mjj_28")      ? event->Get<double>("mjj_28")     : -9999;
+      sjdphi_1_     = event->Exists("sjdphi_1")     ? event->Get<double>("sjdphi_1")    : -9999;
+      sjdphi_2_     = event->Exists("sjdphi_2")     ? event->Get<double>("sjdphi_2")    : -9999;
+      sjdphi_3_     = event->Exists("sjdphi_3")     ? event->Get<double>("sjdphi_3")    : -9999;
+      sjdphi_4_     = event->Exists("sjdphi_4")     ? event->Get<double>("sjdphi_4")    : -9999;
+      sjdphi_5_     = event->Exists("sjdphi_5")     ? event->Get<double>("sjdphi_5")    : -9999;
+      sjdphi_6_     = event->Exists("sjdphi_6")     ? event->Get<double>("sjdphi_6")    : -9999;
+      sjdphi_7_     = event->Exists("sjdphi_7")     ? event->Get<double>("sjdphi_7")    : -9999;
+      sjdphi_8_     = event->Exists("sjdphi_8")     ? event->Get<double>("sjdphi_8")    : -9999;
+      sjdphi_9_     = event->Exists("sjdphi_9")     ? event->Get<double>("sjdphi_9")    : -9999;
+      sjdphi_10_    = event->Exists("sjdphi_10")    ? event->Get<double>("sjdphi_10")   : -9999;
+      sjdphi_11_    = event->Exists("sjdphi_11")    ? event->Get<double>("sjdphi_11")   : -9999;
+      sjdphi_12_    = event->Exists("sjdphi_12")    ? event->Get<double>("sjdphi_12")   : -9999;
+      sjdphi_13_    = event->Exists("sjdphi_13")    ? event->Get<double>("sjdphi_13")   : -9999;
+      sjdphi_14_    = event->Exists("sjdphi_14")    ? event->Get<double>("sjdphi_14")   : -9999;
+      sjdphi_15_    = event->Exists("sjdphi_15")    ? event->Get<double>("sjdphi_15")   : -9999;
+      sjdphi_16_    = event->Exists("sjdphi_16")    ? event->Get<double>("sjdphi_16")   : -9999;
+      sjdphi_17_    = event->Exists("sjdphi_17")    ? event->Get<double>("sjdphi_17")   : -9999;
+      sjdphi_18_    = event->Exists("sjdphi_18")    ? event->Get<double>("sjdphi_18")   : -9999;
+      sjdphi_19_    = event->Exists("sjdphi_19")    ? event->Get<double>("sjdphi_19")   : -9999;
+      sjdphi_20_    = event->Exists("sjdphi_20")    ? event->Get<double>("sjdphi_20")   : -9999;
+      sjdphi_21_    = event->Exists("sjdphi_21")    ? event->Get<double>("sjdphi_21")   : -9999;
+      sjdphi_22_    = event->Exists("sjdphi_22")    ? event->Get<double>("sjdphi_22")   : -9999;
+      sjdphi_23_    = event->Exists("sjdphi_23")    ? event->Get<double>("sjdphi_23")   : -9999;
+      sjdphi_24_    = event->Exists("sjdphi_24")    ? event->Get<double>("sjdphi_24")   : -9999;
+      sjdphi_25_    = event->Exists("sjdphi_25")    ? event->Get<double>("sjdphi_25")   : -9999;
+      sjdphi_26_    = event->Exists("sjdphi_26")    ? event->Get<double>("sjdphi_26")   : -9999;
+      sjdphi_27_    = event->Exists("sjdphi_27")    ? event->Get<double>("sjdphi_27")   : -9999;
+      sjdphi_28_    = event->Exists("sjdphi_28")    ? event->Get<double>("sjdphi_28")   : -9999;
+      D0_1_    = event->Exists("D0_1")    ? event->Get<int>("D0_1")   : -9999;
+      D0_2_    = event->Exists("D0_2")    ? event->Get<int>("D0_2")   : -9999;
+      D0_3_    = event->Exists("D0_3")    ? event->Get<int>("D0_3")   : -9999;
+      D0_4_    = event->Exists("D0_4")    ? event->Get<int>("D0_4")   : -9999;
+      D0_5_    = event->Exists("D0_5")    ? event->Get<int>("D0_5")   : -9999;
+      D0_6_    = event->Exists("D0_6")    ? event->Get<int>("D0_6")   : -9999;
+      D0_7_    = event->Exists("D0_7")    ? event->Get<int>("D0_7")   : -9999;
+      D0_8_    = event->Exists("D0_8")    ? event->Get<int>("D0_8")   : -9999;
+      D0_9_    = event->Exists("D0_9")    ? event->Get<int>("D0_9")   : -9999;
+      D0_10_    = event->Exists("D0_10")    ? event->Get<int>("D0_10")   : -9999;
+      D0_11_    = event->Exists("D0_11")    ? event->Get<int>("D0_11")   : -9999;
+      D0_12_    = event->Exists("D0_12")    ? event->Get<int>("D0_12")   : -9999;
+      D0_13_    = event->Exists("D0_13")    ? event->Get<int>("D0_13")   : -9999;
+      D0_14_    = event->Exists("D0_14")    ? event->Get<int>("D0_14")   : -9999;
+      D0_15_    = event->Exists("D0_15")    ? event->Get<int>("D0_15")   : -9999;
+      D0_16_    = event->Exists("D0_16")    ? event->Get<int>("D0_16")   : -9999;
+      D0_17_    = event->Exists("D0_17")    ? event->Get<int>("D0_17")   : -9999;
+      D0_18_    = event->Exists("D0_18")    ? event->Get<int>("D0_18")   : -9999;
+      D0_19_    = event->Exists("D0_19")    ? event->Get<int>("D0_19")   : -9999;
+      D0_20_    = event->Exists("D0_20")    ? event->Get<int>("D0_20")   : -9999;
+      D0_21_    = event->Exists("D0_21")    ? event->Get<int>("D0_21")   : -9999;
+      D0_22_    = event->Exists("D0_22")    ? event->Get<int>("D0_22")   : -9999;
+      D0_23_    = event->Exists("D0_23")    ? event->Get<int>("D0_23")   : -9999;
+      D0_24_    = event->Exists("D0_24")    ? event->Get<int>("D0_24")   : -9999;
+      D0_25_    = event->Exists("D0_25")    ? event->Get<int>("D0_25")   : -9999;
+      D0_26_    = event->Exists("D0_26")    ? event->Get<int>("D0_26")   : -9999;
+      D0_27_    = event->Exists("D0_27")    ? event->Get<int>("D0_27")   : -9999;
+      D0_28_    = event->Exists("D0_28")    ? event->Get<int>("D0_28")   : -9999;
+      DCP_1_    = event->Exists("DCP_1")    ? event->Get<int>("DCP_1")   : -9999;
+      DCP_2_    = event->Exists("DCP_2")    ? event->Get<int>("DCP_2")   : -9999;
+      DCP_3_    = event->Exists("DCP_3")    ? event->Get<int>("DCP_3")   : -9999;
+      DCP_4_    = event->Exists("DCP_4")    ? event->Get<int>("DCP_4")   : -9999;
+      DCP_5_    = event->Exists("DCP_5")    ? event->Get<int>("DCP_5")   : -9999;
+      DCP_6_    = event->Exists("DCP_6")    ? event->Get<int>("DCP_6")   : -9999;
+      DCP_7_    = event->Exists("DCP_7")    ? event->Get<int>("DCP_7")   : -9999;
+      DCP_8_    = event->Exists("DCP_8")    ? event->Get<int>("DCP_8")   : -9999;
+      DCP_9_    = event->Exists("DCP_9")    ? event->Get<int>("DCP_9")   : -9999;
+      DCP_10_    = event->Exists("DCP_10")    ? event->Get<int>("DCP_10")   : -9999;
+      DCP_11_    = event->Exists("DCP_11")    ? event->Get<int>("DCP_11")   : -9999;
+      DCP_12_    = event->Exists("DCP_12")    ? event->Get<int>("DCP_12")   : -9999;
+      DCP_13_    = event->Exists("DCP_13")    ? event->Get<int>("DCP_13")   : -9999;
+      DCP_14_    = event->Exists("DCP_14")    ? event->Get<int>("DCP_14")   : -9999;
+      DCP_15_    = event->Exists("DCP_15")    ? event->Get<int>("DCP_15")   : -9999;
+      DCP_16_    = event->Exists("DCP_16")    ? event->Get<int>("DCP_16")   : -9999;
+      DCP_17_    = event->Exists("DCP_17")    ? event->Get<int>("DCP_17")   : -9999;
+      DCP_18_    = event->Exists("DCP_18")    ? event->Get<int>("DCP_18")   : -9999;
+      DCP_19_    = event->Exists("DCP_19")    ? event->Get<int>("DCP_19")   : -9999;
+      DCP_20_    = event->Exists("DCP_20")    ? event->Get<int>("DCP_20")   : -9999;
+      DCP_21_    = event->Exists("DCP_21")    ? event->Get<int>("DCP_21")   : -9999;
+      DCP_22_    = event->Exists("DCP_22")    ? event->Get<int>("DCP_22")   : -9999;
+      DCP_23_    = event->Exists("DCP_23")    ? event->Get<int>("DCP_23")   : -9999;
+      DCP_24_    = event->Exists("DCP_24")    ? event->Get<int>("DCP_24")   : -9999;
+      DCP_25_    = event->Exists("DCP_25")    ? event->Get<int>("DCP_25")   : -9999;
+      DCP_26_    = event->Exists("DCP_26")    ? event->Get<int>("DCP_26")   : -9999;
+      DCP_27_    = event->Exists("DCP_27")    ? event->Get<int>("DCP_27")   : -9999;
+      DCP_28_    = event->Exists("DCP_28")    ? event->Get<int>("DCP_28")   : -9999;
+    }
+    
+
+    if (channel_ == channel::tt && strategy_ == strategy::fall15){
+      if (n_loose_bjets_ >= 1) {
+        bpt_1_ = loose_bjets[0]->pt();
+        brawf_1_ = loose_bjets[0]->uncorrected_energy()/loose_bjets[0]->energy();//* (jets[0]->pt() / jets[0]->energy());
+        beta_1_ = loose_bjets[0]->eta();
+        bphi_1_ = loose_bjets[0]->phi();
+        bmva_1_ = loose_bjets[0]->pu_id_mva_value();
+      
+      } else {
+        bpt_1_ = -9999;
+        brawf_1_ = -9999;
+        beta_1_ = -9999;
+        bphi_1_ = -9999;
+        bmva_1_ = -9999;
+      }
+
+      if (n_loose_bjets_ >= 2) {
+        bpt_2_ = loose_bjets[1]->pt();
+        brawf_2_ = loose_bjets[1]->uncorrected_energy()/loose_bjets[1]->energy();//* (jets[0]->pt() / jets[0]->energy());
+        beta_2_ = loose_bjets[1]->eta();
+        bphi_2_ = loose_bjets[1]->phi();
+        bmva_2_ = loose_bjets[1]->pu_id_mva_value();
+      
+      } else {
+        bpt_2_ = -9999;
+        brawf_2_ = -9999;
+        beta_2_ = -9999;
+        bphi_2_ = -9999;
+        bmva_2_ = -9999;
+      }
+
+    } else {
+      if (n_bjets_ >= 1) {
+        bpt_1_ = bjets[0]->pt();
+        brawf_1_ = bjets[0]->uncorrected_energy()/bjets[0]->energy();//* (jets[0]->pt() / jets[0]->energy());
+        beta_1_ = bjets[0]->eta();
+        bphi_1_ = bjets[0]->phi();
+        bmva_1_ = bjets[0]->pu_id_mva_value();
+      
+      } else {
+        bpt_1_ = -9999;
+        brawf_1_ = -9999;
+        beta_1_ = -9999;
+        bphi_1_ = -9999;
+        bmva_1_ = -9999;
+      }
+
+      if (n_bjets_ >= 2) {
+        bpt_2_ = bjets[1]->pt();
+        brawf_2_ = bjets[1]->uncorrected_energy()/bjets[1]->energy();//* (jets[0]->pt() / jets[0]->energy());
+        beta_2_ = bjets[1]->eta();
+        bphi_2_ = bjets[1]->phi();
+        bmva_2_ = bjets[1]->pu_id_mva_value();
+      
+      } else {
+        bpt_2_ = -9999;
+        brawf_2_ = -9999;
+        beta_2_ = -9999;
+        bphi_2_ = -9999;
+        bmva_2_ = -9999;
+      }
+    } 
+
+
+
+    if (n_prebjets_ >= 1) {
+      bcsv_1_ = prebjets[0]->GetBDiscriminator(btag_label);
+    } else {
+      bcsv_1_ = -9999;
+    }
+    if (n_prebjets_ >= 2) {
+      bcsv_2_ = prebjets[1]->GetBDiscriminator(btag_label);
+    } else {
+      bcsv_2_ = -9999;
+    }
+
+    emu_csv_ = (bcsv_1_.var_double > 0.244) ? bcsv_1_.var_double : -1.0;
+  }
+}
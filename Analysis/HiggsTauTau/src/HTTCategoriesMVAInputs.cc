@@ -0,0 +1,274 @@
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTCategories.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+#include "UserCode/ICHiggsTauTau/interface/PFJet.hh"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/HHKinFit/include/HHKinFitMaster.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/HHKinFit/include/HHDiJetKinFitMaster.h"
+
+#include "TVector3.h"
+#include "TMath.h"
+#include "TLorentzVector.h"
+
+namespace ic {
+
+  void HTTCategories::BookMVAInputs() {
+    if(add_Hhh_variables_) { 
+      outtree_->Branch("jet_csv_mjj",               &jet_csv_mjj_);
+      outtree_->Branch("m_H_hh",     &m_H_hh_);
+      outtree_->Branch("convergence_hh", &convergence_hh_);
+      outtree_->Branch("mjj_tt",            &mjj_tt_);
+      outtree_->Branch("n_jets_csv",        &n_jets_csv_);
+      outtree_->Branch("n_bjets_csv",       &n_bjets_csv_);
+      outtree_->Branch("jet_csvbcsv_1",     &jet_csvbcsv_1_);
+      outtree_->Branch("jet_csvbcsv_2",     &jet_csvbcsv_2_);
+    }
+
+    //Variables needed for control plots need only be generated for central systematics
+    if(!systematic_shift_) {
+      if(add_Hhh_variables_) {
+        outtree_->Branch("jet_csvpt_1",       &jet_csvpt_1_);
+        outtree_->Branch("jet_csveta_1",      &jet_csveta_1_);
+        outtree_->Branch("jet_csvpt_2",       &jet_csvpt_2_);
+        outtree_->Branch("jet_csveta_2",      &jet_csveta_2_);
+        outtree_->Branch("mjj_h",             &mjj_h_);
+        outtree_->Branch("mbb_h",             &mbb_h_);
+        if(kinfit_mode_ > 1) {
+          outtree_->Branch("m_H_best",               &m_H_best_);
+          outtree_->Branch("m_H_chi2_best",               &m_H_chi2_best_);
+          outtree_->Branch("pull_balance_H_best", &pull_balance_H_best_);
+          outtree_->Branch("convergence_H_best", &convergence_H_best_); 
+          outtree_->Branch("m_H_hZ",          &m_H_hZ_);
+          outtree_->Branch("m_H_hZ_chi2",     &m_H_hZ_chi2_);
+          outtree_->Branch("pull_balance_hZ", &pull_balance_hZ_);
+          outtree_->Branch("convergence_hZ", &convergence_hZ_);
+          outtree_->Branch("m_H_Zh",          &m_H_Zh_);
+          outtree_->Branch("m_H_Zh_chi2",     &m_H_Zh_chi2_);
+          outtree_->Branch("pull_balance_Zh",  &pull_balance_Zh_);
+          outtree_->Branch("convergence_Zh",  &convergence_Zh_);
+          outtree_->Branch("m_H_hh_all",     &m_H_hh_all_);
+          outtree_->Branch("m_H_hh_chi2",     &m_H_hh_chi2_);
+          outtree_->Branch("pull_balance_hh", &pull_balance_hh_);
+          outtree_->Branch("m_bb",     &m_bb_);
+          outtree_->Branch("m_bb_chi2",     &m_bb_chi2_);
+          outtree_->Branch("pull_balance_bb", &pull_balance_bb_);
+          outtree_->Branch("convergence_bb", &convergence_bb_);
+        }
+      }
+    }
+  }
+
+  void HTTCategories::FillMVAInputs(TreeEvent *event) {
+    CompositeCandidate const* ditau = objects_.ditau;
+    Candidate const* lep1 = objects_.lep1;
+    Candidate const* lep2 = objects_.lep2;
+    Met const* mets = objects_.mets;
+    std::vector<PFJet*> const& jets_csv = objects_.jets_csv;
+    std::vector<PFJet*> const& bjets_csv = objects_.bjets_csv;
+    std::vector<std::pair<PFJet*,PFJet*> > const& jet_csv_pairs = objects_.jet_csv_pairs;
+    std::string const& btag_label = objects_.btag_label;
+
+    n_jets_csv_ = jets_csv.size();
+    n_bjets_csv_ = bjets_csv.size();
+
+    if (n_jets_csv_ >= 1) {
+      jet_csvpt_1_ = jets_csv[0]->pt();
+      if(bjet_regression_) jet_csvpt_1_ = jet_csv_pairs[0].second->pt();
+      jet_csvEt_1_ = std::sqrt(jets_csv[0]->pt()*jets_csv[0]->pt() + jets_csv[0]->M()*jets_csv[0]->M());
+      if(bjet_regression_) jet_csvEt_1_ = std::sqrt(jet_csvpt_1_*jet_csvpt_1_ + jet_csv_pairs[0].second->M()*jet_csv_pairs[0].second->M());
+      jet_csveta_1_ = jets_csv[0]->eta();
+      jet_csvbcsv_1_ = jets_csv[0]->GetBDiscriminator(btag_label);
+      std::vector<ic::Tau *> taus = event->GetPtrVec<Tau>("taus");
+      std::vector<ic::Jet *> leadjet = { jets_csv[0] };
+      std::vector<std::pair<ic::Jet *, ic::Tau *>> matches = MatchByDR(leadjet, taus, 0.5, true, true);
+    } else {
+      jet_csvpt_1_ = -9999;
+      jet_csvEt_1_ = -9999;
+      jet_csveta_1_ = -9999;
+      jet_csvbcsv_1_ = -9999;
+    }
+    
+    if (n_jets_csv_ >= 2) {
+      jet_csvpt_2_ = jets_csv[1]->pt();
+      if(bjet_regression_) jet_csvpt_2_ = jet_csv_pairs[1].second->pt();
+      jet_csvpt_bb_ = (jets_csv[0]->vector()+jets_csv[1]->vector()).pt();
+      jet_csv_dR_ = std::fabs(ROOT::Math::VectorUtil::DeltaR(jets_csv[0]->vector(),jets_csv[1]->vector()));
+      jet_csveta_2_ = jets_csv[1]->eta();
+      jet_csvbcsv_2_ = jets_csv[1]->GetBDiscriminator(btag_label);
+      jet_csv_mjj_ = (jets_csv[0]->vector() + jets_csv[1]->vector()).M();
+      if(bjet_regression_) jet_csv_mjj_ = (jet_csv_pairs[0].second->vector() + jet_csv_pairs[1].second->vector()).M();
+      jet_csv_deta_ = fabs(jets_csv[0]->eta() - jets_csv[1]->eta());
+      jet_csv_dphi_ = std::fabs(ROOT::Math::VectorUtil::DeltaPhi(jets_csv[0]->vector(), jets_csv[1]->vector()));
+      jet_csv_dtheta_ = std::fabs((jets_csv[0]->vector().theta() -  jets_csv[1]->vector().theta()));
+      if(channel_ != channel::tpzee && channel_ != channel::tpzmm && channel_ != channel::zee && channel_ != channel::zmm) mjj_tt_= (jets_csv[0]->vector() + jets_csv[1]->vector() + ditau->vector() + mets->vector()).M();
+      if(bjet_regression_) mjj_tt_= (jet_csv_pairs[0].second->vector() + jet_csv_pairs[1].second->vector() + ditau->vector() + mets->vector()).M();
+      if (event->Exists("svfitHiggs")) {
+        mjj_h_= (jets_csv[0]->vector() + jets_csv[1]->vector() + event->Get<Candidate>("svfitHiggs").vector() ).M();
+        if(bjet_regression_) mjj_h_= (jet_csv_pairs[0].second->vector() + jet_csv_pairs[1].second->vector() + event->Get<Candidate>("svfitHiggs").vector() ).M();
+      } else {
+        mjj_h_ = -9999;
+      }
+      if(kinfit_mode_>0) {
+        std::vector<Int_t> hypo_mh1;
+        hypo_mh1.push_back(125);
+        //Option to additionally run results from Zh and hZ hypotheses
+        if(kinfit_mode_ == 2) hypo_mh1.push_back(90);
+        std::vector<Int_t> hypo_mh2;
+        hypo_mh2.push_back(125);
+        if(kinfit_mode_ == 2) hypo_mh2.push_back(90);
+
+        TLorentzVector b1      = TLorentzVector(jets_csv[0]->vector().px(),jets_csv[0]->vector().py(),jets_csv[0]->vector().pz(), jets_csv[0]->vector().E());
+        if(bjet_regression_) b1 = TLorentzVector(jet_csv_pairs[0].second->vector().px(),jet_csv_pairs[0].second->vector().py(),jet_csv_pairs[0].second->vector().pz(),jet_csv_pairs[0].second->vector().E());
+        TLorentzVector b2      = TLorentzVector(jets_csv[1]->vector().px(),jets_csv[1]->vector().py(),jets_csv[1]->vector().pz(), jets_csv[1]->vector().E());
+        if(bjet_regression_) b2 = TLorentzVector(jet_csv_pairs[1].second->vector().px(),jet_csv_pairs[1].second->vector().py(),jet_csv_pairs[1].second->vector().pz(),jet_csv_pairs[1].second->vector().E());
+        TLorentzVector tau1vis      = TLorentzVector(lep1->vector().px(),lep1->vector().py(),lep1->vector().pz(), lep1->vector().E());
+        TLorentzVector tau2vis      = TLorentzVector(lep2->vector().px(),lep2->vector().py(),lep2->vector().pz(), lep2->vector().E());
+        TLorentzVector ptmiss  = TLorentzVector(mets->vector().px(),mets->vector().py(),0,mets->vector().pt());
+        TLorentzVector higgs;
+        if (event->Exists("svfitHiggs")) {
+          higgs = TLorentzVector(event->Get<Candidate>("svfitHiggs").vector().px(),event->Get<Candidate>("svfitHiggs").vector().py(),event->Get<Candidate>("svfitHiggs").vector().pz(),event->Get<Candidate>("svfitHiggs").vector().E());
+        }
+        TMatrixD metcov(2,2);
+        metcov(0,0)=mets->xx_sig();
+        metcov(1,0)=mets->yx_sig();
+        metcov(0,1)=mets->xy_sig();
+        metcov(1,1)=mets->yy_sig();
+            
+        //Default version of fitting using visible products plus met
+        HHKinFitMaster kinFits = HHKinFitMaster(&b1,&b2,&tau1vis,&tau2vis);
+        kinFits.setAdvancedBalance(&ptmiss,metcov);
+        kinFits.addMh1Hypothesis(hypo_mh1);
+        kinFits.addMh2Hypothesis(hypo_mh2);
+        kinFits.doFullFit();
+        //Best hypothesis saved. For kinfit_mode_==1 this is identical to m_H_hh (provided the cuts pull_balance_hh > 0 && convergence_hh>0 are applied)
+        //since only that hypothesis is run
+        m_H_best_ = kinFits.getBestMHFullFit();
+        m_H_chi2_best_ = kinFits.getBestChi2FullFit();
+        std::pair<Int_t,Int_t> bestHypo = kinFits.getBestHypoFullFit();
+        std::map<std::pair<Int_t,Int_t>,Double_t> fit_results_chi2 = kinFits.getChi2FullFit();
+        std::map<std::pair<Int_t,Int_t>,Double_t> fit_results_mH = kinFits.getMHFullFit();
+        std::map<std::pair<Int_t,Int_t>,Double_t> fit_results_pull_balance = kinFits.getPullBalanceFullFit();
+        std::map<std::pair<Int_t,Int_t>,Int_t> fit_convergence = kinFits.getConvergenceFullFit();
+        std::pair<Int_t,Int_t> hypoZh(90,125);
+        std::pair<Int_t,Int_t> hypohZ(125,90);
+        std::pair<Int_t,Int_t> hypohh(125,125);
+        //Save results for 125,125 hypothesis
+        m_H_hh_ = fit_results_mH.at(hypohh);
+        m_H_hh_chi2_ = fit_results_chi2.at(hypohh);
+        pull_balance_hh_ = fit_results_pull_balance.at(hypohh);
+        convergence_hh_ = fit_convergence.at(hypohh);
+        
+        //This variable is filled with mttbb if the event fails convergence
+        m_H_hh_all_ = m_H_hh_;
+        if(convergence_hh_ == -2) m_H_hh_all_ = mjj_tt_;
+        
+        if(bestHypo.first>0){
+          pull_balance_H_best_ = fit_results_pull_balance.at(bestHypo);
+          convergence_H_best_ = fit_convergence.at(bestHypo);
+        } else {
+          pull_balance_H_best_ = -9999;
+          convergence_H_best_ = -9999;
+        }
+
+        if(kinfit_mode_==3) {
+          HHDiJetKinFitMaster DiJetKinFits = HHDiJetKinFitMaster(&b1,&b2);
+          DiJetKinFits.addMhHypothesis(125.0);
+          DiJetKinFits.doFullFit();
+          m_bb_ = (DiJetKinFits.getFitJet1() + DiJetKinFits.getFitJet2()).M();
+          //m_bb_chi2_ = DiJetKinFits.GetChi2();
+          //pull_balance_bb_ = fit_results_pull_balance.at(125.0);
+          //convergence_bb_ = DiJetKinFits.GetConvergence();
+          if (event->Exists("svfitHiggs")) {
+            mbb_h_= (DiJetKinFits.getFitJet1() + DiJetKinFits.getFitJet2() + higgs ).M();
+          } else {
+            mbb_h_ = -9999;  
+          }
+        } else { 
+          m_bb_ = -9999;  
+          m_bb_chi2_ = -9999;  
+          pull_balance_bb_ = -9999;  
+          convergence_bb_ = -9999; 
+          mbb_h_ = -9999;
+        }
+        
+        //Option to additionally save results from Zh and hZ hypotheses if they have been run
+        if(kinfit_mode_ == 2) {
+          m_H_Zh_ = fit_results_mH.at(hypoZh);
+          m_H_Zh_chi2_ = fit_results_chi2.at(hypoZh);
+          pull_balance_Zh_ = fit_results_pull_balance.at(hypoZh);
+          convergence_Zh_ = fit_convergence.at(hypoZh);
+          m_H_hZ_ = fit_results_mH.at(hypohZ);
+          m_H_hZ_chi2_ = fit_results_chi2.at(hypohZ);
+          pull_balance_hZ_ = fit_results_pull_balance.at(hypohZ);
+          convergence_hZ_ = fit_convergence.at(hypohZ);
+        } else {
+          m_H_Zh_ = -9999;
+          m_H_Zh_chi2_ = -9999;
+          pull_balance_Zh_ = -9999;
+          convergence_Zh_ = -9999;
+          m_H_hZ_ = -9999;
+          m_H_hZ_chi2_ = -9999;
+          pull_balance_hZ_ = -9999;
+          convergence_hZ_ = -9999;
+        }
+      } else {
+        pull_balance_H_best_=-9999;
+        convergence_H_best_=-9999;
+        m_H_best_ = -9999;
+        m_H_chi2_best_=-9999;
+        pull_balance_Zh_=-9999;
+        convergence_Zh_=-9999;
+        m_H_Zh_ = -9999;
+        m_H_Zh_chi2_=-9999;
+        pull_balance_hZ_=-9999;
+        convergence_hZ_=-9999;
+        m_H_hZ_ = -9999;
+        m_H_hZ_chi2_ = -9999;
+        pull_balance_hh_=-9999;
+        convergence_hh_=-9999;
+        m_H_hh_ = -9999;
+        m_H_hh_all_ = -9999;
+        m_H_hh_chi2_ = -9999;
+        m_bb_ = -9999;  
+        m_bb_chi2_ = -9999;  
+        pull_balance_bb_ = -9999;  
+        convergence_bb_ = -9999; 
+        mbb_h_ = -9999;
+      }      
+    } else {
+      jet_csvpt_2_ = -9999;
+      jet_csvpt_bb_ = -9999;
+      jet_csv_dR_ = -9999;
+      jet_csveta_2_ = -9999;
+      jet_csvbcsv_2_ = -9999;
+      jet_csv_mjj_ = -9999;
+      jet_csv_deta_ = -9999;
+      jet_csv_dphi_ = -9999;
+      jet_csv_dtheta_ = -9999;
+      mjj_h_ = -9999;
+      mjj_tt_ = -9999;
+      m_H_best_ = -9999;
+      m_H_chi2_best_=-9999;
+      pull_balance_H_best_ = -9999;
+      convergence_H_best_ = -9999;
+      m_H_Zh_=-9999;
+      m_H_Zh_chi2_=-9999;
+      pull_balance_Zh_=-9999;
+      convergence_Zh_=-9999;
+      m_H_hZ_ = -9999;
+      m_H_hZ_chi2_ = -9999;
+      pull_balance_hZ_=-9999;
+      convergence_hZ_=-9999;
+      m_H_hh_ = -9999;
+      m_H_hh_all_ = -9999;
+      m_H_hh_chi2_ = -9999;
+      pull_balance_hh_=-9999;
+      convergence_hh_=-9999;
+      m_bb_ = -9999;  
+      m_bb_chi2_ = -9999;  
+      pull_balance_bb_ = -9999;  
+      convergence_bb_ = -9999; 
+      mbb_h_ = -9999;
+    }
+  }
+}
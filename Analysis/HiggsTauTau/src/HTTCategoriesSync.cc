@@ -0,0 +1,428 @@
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTCategories.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+
+namespace ic {
+
+  void HTTCategories::BookSync() {
+    //Due to the possibility of other groups requesting different branch names/branch contents
+    //we have to make an alternative (albeit very similar) TTree for the sync ntuple. 
+    lOFile = new TFile(sync_output_name_.c_str(), "RECREATE");
+    lOFile->cd();
+    // Tree should be named "TauCheck" to aid scripts which
+    // make comparisons between sync trees
+    synctree_ = new TTree("TauCheck", "TauCheck");
+
+    // The sync tree is filled for all events passing the di-lepton
+    // selections in each channel. This includes vertex selection,
+    // trigger, ID, isolation, di-lepton and extra lepton vetoes.
+    // Topological (e.g. mT) and opposite-charge requirements are
+    // not applied.
+
+    // Note: not all of the following variables were in the original
+    // list of sync tree variables, and not all are necessary/used in
+    // the legacy htt anaylsis
+
+    // Lepton properties are numbered as follows for each channel:
+    // electron     (1)  + tau        (2)
+    // muon         (1)  + tau        (2)
+    // electron     (1)  + muon       (2)
+    // high pT tau  (1)  + low pT tau (2)
+
+    // Run
+    synctree_->Branch("run", &run_, "run/I");
+    // Lumi
+    synctree_->Branch("lumi", &lumi_, "lumi/I");
+    // Event
+    synctree_->Branch("evt", &event_, "event/l");
+
+    // Number of primary vertices passing good vertex selection
+    synctree_->Branch("npv", &n_vtx_, "n_vtx/I");
+    // Number of in-time pileup interactions (used for pileup reweighting)
+    synctree_->Branch("npu", &n_pu_, "n_pu/F");
+    // The rho used for jet energy corrections
+    synctree_->Branch("rho", &rho_, "rho/F");
+
+    // The lumi scaling factor for mc * additional weights
+    // (not filled in IC trees!)
+    /*synctree_->Branch("mcweight", &mc_weight_, "mc_weight/F");*/
+    // Pileup weight
+    synctree_->Branch("puweight", &pu_weight_, "pu_weight/F");
+
+    // Tag-and-probe weights for leptons
+    // Total trigger weight for lepton 1
+   synctree_->Branch("trigweight_1", &trigweight_1_, "trigweight_1/F");
+    // Total trigger weight for lepton 2
+    synctree_->Branch("trigweight_2", &trigweight_2_, "trigweight_2/F");
+    // Total ID weight for lepton 1
+    synctree_->Branch("idisoweight_1", &idisoweight_1_, "idisoweight_1/F");
+    // Total ID weight for lepton 2
+    synctree_->Branch("idisoweight_2", &idisoweight_2_, "idisoweight_2/F");
+    // Tracking efficiency weightfor lepton 1
+    synctree_->Branch("trackingweight_1", &trackingweight_1_, "trackingweight_1/F");
+    // Tracking efficiency weight for lepton 2
+    synctree_->Branch("trackingweight_2", &trackingweight_2_, "trackingweight_2/F");
+    // Total iso weight for lepton 1
+//      synctree_->Branch("isoweight_1", &isoweight_1_, "isoweight_1/F");
+    // Total iso weight for lepton 2
+ //     synctree_->Branch("isoweight_2", &isoweight_2_, "isoweight_2/F");
+   // Product of all trigger, ID and iso weights
+    synctree_->Branch("effweight", &effweight_, "effweight/F");
+    // Jet->tau fake rate weight (pT-dependent)
+//    synctree_->Branch("fakeweight", &fakeweight_, "fakeweight/F");
+    // Product of all embedded weights, but only for rechit samples
+ //     synctree_->Branch("embeddedWeight", &embeddedweight_, "embeddedweight/F");
+    // Higgs pt weights (for ggh samples)
+//      synctree_->Branch("signalWeight", &signalweight_, "signalweight/F");
+    // Total combined event weight (excluding lumi weighting)
+    // NB: may contain weights not included in the above
+    synctree_->Branch("weight", &wt_.var_float, "wt/F");
+
+
+    // Visible di-tau mass
+    synctree_->Branch("m_vis", &m_vis_.var_float, "m_vis/F");
+    // SVFit di-tau transverse mass
+    synctree_->Branch("mt_sv", &mt_sv_.var_float, "mt_sv/F");
+    // SVFit di-tau mass
+    synctree_->Branch("m_sv", &m_sv_.var_float, "m_sv/F");
+    // SVFit di-tau pt (only for Markov-Chain SVFit)
+    synctree_->Branch("pt_sv", &pt_h_.var_float, "pt_h/F");
+    // SVFit di-tau eta (only for Markov-Chain SVFit)
+    synctree_->Branch("eta_sv", &eta_h_, "eta_h/F");
+    // SVFit di-tau phi (only for Markov-Chain SVFit)
+    synctree_->Branch("phi_sv", &phi_h_, "phi_h/F");
+
+    // Lepton 1 properties
+    if (strategy_ == strategy::cpsummer17 && (channel_ == channel::et || channel_ == channel::em)) { 
+      synctree_->Branch("eCorr_1",           &E_1_);
+    }
+    // pt (including effect of any energy scale corrections)
+    synctree_->Branch("pt_1", &pt_1_.var_float, "pt_1/F");
+    // phi
+    synctree_->Branch("phi_1", &phi_1_.var_float, "phi_1/F");
+    // eta
+    synctree_->Branch("eta_1", &eta_1_.var_float, "eta_1/F");
+    // mass
+    synctree_->Branch("m_1", &m_1_, "m_1/F");
+    // charge
+    synctree_->Branch("q_1", &q_1_, "q_1/I");
+    // delta-beta corrected isolation (relative or absolute as appropriate)
+    // If lepton 1 is a tau, this is the value of byIsolationMVAraw,
+    // which is no longer used in the analysis, but retained for legacy
+    // reasons
+    synctree_->Branch("iso_1", &iso_1_.var_float, "iso_1/F");
+    // If an electron, the output of the ID MVA, zero otherwise
+    synctree_->Branch("mva_1", &mva_1_.var_float, "mva_1/F");
+    // Transverse (x-y) impact parameter w.r.t to the primary vertex
+    synctree_->Branch("d0_1", &d0_1_.var_float, "d0_1/F");
+    // Longitudinal (z) impact parameter w.r.t to the primary vertex
+    synctree_->Branch("dZ_1", &dz_1_.var_float, "dz_1/F");
+    // Whether lepton passes ID selection (always true in IC ntuples)
+//      synctree_->Branch("passid_1", &lPassId1, "lPassId1/B");
+    // Whether lepton passes iso selection (always true in IC ntuples)
+//      synctree_->Branch("passiso_1", &lPassIso1, "lPassIso1/B");
+    // Transverse mass of lepton 1 and MVA MET
+    synctree_->Branch("mt_1", &mt_1_.var_float, "mt_1/F");
+    synctree_->Branch("pfmt_1", &pfmt_1_.var_float, "pfmt_1/F");
+    synctree_->Branch("puppimt_1", &puppimt_1_.var_float, "puppimt_1/F");
+    // Non-triggering electron ID MVA score
+
+    synctree_->Branch("tau_decay_mode_2",    &tau_decay_mode_2_, "tau_decay_mode_2/I");
+    synctree_->Branch("tau_decay_mode_1",    &tau_decay_mode_1_,"tau_decay_mode_1/I");
+
+    synctree_->Branch("mva_olddm_medium_1",&lbyMediumIsolationMVArun2DBoldDMwLT_1,"mva_olddm_medium_1/O");
+    synctree_->Branch("mva_olddm_medium_2",&lbyMediumIsolationMVArun2DBoldDMwLT_2,"mva_olddm_medium_2/O");
+    synctree_->Branch("mva_olddm_tight_1",&lbyTightIsolationMVArun2DBoldDMwLT_1,"mva_olddm_tight_1/O");
+    synctree_->Branch("mva_olddm_tight_2",&lbyTightIsolationMVArun2DBoldDMwLT_2,"mva_olddm_tight_2/O");
+    synctree_->Branch("mva_olddm_vtight_1",&lbyVTightIsolationMVArun2DBoldDMwLT_1,"mva_olddm_tight_1/O");
+    synctree_->Branch("mva_olddm_vtight_2",&lbyVTightIsolationMVArun2DBoldDMwLT_2,"mva_olddm_tight_2/O");
+
+    // Lepton 2 properties
+    // pt (including effect of any energy scale corrections)
+    synctree_->Branch("pt_2", &pt_2_.var_float, "pt_2/F");
+    // phi
+    synctree_->Branch("phi_2", &phi_2_.var_float, "phi_2/F");
+    // eta
+    synctree_->Branch("eta_2", &eta_2_.var_float, "eta_2/F");
+    // mass
+    synctree_->Branch("m_2", &m_2_.var_float, "lM2/F");
+    // charge
+    synctree_->Branch("q_2", &q_2_, "lq2/I");
+    // delta-beta corrected isolation (relative or absolute as appropriate)
+    // If lepton 2 is a tau, this is the value of byIsolationMVAraw,
+    // which is no longer used in the analysis, but retained for legacy
+    // reasons
+    synctree_->Branch("iso_2", &iso_2_.var_float, "iso_2/F");
+    // Transverse (x-y) impact parameter w.r.t to the primary vertex
+    synctree_->Branch("d0_2", &d0_2_.var_float, "d0_2/F");
+    // Longitudinal (z) impact parameter w.r.t to the primary vertex
+    synctree_->Branch("dZ_2", &dz_2_.var_float, "dz_2/F");
+    // If an electron, the output of the ID MVA, zero otherwise
+    synctree_->Branch("mva_2", &mva_2_.var_float, "mva_2/F");
+    // Whether lepton passes ID selection (always true in IC ntuples)
+//      synctree_->Branch("passid_2", &lPassId2, "lPassId2/B");
+    // Whether lepton passes iso selection (always true in IC ntuples)
+//      synctree_->Branch("passiso_2", &lPassIso2, "lPassIso2/B");
+    // Transverse mass of lepton 2 and MVA MET
+    synctree_->Branch("mt_2", &mt_2_.var_float, "mt_2/F");
+
+    // Whether event is os or ss
+    synctree_->Branch("os", &os_, "os/O");
+    // Whether event passes lepton vetos. TRUE = event is vetoed.  
+    synctree_->Branch("dilepton_veto", &dilepton_veto_, "dilepton_veto/O");
+    synctree_->Branch("extraelec_veto", &extraelec_veto_, "extraelec_veto/O");
+    synctree_->Branch("extramuon_veto", &extramuon_veto_, "extramuon_veto/O");
+    synctree_->Branch("gen_match_1", &gen_match_1_, "gen_match_1/i");
+    synctree_->Branch("gen_match_2", &gen_match_2_,"gen_match_2/i");
+
+    // Variables defined when lepton 2 is a tau
+    // raw value of the 3hits delta-beta isolation
+    
+    if(strategy_ == strategy::paper2013) {
+        synctree_->Branch("byCombinedIsolationDeltaBetaCorrRaw3Hits_2", &l3Hits_2,
+                       "byCombinedIsolationDeltaBetaCorrRaw3Hits_2/F");
+        // raw value of the anti-electron MVA3 output
+        synctree_->Branch("againstElectronMVA3raw_2", &lagainstElectronMVA3raw_2,
+                       "againstElectronMVA3raw_2/F");
+        // raw value of the MVA2 isolation
+        synctree_->Branch("byIsolationMVA2raw_2", &lbyIsolationMVA2raw_2,
+                       "byIsolationMVA2raw_2/F");
+        // output of againstMuonLoose2
+        synctree_->Branch("againstMuonLoose2_2", &lagainstMuonLoose2_2,
+                       "againstMuonLoose2_2/F");
+        // output of againstMuonMedium2
+        synctree_->Branch("againstMuonMedium2_2", &lagainstMuonMedium2_2,
+                       "againstMuonMedium2_2/F");
+        // output of againstMuonTight2
+        synctree_->Branch("againstMuonTight2_2", &lagainstMuonTight2_2,
+                   "againstMuonTight2_2/F");
+    }
+    if(strategy_ == strategy::phys14 || strategy_==strategy::spring15) {
+        synctree_->Branch("byCombinedIsolationDeltaBetaCorrRaw3Hits_1", &l3Hits_1,
+                       "byCombinedIsolationDeltaBetaCorrRaw3Hits_1/F");
+        synctree_->Branch("byIsolationMVA3newDMwoLTraw_1", &lbyIsolationMVA3newDMwoLTraw_1,"byIsolationMVA3newDMwoLTraw_1/F");
+        synctree_->Branch("byIsolationMVA3oldDMwoLTraw_1", &lbyIsolationMVA3oldDMwoLTraw_1,"byIsolationMVA3oldDMwoLTraw_1/F");
+        synctree_->Branch("byIsolationMVA3newDMwLTraw_1", &lbyIsolationMVA3newDMwLTraw_1,"byIsolationMVA3newDMwLTraw_1/F");
+        synctree_->Branch("byIsolationMVA3oldDMwLTraw_1", &lbyIsolationMVA3oldDMwLTraw_1,"byIsolationMVA3oldDMwLTraw_1/F");
+        synctree_->Branch("againstElectronLooseMVA5_1", &lagainstElectronLooseMVA_1, "againstElectronLooseMVA5_1/F");
+        synctree_->Branch("againstElectronMediumMVA5_1", &lagainstElectronMediumMVA_1, "againstElectronMediumMVA5_1/F");
+        synctree_->Branch("againstElectronTightMVA5_1", &lagainstElectronTightMVA_1, "againstElectronTightMVA5_1/F");
+        synctree_->Branch("againstElectronVLooseMVA5_1", &lagainstElectronVLooseMVA_1, "againstElectronVLooseMVA5_1/F");
+        synctree_->Branch("againstElectronVTightMVA5_1", &lagainstElectronVTightMVA_1, "againstElectronVTightMVA5_1/F");
+        synctree_->Branch("againstMuonLoose3_1", &lagainstMuonLoose3_1, "againstMuonLoose3_1/F");
+        synctree_->Branch("againstMuonTight3_1", &lagainstMuonTight3_1, "againstMuonTight3_1/F");
+        synctree_->Branch("chargedIsoPtSum_1", &lchargedIsoPtSum_1,"chargedIsoPtSum_1/F");
+        synctree_->Branch("neutralIsoPtSum_1", &lneutralIsoPtSum_1,"neutralIsoPtSum_1/F");
+        synctree_->Branch("puCorrPtSum_1", &lpuCorrPtSum_1,"puCorrPtSum_1/F");
+        synctree_->Branch("decayModeFindingOldDMs_1",&ldecayModeFindingOldDMs_1,"decayModeFindingOldDMs_1/O");
+        synctree_->Branch("byCombinedIsolationDeltaBetaCorrRaw3Hits_2", &l3Hits_2,
+                       "byCombinedIsolationDeltaBetaCorrRaw3Hits_2/F");
+        synctree_->Branch("byIsolationMVA3newDMwoLTraw_2", &lbyIsolationMVA3newDMwoLTraw_2,"byIsolationMVA3newDMwoLTraw_2/F");
+        synctree_->Branch("byIsolationMVA3oldDMwoLTraw_2", &lbyIsolationMVA3oldDMwoLTraw_2,"byIsolationMVA3oldDMwoLTraw_2/F");
+        synctree_->Branch("byIsolationMVA3newDMwLTraw_2", &lbyIsolationMVA3newDMwLTraw_2,"byIsolationMVA3newDMwLTraw_2/F");
+        synctree_->Branch("byIsolationMVA3oldDMwLTraw_2", &lbyIsolationMVA3oldDMwLTraw_2,"byIsolationMVA3oldDMwLTraw_2/F");
+        synctree_->Branch("againstElectronLooseMVA5_1", &lagainstElectronLooseMVA_1, "againstElectronLooseMVA5_1/F");
+        synctree_->Branch("againstElectronLooseMVA5_2", &lagainstElectronLooseMVA_2, "againstElectronLooseMVA5_2/F");
+        synctree_->Branch("againstElectronMediumMVA5_2", &lagainstElectronMediumMVA_2, "againstElectronMediumMVA5_2/F");
+        synctree_->Branch("againstElectronTightMVA5_2", &lagainstElectronTightMVA_2, "againstElectronTightMVA5_2/F");
+        synctree_->Branch("againstElectronVLooseMVA5_2", &lagainstElectronVLooseMVA_2, "againstElectronVLooseMVA5_2/F");
+        synctree_->Branch("againstElectronVTightMVA5_2", &lagainstElectronVTightMVA_2, "againstElectronVTightMVA5_2/F");
+        synctree_->Branch("againstMuonLoose3_2", &lagainstMuonLoose3_2, "againstMuonLoose3_2/F");
+        synctree_->Branch("againstMuonTight3_2", &lagainstMuonTight3_2, "againstMuonTight3_2/F");
+        synctree_->Branch("chargedIsoPtSum_2", &lchargedIsoPtSum_2,"chargedIsoPtSum_2/F");
+        synctree_->Branch("neutralIsoPtSum_2", &lneutralIsoPtSum_2,"neutralIsoPtSum_2/F");
+        synctree_->Branch("puCorrPtSum_2", &lpuCorrPtSum_2,"puCorrPtSum_2/F");
+        synctree_->Branch("decayModeFindingOldDMs_2",&ldecayModeFindingOldDMs_2,"decayModeFindingOldDMs_2/O");
+
+    }
+    if(strategy_ == strategy::fall15||strategy_ == strategy::mssmspring16 ||strategy_ == strategy::smspring16 || strategy_ == strategy::mssmsummer16 || strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16 || strategy_ == strategy::cpsummer17) {
+        synctree_->Branch("byCombinedIsolationDeltaBetaCorrRaw3Hits_1", &l3Hits_1,
+                       "byCombinedIsolationDeltaBetaCorrRaw3Hits_1/F");
+        synctree_->Branch("byIsolationMVA3newDMwoLTraw_1", &lbyIsolationMVA3newDMwoLTraw_1,"byIsolationMVA3newDMwoLTraw_1/F");
+        synctree_->Branch("byIsolationMVA3oldDMwoLTraw_1", &lbyIsolationMVA3oldDMwoLTraw_1,"byIsolationMVA3oldDMwoLTraw_1/F");
+        synctree_->Branch("byIsolationMVA3newDMwLTraw_1", &lbyIsolationMVA3newDMwLTraw_1,"byIsolationMVA3newDMwLTraw_1/F");
+        synctree_->Branch("againstElectronLooseMVA6_1", &lagainstElectronLooseMVA_1, "againstElectronLooseMVA6_1/F");
+        synctree_->Branch("againstElectronMediumMVA6_1", &lagainstElectronMediumMVA_1, "againstElectronMediumMVA6_1/F");
+        synctree_->Branch("againstElectronTightMVA6_1", &lagainstElectronTightMVA_1, "againstElectronTightMVA6_1/F");
+        synctree_->Branch("againstElectronVLooseMVA6_1", &lagainstElectronVLooseMVA_1, "againstElectronVLooseMVA6_1/F");
+        synctree_->Branch("againstElectronVTightMVA6_1", &lagainstElectronVTightMVA_1, "againstElectronVTightMVA6_1/F");
+        synctree_->Branch("againstMuonLoose3_1", &lagainstMuonLoose3_1, "againstMuonLoose3_1/F");
+        synctree_->Branch("againstMuonTight3_1", &lagainstMuonTight3_1, "againstMuonTight3_1/F");
+        synctree_->Branch("chargedIsoPtSum_1", &lchargedIsoPtSum_1,"chargedIsoPtSum_1/F");
+        synctree_->Branch("neutralIsoPtSum_1", &lneutralIsoPtSum_1,"neutralIsoPtSum_1/F");
+        synctree_->Branch("puCorrPtSum_1", &lpuCorrPtSum_1,"puCorrPtSum_1/F");
+        synctree_->Branch("decayModeFindingOldDMs_1",&ldecayModeFindingOldDMs_1,"decayModeFindingOldDMs_1/O");
+        synctree_->Branch("byCombinedIsolationDeltaBetaCorrRaw3Hits_2", &l3Hits_2,
+                       "byCombinedIsolationDeltaBetaCorrRaw3Hits_2/F");
+        synctree_->Branch("byIsolationMVA3newDMwoLTraw_2", &lbyIsolationMVA3newDMwoLTraw_2,"byIsolationMVA3newDMwoLTraw_2/F");
+        synctree_->Branch("byIsolationMVA3oldDMwoLTraw_2", &lbyIsolationMVA3oldDMwoLTraw_2,"byIsolationMVA3oldDMwoLTraw_2/F");
+        
+        if(strategy_==strategy::cpsummer17){
+          if(channel_==channel::tt) synctree_->Branch("byIsolationMVA3oldDMwLTraw_1", &iso_1_);  
+          synctree_->Branch("byIsolationMVA3oldDMwLTraw_2", &iso_2_);
+        } else {
+          synctree_->Branch("byIsolationMVA3oldDMwLTraw_1", &lbyIsolationMVA3oldDMwLTraw_1,"byIsolationMVA3oldDMwLTraw_1/F");
+          synctree_->Branch("byIsolationMVA3oldDMwLTraw_2", &lbyIsolationMVA3oldDMwLTraw_2,"byIsolationMVA3oldDMwLTraw_2/F");
+        }
+        synctree_->Branch("byIsolationMVA3newDMwLTraw_2", &lbyIsolationMVA3newDMwLTraw_2,"byIsolationMVA3newDMwLTraw_2/F");
+        synctree_->Branch("againstElectronLooseMVA6_1", &lagainstElectronLooseMVA_1, "againstElectronLooseMVA6_1/F");
+        synctree_->Branch("againstElectronLooseMVA6_2", &lagainstElectronLooseMVA_2, "againstElectronLooseMVA6_2/F");
+        synctree_->Branch("againstElectronMediumMVA6_2", &lagainstElectronMediumMVA_2, "againstElectronMediumMVA6_2/F");
+        synctree_->Branch("againstElectronTightMVA6_2", &lagainstElectronTightMVA_2, "againstElectronTightMVA6_2/F");
+        synctree_->Branch("againstElectronVLooseMVA6_2", &lagainstElectronVLooseMVA_2, "againstElectronVLooseMVA6_2/F");
+        synctree_->Branch("againstElectronVTightMVA6_2", &lagainstElectronVTightMVA_2, "againstElectronVTightMVA6_2/F");
+        synctree_->Branch("againstMuonLoose3_2", &lagainstMuonLoose3_2, "againstMuonLoose3_2/F");
+        synctree_->Branch("againstMuonTight3_2", &lagainstMuonTight3_2, "againstMuonTight3_2/F");
+        synctree_->Branch("chargedIsoPtSum_2", &lchargedIsoPtSum_2,"chargedIsoPtSum_2/F");
+        synctree_->Branch("neutralIsoPtSum_2", &lneutralIsoPtSum_2,"neutralIsoPtSum_2/F");
+        synctree_->Branch("puCorrPtSum_2", &lpuCorrPtSum_2,"puCorrPtSum_2/F");
+        synctree_->Branch("decayModeFindingOldDMs_2",&ldecayModeFindingOldDMs_2,"decayModeFindingOldDMs_2/O");
+
+    }
+    synctree_->Branch("met", &met_.var_float, "met/F");
+    synctree_->Branch("metphi", &met_phi_.var_float, "met_phi/F");
+    synctree_->Branch("uncorrmet", &uncorrmet_.var_float, "met/F");
+    synctree_->Branch("uncorrmetphi", &uncorrmet_phi_.var_float, "met_phi/F");
+    // Elements of the PF MET covariance matrix (not used in analysis)
+    synctree_->Branch("metcov00", &metCov00_, "metCov00/F");
+    synctree_->Branch("metcov01", &metCov01_, "metCov01/F");
+    synctree_->Branch("metcov10", &metCov10_, "metCov10/F");
+    synctree_->Branch("metcov11", &metCov11_, "metCov11/F");
+    //Puppi Met
+    synctree_->Branch("puppimet",&puppimet_.var_float, "puppimet/F");
+    synctree_->Branch("puppimetphi", &puppimet_phi_,"puppimet_phi/F");
+    //Gen/vis px/py for recoil corrections:
+    synctree_->Branch("genpX", &gen_px_, "genpX/F");
+    synctree_->Branch("genpY", &gen_py_, "genpY/F");
+    synctree_->Branch("vispX", &vis_px_, "vispX/F");
+    synctree_->Branch("vispY", &vis_py_, "vispY/F");
+
+    // pt of the di-tau + MET system
+    synctree_->Branch("pt_tt", &pt_tt_.var_float, "pt_tt/F");
+    //mt total
+    synctree_->Branch("mt_tot", &mt_tot_.var_float, "mt_tot/F");
+
+    // Visible pzeta
+    synctree_->Branch("pzetavis", &pzetavis_.var_float, "pzetavis/F");
+    // MET pzeta
+    synctree_->Branch("pzetamiss", &pzetamiss_.var_float, "pzetamiss/F");
+    // PF met pzeta
+    synctree_->Branch("pfpzetamiss",&pfpzetamiss_.var_float,"pfpzetamiss/F");
+    // Puppi met pzeta
+    synctree_->Branch("puppipzetamiss",&puppipzetamiss_.var_float,"puppipzetamiss/F");
+    // ttbar-rejection MVA output (emu channel only)
+    synctree_->Branch("mva_gf", &em_gf_mva_, "em_gf_mva/F");
+
+    // Jet properties
+    // The following properties are for the leading (1) and sub-leading (2) jets
+    // with pt > 30, |eta| < 4.7 after jet energy corrections, PF jet ID and
+    // pileup jet ID are applied. Jets overlapping with either selected lepton
+    // are not counted
+
+    // Number of jets passing above selection
+    synctree_->Branch("njets", &n_jets_, "n_jets/I");
+    // Number of jets passing above selection but with
+    // pt > 20 instead of pt > 30
+    synctree_->Branch("njetspt20", &n_lowpt_jets_, "n_lowpt_jets/I");
+
+    // Leading Jet
+    // pt
+    synctree_->Branch("jpt_1", &jpt_1_.var_float, "jpt_1/F");
+    // eta
+    synctree_->Branch("jeta_1", &jeta_1_.var_float, "jeta_1/F");
+    // phi
+    synctree_->Branch("jphi_1", &jphi_1_, "jphi_1/F");
+    // raw pt (before JEC)
+    synctree_->Branch("jrawf_1", &jrawf_1_, "jrawf_1/F");
+    // pt uncertainty relative to corrected pt (not in IC ntuples)
+//      synctree_->Branch("jptunc_1", &jptunc_1_, "jptunc_1/F");
+    // Pileup ID MVA output
+    synctree_->Branch("jmva_1", &jmva_1_, "jmva_1/F");
+    // Linear radial moment (not used in htt analysis)
+ //     synctree_->Branch("jlrm_1", &jlrm_1_, "jlrm_1/F");
+    // Charged track multiplicity (not used in htt analysis)
+//    synctree_->Branch("jctm_1", &jctm_1_, "jctm_1/I");
+
+    // Sub-leading Jet
+    // pt
+    synctree_->Branch("jpt_2", &jpt_2_.var_float, "jpt_2/F");
+    // eta
+    synctree_->Branch("jeta_2", &jeta_2_.var_float, "jeta_2/F");
+    // phi
+    synctree_->Branch("jphi_2", &jphi_2_, "jphi_2/F");
+    // raw pt (before JEC)
+    synctree_->Branch("jrawf_2", &jrawf_2_, "jrawf_2/F");
+    // pt uncertainty relative to corrected pt (not in IC ntuples)
+//      synctree_->Branch("jptunc_2", &jptunc_2_, "jptunc_2/F");
+    // Pileup ID MVA output
+    synctree_->Branch("jmva_2", &jmva_2_, "jmva_2/F");
+    // Linear radial moment (not used in htt analysis)
+//      synctree_->Branch("jlrm_2", &jlrm_2_, "jlrm_2/F");
+    // Charged track multiplicity (not used in htt analysis)
+ //     synctree_->Branch("jctm_2", &jctm_2_, "jctm_2/I");
+
+    // Di-jet properties
+    // Calculated with leading and sub-leading jets when njets >= 2
+    // di-jet mass
+    synctree_->Branch("mjj", &mjj_.var_float, "mjj/F");
+    // absolute difference in eta
+    synctree_->Branch("jdeta", &jdeta_.var_float, "jdeta/F");
+    // Delta phi
+    synctree_->Branch("jdphi", &jdphi_, "jdphi/F");
+    // number of jets (pt>30 and passing pf jet id), in pseudorapidity gap
+    // between jets
+    synctree_->Branch("njetingap", &n_jetsingap_, "n_jetsingap/I");
+    // number of jets (pt>20 and passing pf jet id) in pseudorapidity gap between jets
+    synctree_->Branch("njetingap20", &n_jetsingap20_, "n_jetsingap20/I");
+
+    // B-Tagged Jet properties
+    // The following properties are for the leading (in pt) CSV medium b-tagged
+    // jet with pt > 20, |eta| < 2.4 after jet energy corrections, PF jet ID and
+    // pileup jet ID are applied. Jets overlapping with either selected lepton
+    // are not counted NOTE in fully hadronic: CSV loose b-tagged jets!
+
+    // Number of b-tagging jets passing above selections
+    synctree_->Branch("nbtag", &n_bjets_, "n_bjets/I");
+    // pt
+    synctree_->Branch("bpt_1", &bpt_1_.var_float, "bpt_1/F");
+    // eta
+    synctree_->Branch("beta_1", &beta_1_.var_float, "beta_1/F");
+    // phi
+    synctree_->Branch("bphi_1", &bphi_1_, "bphi_1/F");
+    //pu id mva
+    synctree_->Branch("bmva_1", &bmva_1_, "bmva_1/F");
+    //bcsv value
+    synctree_->Branch("bcsv_1", &bcsv_1_.var_float, "bcsv_1/F");
+
+    synctree_->Branch("brawf_1", &brawf_1_, "brawf_1/F");
+    //pt b-jet 2
+    synctree_->Branch("bpt_2", &bpt_2_.var_float, "bpt_2/F");
+    // eta b-jet 2
+    synctree_->Branch("beta_2", &beta_2_.var_float, "beta_2/F");
+    // phi b-jet 2
+    synctree_->Branch("bphi_2", &bphi_2_, "bphi_2/F");
+    //pu id mva
+    synctree_->Branch("bmva_2", &bmva_2_, "bmva_2/F");
+    //bcsv value
+    synctree_->Branch("bcsv_2", &bcsv_2_, "bcsv_2/F");
+
+    synctree_->Branch("brawf_2", &brawf_2_, "brawf_2/F");
+    
+    synctree_->Branch("trg_singleelectron",    &trg_singleelectron_);
+    synctree_->Branch("trg_singlemuon",    &trg_singlemuon_);
+    synctree_->Branch("trg_doubletau",    &trg_doubletau_);
+    synctree_->Branch("trg_muonelectron",    &trg_muonelectron_);
+    synctree_->Branch("trg_singletau_1",    &trg_singletau_1_);
+    synctree_->Branch("trg_singletau_2",    &trg_singletau_2_);
+    synctree_->Branch("trg_mutaucross", &trg_mutaucross_);
+    synctree_->Branch("trg_etaucross", &trg_etaucross_);
+    
+    synctree_->Branch("flagMETFilter", &flagMETFilter_);
+  }
+
+  void HTTCategories::FillSync(TreeEvent *event) {
+    event->Exists("genpX") ? gen_px_ = event->Get<double>("genpX") : 0.;
+    event->Exists("genpY") ? gen_py_ = event->Get<double>("genpY") : 0.;
+    event->Exists("vispX") ? vis_px_ = event->Get<double>("vispX") : 0.;
+    event->Exists("vispY") ? vis_py_ = event->Get<double>("vispY") : 0.;
+  }
+}
@@ -5,7 +5,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Met.hh"
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/Muon.hh"
-#include "TMVA/Reader.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
 #include "Math/VectorUtil.h"
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
@@ -35,9 +35,9 @@ namespace ic {
     std::cout << boost::format(param_fmt()) % "met_label"       % met_label_;
     std::cout << boost::format(param_fmt()) % "gf_mva_file"     % gf_mva_file_;
     // std::cout << boost::format(param_fmt()) % "vbf_mva_file"    % vbf_mva_file_;
-    gf_reader_ = new TMVA::Reader("!Color:!Silent:Error");
-    // vbf_reader_ = new TMVA::Reader("!Color:!Silent:Error");
-    std::vector<TMVA::Reader *> readers = {gf_reader_};
+    gf_reader_ = new MVAReader("!Color:!Silent:Error");
+    // vbf_reader_ = new MVAReader("!Color:!Silent:Error");
+    std::vector<MVAReader *> readers = {gf_reader_};
     for (auto & r : readers) {
       r->AddVariable("pzetavis", &pzetavis_);
       r->AddVariable("pzetamiss", &pzetamiss_);
@@ -63,9 +63,9 @@ namespace ic {
 
     pzetavis_ = PZetaVis(ditau);
     pzetamiss_ = PZeta(ditau, met, 0.0);
-    dphi_ = std::fabs(ROOT::Math::VectorUtil::DeltaPhi(ditau->At(0)->vector(), ditau->At(1)->vector()));
+    dphi_ = std::fabs(ditau->LegsDeltaPhi());
     mvamet_ = met->pt();
-    mt_ll_ = MT(ditau, met);
+    mt_ll_ = ditau->MT(met);
     csv_ = -1.;
     if (jets.size() > 0) {
       double csv = jets[0]->GetBDiscriminator("combinedSecondaryVertexBJetTags");
@@ -179,7 +179,7 @@ namespace ic {
     double pt_1_ = lep1->pt();  
     double pt_2_ = lep2->pt();
     double m_vis_ = ditau->M();
-    double mt_1_ = MT(lep1, met);
+    double mt_1_ = ditau->MT(0, met);
     
     double iso_1_ = 0;
     if (channel_ == channel::et) {
@@ -215,7 +215,7 @@ namespace ic {
       if(channel_ == channel::et || channel_ == channel::mt){
         inputs[0] = pt_2_; inputs[1] = tau_decaymode_2_; inputs[2] = n_jets_; inputs[3] = m_vis_; inputs[4] = mt_1_; inputs[5] = iso_1_;    
       } else if (channel_ == channel::tt){
-        double mt_tot_ = sqrt(pow(MT(lep1, met),2) + pow(MT(lep2, met),2) + pow(MT(lep1, lep2),2));  
+        double mt_tot_ = sqrt(pow(ditau->MT(0, met),2) + pow(ditau->MT(1, met),2) + pow(ditau->LegsMT(),2));  
         tt_inputs_1[0] = pt_1_; tt_inputs_1[1] = pt_2_; tt_inputs_1[2] = tau_decaymode_1_; tt_inputs_1[3] = n_jets_; tt_inputs_1[4] = m_vis_; tt_inputs_1[5] = mt_tot_;
         tt_inputs_2[0] = pt_2_; tt_inputs_2[1] = pt_1_; tt_inputs_2[2] = tau_decaymode_2_; tt_inputs_2[3] = n_jets_; tt_inputs_2[4] = m_vis_; tt_inputs_2[5] = mt_tot_;
       }
@@ -225,31 +225,38 @@ namespace ic {
         
         // Retrieve fake factors and add to event as weights
         if(channel_ == channel::et || channel_ == channel::mt){
-          double ff_nom = fake_factors_[map_key]->value(inputs);
+          FakeFactor & ff = *fake_factors_[map_key];
+          if(do_systematics_) ff.values(inputs, ff_values_1_);
+          double ff_nom = do_systematics_ ? ff.systematicValue(ff_values_1_, "") : ff.value(inputs);
           event->Add("wt_ff_"+map_key, ff_nom);
           
           if(do_systematics_){
-            std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_w_dm0_njet0_stat_up","ff_w_dm0_njet0_stat_down","ff_w_dm0_njet1_stat_up","ff_w_dm0_njet1_stat_down","ff_w_dm1_njet0_stat_up","ff_w_dm1_njet0_stat_down","ff_w_dm1_njet1_stat_up","ff_w_dm1_njet1_stat_down","ff_tt_syst_up","ff_tt_syst_down","ff_tt_dm0_njet0_stat_up","ff_tt_dm0_njet0_stat_down","ff_tt_dm0_njet1_stat_up","ff_tt_dm0_njet1_stat_down","ff_tt_dm1_njet0_stat_up","ff_tt_dm1_njet0_stat_down" ,"ff_tt_dm1_njet1_stat_up","ff_tt_dm1_njet1_stat_down"};
+            static const std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_w_dm0_njet0_stat_up","ff_w_dm0_njet0_stat_down","ff_w_dm0_njet1_stat_up","ff_w_dm0_njet1_stat_down","ff_w_dm1_njet0_stat_up","ff_w_dm1_njet0_stat_down","ff_w_dm1_njet1_stat_up","ff_w_dm1_njet1_stat_down","ff_tt_syst_up","ff_tt_syst_down","ff_tt_dm0_njet0_stat_up","ff_tt_dm0_njet0_stat_down","ff_tt_dm0_njet1_stat_up","ff_tt_dm0_njet1_stat_down","ff_tt_dm1_njet0_stat_up","ff_tt_dm1_njet0_stat_down" ,"ff_tt_dm1_njet1_stat_up","ff_tt_dm1_njet1_stat_down"};
             for(unsigned j=0; j<systematics.size(); ++j){
               std::string syst = systematics[j];
-              double ff_syst = fake_factors_[map_key]->value(inputs,syst);
+              double ff_syst = ff.systematicValue(ff_values_1_, syst);
               std::string syst_name = "wt_"+map_key+"_"+syst;
               event->Add(syst_name, ff_syst);
             } 
           }
         } else if(channel_ == channel::tt){
-          double ff_nom_1 = fake_factors_[map_key]->value(tt_inputs_1)*0.5;
-          double ff_nom_2 = fake_factors_[map_key]->value(tt_inputs_2)*0.5;
+          FakeFactor & ff = *fake_factors_[map_key];
+          if(do_systematics_){
+            ff.values(tt_inputs_1, ff_values_1_);
+            ff.values(tt_inputs_2, ff_values_2_);
+          }
+          double ff_nom_1 = (do_systematics_ ? ff.systematicValue(ff_values_1_, "") : ff.value(tt_inputs_1))*0.5;
+          double ff_nom_2 = (do_systematics_ ? ff.systematicValue(ff_values_2_, "") : ff.value(tt_inputs_2))*0.5;
           event->Add("wt_ff_"+map_key, ff_nom_1);
           event->Add("wt_ff_"+map_key+"_2", ff_nom_2);
           
           if(do_systematics_){
-            std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_tt_syst_up","ff_tt_syst_down", "ff_w_frac_syst_up", "ff_w_frac_syst_down", "ff_tt_frac_syst_up", "ff_tt_frac_syst_down", "ff_dy_frac_syst_up", "ff_dy_frac_syst_down"};
+            static const std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_tt_syst_up","ff_tt_syst_down", "ff_w_frac_syst_up", "ff_w_frac_syst_down", "ff_tt_frac_syst_up", "ff_tt_frac_syst_down", "ff_dy_frac_syst_up", "ff_dy_frac_syst_down"};
             
             for(unsigned j=0; j<systematics.size(); ++j){
               std::string syst = systematics[j];
-              double ff_syst_1 = fake_factors_[map_key]->value(tt_inputs_1,syst)*0.5;
-              double ff_syst_2 = fake_factors_[map_key]->value(tt_inputs_2,syst)*0.5;
+              double ff_syst_1 = ff.systematicValue(ff_values_1_, syst)*0.5;
+              double ff_syst_2 = ff.systematicValue(ff_values_2_, syst)*0.5;
               std::string syst_name = "wt_"+map_key+"_"+syst;
               event->Add(syst_name+"_1", ff_syst_1);
               event->Add(syst_name+"_2", ff_syst_2);
@@ -259,7 +266,7 @@ namespace ic {
       }
     } else if(strategy_ == strategy::smsummer16 || strategy_ == strategy::cpsummer16) {
       bool os = PairOppSign(ditau);
-      double mt_1 = MT(lep1, met);
+      double mt_1 = ditau->MT(0, met);
       inputs.resize(9);
       tt_inputs_1.resize(9);
       tt_inputs_2.resize(9);
@@ -333,32 +340,39 @@ namespace ic {
       std::string map_key = "inclusive";
       // Retrieve fake factors and add to event as weights
       if(channel_ == channel::et || channel_ == channel::mt){
-        double ff_nom = fake_factors_[map_key]->value(inputs);
+        FakeFactor & ff = *fake_factors_[map_key];
+        if(do_systematics_) ff.values(inputs, ff_values_1_);
+        double ff_nom = do_systematics_ ? ff.systematicValue(ff_values_1_, "") : ff.value(inputs);
         event->Add("wt_ff_1", ff_nom);
         
         if(do_systematics_){
-          std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_w_dm0_njet0_stat_up","ff_w_dm0_njet0_stat_down","ff_w_dm0_njet1_stat_up","ff_w_dm0_njet1_stat_down","ff_w_dm1_njet0_stat_up","ff_w_dm1_njet0_stat_down","ff_w_dm1_njet1_stat_up","ff_w_dm1_njet1_stat_down","ff_tt_syst_up","ff_tt_syst_down","ff_tt_dm0_njet0_stat_up","ff_tt_dm0_njet0_stat_down","ff_tt_dm0_njet1_stat_up","ff_tt_dm0_njet1_stat_down","ff_tt_dm1_njet0_stat_up","ff_tt_dm1_njet0_stat_down" ,"ff_tt_dm1_njet1_stat_up","ff_tt_dm1_njet1_stat_down"};
+          static const std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_w_dm0_njet0_stat_up","ff_w_dm0_njet0_stat_down","ff_w_dm0_njet1_stat_up","ff_w_dm0_njet1_stat_down","ff_w_dm1_njet0_stat_up","ff_w_dm1_njet0_stat_down","ff_w_dm1_njet1_stat_up","ff_w_dm1_njet1_stat_down","ff_tt_syst_up","ff_tt_syst_down","ff_tt_dm0_njet0_stat_up","ff_tt_dm0_njet0_stat_down","ff_tt_dm0_njet1_stat_up","ff_tt_dm0_njet1_stat_down","ff_tt_dm1_njet0_stat_up","ff_tt_dm1_njet0_stat_down" ,"ff_tt_dm1_njet1_stat_up","ff_tt_dm1_njet1_stat_down"};
           for(unsigned j=0; j<systematics.size(); ++j){
             std::string syst = systematics[j];
-            double ff_syst = fake_factors_[map_key]->value(inputs,syst);
+            double ff_syst = ff.systematicValue(ff_values_1_, syst);
             std::string syst_name = "wt_"+syst+"_1";
             event->Add(syst_name, ff_syst);
 
           } 
         }
       } else if(channel_ == channel::tt){
-        double ff_nom_1 = fake_factors_[map_key]->value(tt_inputs_1)*0.5;
-        double ff_nom_2 = fake_factors_[map_key]->value(tt_inputs_2)*0.5;
+        FakeFactor & ff = *fake_factors_[map_key];
+        if(do_systematics_){
+          ff.values(tt_inputs_1, ff_values_1_);
+          ff.values(tt_inputs_2, ff_values_2_);
+        }
+        double ff_nom_1 = (do_systematics_ ? ff.systematicValue(ff_values_1_, "") : ff.value(tt_inputs_1))*0.5;
+        double ff_nom_2 = (do_systematics_ ? ff.systematicValue(ff_values_2_, "") : ff.value(tt_inputs_2))*0.5;
         event->Add("wt_ff_1",  ff_nom_1);
         event->Add("wt_ff_2",  ff_nom_2);
         
         if(do_systematics_){
-          std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_tt_syst_up","ff_tt_syst_down","ff_w_frac_syst_up", "ff_w_frac_syst_down", "ff_tt_frac_syst_up", "ff_tt_frac_syst_down", "ff_dy_frac_syst_up", "ff_dy_frac_syst_down"};
+          static const std::vector<std::string> systematics = {"ff_qcd_syst_up","ff_qcd_syst_down","ff_qcd_dm0_njet0_stat_up","ff_qcd_dm0_njet0_stat_down","ff_qcd_dm0_njet1_stat_up","ff_qcd_dm0_njet1_stat_down","ff_qcd_dm1_njet0_stat_up","ff_qcd_dm1_njet0_stat_down","ff_qcd_dm1_njet1_stat_up","ff_qcd_dm1_njet1_stat_down","ff_w_syst_up","ff_w_syst_down","ff_tt_syst_up","ff_tt_syst_down","ff_w_frac_syst_up", "ff_w_frac_syst_down", "ff_tt_frac_syst_up", "ff_tt_frac_syst_down", "ff_dy_frac_syst_up", "ff_dy_frac_syst_down"};
           
           for(unsigned j=0; j<systematics.size(); ++j){
             std::string syst = systematics[j];
-            double ff_syst_1 = fake_factors_[map_key]->value(tt_inputs_1,syst)*0.5;
-            double ff_syst_2 = fake_factors_[map_key]->value(tt_inputs_2,syst)*0.5;
+            double ff_syst_1 = ff.systematicValue(ff_values_1_, syst)*0.5;
+            double ff_syst_2 = ff.systematicValue(ff_values_2_, syst)*0.5;
 
             std::string syst_name = "wt_"+syst;
             event->Add(syst_name+"_1", ff_syst_1);
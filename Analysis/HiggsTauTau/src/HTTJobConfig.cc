@@ -0,0 +1,245 @@
+#include "HiggsTauTau/interface/HTTJobConfig.h"
+#include <iostream>
+#include "Utilities/interface/JsonTools.h"
+
+namespace ic {
+
+Json::Value HTTSequenceSchema() {
+  // Keys found in existing configs that nothing reads any more are listed
+  // under "_ignored", so they give a warning rather than an error
+  static const Json::Value schema = ExtractJsonFromString(R"({
+      "add_Hhh_variables": "bool",
+      "bfake_mode": "uint",
+      "bjet_regr_correction": "bool",
+      "btag_mode": "uint",
+      "check_recoil_tables": "bool",
+      "data_pu_file": "string",
+      "do_btag_eff": "bool",
+      "do_gen_analysis": "bool",
+      "do_iso_eff": "bool",
+      "do_leptonplustau": "bool",
+      "do_met_filters": "bool",
+      "do_mt_tagandprobe": "bool",
+      "do_pdf_wts": "bool",
+      "do_preselection": "bool",
+      "do_pu_wt": "bool",
+      "do_qcd_scale_wts": "bool",
+      "do_recoil": "bool",
+      "do_singlelepton": "bool",
+      "do_singletau": "bool",
+      "do_tau_eff": "bool",
+      "electrons": "string",
+      "era": "string",
+      "event_check_file": "string",
+      "faked_tau_selector": "uint",
+      "filter_trg": "bool",
+      "force_old_effs": "bool",
+      "genJets": "string",
+      "genTaus": "string",
+      "gen_stitching_study": "bool",
+      "get_effective": "bool",
+      "hadronic_tau_selector": "uint",
+      "is_data": "bool",
+      "is_embedded": "bool",
+      "iso_study": "bool",
+      "jets": "string",
+      "kinfit_mode": "uint",
+      "lumi_mask_only": "bool",
+      "make_sync_ntuple": "bool",
+      "mc": "string",
+      "mc_pu_file": "string",
+      "mela_folder": "string",
+      "mela_mode": "uint",
+      "met": "string",
+      "metscale_mode": "uint",
+      "moriond_tau_scale": "bool",
+      "muons": "string",
+      "mva_met_mode": "uint",
+      "new_svfit_mode": "uint",
+      "njets_mode": "uint",
+      "nvtx_weight_file": "string",
+      "optimisation_study": "bool",
+      "output_folder": "string",
+      "output_name": "string",
+      "pu_id_training": "uint",
+      "qcd_study": "bool",
+      "read_all_svfit_files": "bool",
+      "recoil_quantile_map": "bool",
+      "run_gen_info": "bool",
+      "run_trg_filter": "bool",
+      "save_output_jsons": "bool",
+      "special_mode": "uint",
+      "stitching_gen_summary": "bool",
+      "store_hltpaths": "bool",
+      "strategy": "string",
+      "svfit_folder": "string",
+      "svfit_from_grid": "bool",
+      "svfit_override": "string",
+      "tau_id_study": "bool",
+      "taus": "string",
+      "test_nlo_reweight": "bool",
+      "trg_in_mc": "bool",
+      "tt_trg_iso_mode": "uint",
+      "vh_filter_mode": "uint",
+      "variable_groups": "array",
+      "write_friend_inputs": "bool",
+      "ztautau_mode": "uint",
+      "baseline": {
+        "addit_output_folder": "string",
+        "bfake_mode": "uint",
+        "btag_mode": "uint",
+        "di_elec_veto": "bool",
+        "di_muon_veto": "bool",
+        "do_em_extras": "bool",
+        "do_faketaus": "bool",
+        "do_ff_systematics": "bool",
+        "do_ff_weights": "bool",
+        "do_reshape": "bool",
+        "e_scale_mode": "bool",
+        "efaketau_0pi_es_shift": "double",
+        "efaketau_1pi_es_shift": "double",
+        "elec_es_shift_barrel": "double",
+        "elec_es_shift_endcap": "double",
+        "extra_elec_veto": "bool",
+        "extra_muon_veto": "bool",
+        "ff_categories": "string",
+        "ff_file": "string",
+        "ff_fracs_file": "string",
+        "jec_region": "uint",
+        "jes_input_set": "string",
+        "jes_mode": "uint",
+        "lep_iso": "bool",
+        "mass_scale_mode": "bool",
+        "mass_shift": "double",
+        "max_extra_elecs": "uint",
+        "max_extra_muons": "uint",
+        "metcl_mode": "uint",
+        "metres_mode": "uint",
+        "metscale_mode": "uint",
+        "metuncl_mode": "uint",
+        "mu_scale_mode": "bool",
+        "mufaketau_0pi_es_shift": "double",
+        "mufaketau_1pi_es_shift": "double",
+        "muon_es_shift": "double",
+        "split_by_region": "bool",
+        "split_by_source": "bool",
+        "tau_1prong0pi0_es_shift": "double",
+        "tau_1prong1pi0_es_shift": "double",
+        "tau_3prong0pi0_es_shift": "double",
+        "tau_es_shift": "double",
+        "tau_scale_mode": "bool",
+        "use_deep_csv": "bool",
+        "_ignored": ["do_tau_anti_elec", "do_tau_anti_muon", "elec_es_shift",
+                     "elec_id", "njets_mode", "pair_dr", "tau_anti_elec",
+                     "tau_anti_muon", "tau_es_corr"]
+      },
+      "_ignored": ["do_ff_systematics", "do_ff_weights", "recoil_corrector",
+                   "store_trigobjpt"]
+  })");
+  return schema;
+}
+
+Json::Value HTTJobSchema() {
+  static const Json::Value schema = [] {
+    Json::Value res = ExtractJsonFromString(R"({
+      "job": {
+        "filelist": "string",
+        "file_prefix": "string",
+        "max_events": "int",
+        "timings": "bool",
+        "preselect_lumi_mask": "bool",
+        "output_threads": "uint",
+        "output_trees": {"*": {"compression_algorithm": "string",
+                               "compression_level": "uint",
+                               "basket_size": "uint",
+                               "auto_flush": "int"}},
+        "channels": "array",
+        "ignore_channels": "array",
+        "sequences": {"*": "array"},
+        "_ignored": ["output_postfix", "sample"]
+      },
+      "samples": "any"
+    })");
+    Json::Value seq = HTTSequenceSchema();
+    res["sequence"] = seq;
+    res["channels"]["*"] = seq;
+    res["sequences"]["*"] = seq;
+    return res;
+  }();
+  return schema;
+}
+
+namespace {
+  // A data or embedded sample only runs the channels its trigger stream
+  // belongs to
+  bool SkipChannel(std::string const& channel_str, std::string const& output_name,
+                   bool is_data, bool is_embedded) {
+    if(is_data &&  ( (channel_str.find("em") != channel_str.npos && output_name.find("MuonEG")==output_name.npos && channel_str.find("tpem") == channel_str.npos)|| (channel_str.find("mt") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("et") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tt") != channel_str.npos && output_name.find("Tau") == output_name.npos) || (channel_str.find("zmm") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("tpzmm") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("zee") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tpzee") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tpmt") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("tpem") != channel_str.npos && output_name.find("SingleEle")==output_name.npos ) )) return true;
+
+    if(is_embedded &&  ( (channel_str.find("em") != channel_str.npos && output_name.find("EmbeddingElMu")==output_name.npos )|| (channel_str.find("mt") != channel_str.npos && output_name.find("EmbeddingMuTau") == output_name.npos ) || (channel_str.find("et") != channel_str.npos && output_name.find("EmbeddingElTau") == output_name.npos ) || (channel_str.find("tt") != channel_str.npos && output_name.find("EmbeddingTauTau") == output_name.npos) || (channel_str.find("tpzmm") != channel_str.npos && output_name.find("EmbeddingMuMu") == output_name.npos ) ||  (channel_str.find("tpzee") != channel_str.npos && output_name.find("EmbeddingElEl") == output_name.npos ) || (channel_str.find("tpmt") != channel_str.npos && output_name.find("EmbeddingMuTau") == output_name.npos ))) return true;
+
+    return false;
+  }
+}
+
+Json::Value CompileHTTJobConfig(Json::Value const& js,
+                                std::vector<std::string>& errors,
+                                std::vector<std::string>& warnings) {
+  ValidateJson(js, HTTJobSchema(), "", errors, warnings);
+
+  Json::Value res(Json::objectValue);
+  res["job"] = js["job"];
+  Json::Value & sequences = res["sequences"];
+  sequences = Json::Value(Json::arrayValue);
+
+  std::vector<std::string> ignore_chans;
+  for(unsigned i = 0; i<js["job"]["ignore_channels"].size();++i){
+   ignore_chans.push_back(js["job"]["ignore_channels"][i].asString());
+  }
+
+  std::string output_name = js["sequence"]["output_name"].asString();
+  bool is_data = js["sequence"]["is_data"].asBool();
+  bool is_embedded = js["sequence"]["is_embedded"].asBool();
+  for (unsigned i = 0; i < js["job"]["channels"].size(); ++i) {
+    std::string channel_str = js["job"]["channels"][i].asString();
+
+    if (SkipChannel(channel_str, output_name, is_data, is_embedded)) continue;
+
+    bool ignore_channel =false;
+    bool duplicate_channel = false;
+    for(unsigned k = 0; k<ignore_chans.size();k++){
+      if(ignore_chans.at(k)==channel_str){ignore_channel=true;}
+    }
+    if(ignore_channel){
+      std::cout<<"SKIPPING CHANNEL "<<channel_str<<std::endl;
+      continue;
+    }
+    for(unsigned k=0;k<i;++k){
+      if(js["job"]["channels"][k].asString()==channel_str){duplicate_channel=true;}
+    }
+    if(duplicate_channel){
+      std::cout<<"Channel "<<channel_str<<" sequences already created, skipping"<<std::endl;
+      continue;
+    }
+    std::vector<std::string> vars;
+    for (unsigned j = 0; j < js["job"]["sequences"]["all"].size(); ++j) {
+      vars.push_back(js["job"]["sequences"]["all"][j].asString());
+    }
+    for (unsigned j = 0; j < js["job"]["sequences"][channel_str].size(); ++j) {
+      vars.push_back(js["job"]["sequences"][channel_str][j].asString());
+    }
+
+    for (unsigned j = 0; j < vars.size(); ++j) {
+      Json::Value entry(Json::objectValue);
+      entry["name"] = channel_str+"_"+vars[j];
+      entry["channel"] = channel_str;
+      Json::Value & js_merged = entry["config"];
+      js_merged = js["sequence"];
+      UpdateJson(js_merged, js["channels"][channel_str]);
+      UpdateJson(js_merged, js["sequences"][vars[j]]);
+      sequences.append(entry);
+    }
+  }
+  return res;
+}
+}
@@ -1,5 +1,6 @@
 #include "HiggsTauTau/interface/HTTMuonEfficiency.h"
 #include "Utilities/interface/FnPredicates.h"
+#include "Utilities/interface/GenGraph.h"
 #include "Utilities/interface/FnPairs.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
 #include "UserCode/ICHiggsTauTau/interface/Track.hh"
@@ -58,7 +59,7 @@ int HTTMuonEfficiency::Execute(TreeEvent* event) {
     }
 
     
-    std::vector<GenJet> gen_taus = BuildTauJets(particles, false,true);
+    std::vector<GenJet> gen_taus = GenGraph::Get(event, "genParticles").TauJets(false, true);
     std::vector<GenJet *> gen_taus_ptr;
     for (auto & x : gen_taus) gen_taus_ptr.push_back(&x);
     ic::erase_if(gen_taus_ptr, !boost::bind(MinPtMaxEta, _1, 15.0, 999.));
@@ -1,6 +1,7 @@
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTPairGenInfo.h"
 #include "UserCode/ICHiggsTauTau/interface/PFJet.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
 #include <boost/functional/hash.hpp>
 #include "boost/algorithm/string.hpp"
@@ -73,7 +74,7 @@ namespace ic {
       gen_match_undecayed_2_eta = undecayed_taus[1]->eta();
     }
     
-    std::vector<GenJet> gen_taus = BuildTauJets(particles, false,true);
+    std::vector<GenJet> gen_taus = GenGraph::Get(event, "genParticles").TauJets(false, true);
     std::vector<GenJet *> gen_taus_ptr;
     for (auto & x : gen_taus) gen_taus_ptr.push_back(&x);
     ic::erase_if(gen_taus_ptr, !boost::bind(MinPtMaxEta, _1, 15.0, 999.));
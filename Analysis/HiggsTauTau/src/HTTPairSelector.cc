@@ -1,6 +1,7 @@
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTPairSelector.h"
 #include "UserCode/ICHiggsTauTau/interface/PFJet.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
 #include <boost/functional/hash.hpp>
 #include "boost/algorithm/string.hpp"
@@ -395,8 +396,7 @@ namespace ic {
         if (faked_tau_selector_ == 2 && matches.size() > 0) return 1;
       }
       if (hadronic_tau_selector_ > 0 && channel_ != channel::em) {
-        std::vector<GenParticle *> const& particles = event->GetPtrVec<GenParticle>(gen_taus_label_);
-        std::vector<GenJet> gen_taus = BuildTauJets(particles, false,false);
+        std::vector<GenJet> gen_taus = GenGraph::Get(event, gen_taus_label_).TauJets(false, false);
         std::vector<GenJet *> gen_taus_ptr;
         for (auto & x : gen_taus) gen_taus_ptr.push_back(&x);
         ic::erase_if(gen_taus_ptr, !boost::bind(MinPtMaxEta, _1, 18.0, 999.));
@@ -920,6 +920,7 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
       tmp_tree->SetEstimate(100000);
       tfiles_[label] = tmp_file;
       ttrees_[label] = tmp_tree;
+      file_stamps_[label] = ShapeCache::FileStamp(input_filename);
     }
     for (auto str : result_summary) std::cout << str;
   }
@@ -1544,6 +1545,15 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
     return full_selection;                                      
   }
 
+  std::string HTTRun2Analysis::ShapeCacheKey(std::string const& sample,
+                                             std::string const& variable,
+                                             std::string const& full_selection) {
+    if (!shape_cache_) return "";
+    auto it = file_stamps_.find(sample);
+    if (it == file_stamps_.end() || it->second == "") return "";
+    return ShapeCache::MakeKey(it->second, variable, full_selection);
+  }
+
   std::string HTTRun2Analysis::BuildVarString(std::string const& variable) {
     std::string full_variable = variable;
     if (full_variable.find_last_of("(") != full_variable.npos 
@@ -1561,6 +1571,17 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
                                        std::string const& category, 
                                        std::string const& weight) {
     TH1::SetDefaultSumw2(true);
+    std::string full_selection = BuildCutString(selection, category, weight);
+    std::string cache_key = ShapeCacheKey(sample, variable, full_selection);
+    if (cache_key != "") {
+      TH1F result;
+      if (shape_cache_->Get(sample, cache_key, result)) {
+        auto rate = GetRate(sample, selection, category, weight);
+        SetNorm(&result, rate.first);
+        if(result.Integral(1,result.GetNbinsX()) == 0) std::cout<<"Warning - no shape for sample "<<sample<<std::endl;
+        return result;
+      }
+    }
     std::string full_variable = BuildVarString(variable);
     std::size_t begin_var = full_variable.find("[");
     std::size_t end_var   = full_variable.find("]");
@@ -1577,7 +1598,6 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
       full_variable.erase(begin_var, full_variable.npos);
       full_variable += ">>htemp";
     }
-    std::string full_selection = BuildCutString(selection, category, weight);
     // std::cout << full_selection << std::endl;
     // std::cout << full_variable << std::endl;
     TH1::AddDirectory(true);
@@ -1601,6 +1621,7 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
     htemp = (TH1F*)gDirectory->Get("htemp");
     TH1F result = (*htemp);
     gDirectory->Delete("htemp;*");
+    if (cache_key != "") shape_cache_->Put(sample, cache_key, result);
     auto rate = GetRate(sample, selection, category, weight);
     SetNorm(&result, rate.first);
     if(result.Integral(1,result.GetNbinsX()) == 0) std::cout<<"Warning - no shape for sample "<<sample<<std::endl;
@@ -1661,10 +1682,17 @@ push_back(sample_names_,this->ResolveSamplesAlias("data_samples"));
     TH1::AddDirectory(true);
     //If the tree is empty, return 0
     if(ttrees_[sample]->GetEntries() == 0) return std::make_pair(0,0);
+    std::string cache_key = ShapeCacheKey(sample, "0.5(1,0,1)", full_selection);
+    TH1F cached;
+    if (cache_key != "" && shape_cache_->Get(sample, cache_key, cached)) {
+      TH1::AddDirectory(false);
+      return std::make_pair(Integral(&cached), Error(&cached));
+    }
     ttrees_[sample]->Draw("0.5>>htemp(1,0,1)", full_selection.c_str(), "goff");
     TH1::AddDirectory(false);
     TH1F *htemp = (TH1F*)gDirectory->Get("htemp");
     auto result = std::make_pair(Integral(htemp), Error(htemp));
+    if (cache_key != "") shape_cache_->Put(sample, cache_key, *htemp);
     gDirectory->Delete("htemp;*");
     return result;
   }
@@ -25,6 +25,7 @@ namespace ic {
     met_res_mode_ = 0;
     njets_mode_ = 0;  
     do_recoil_=true;
+    check_recoil_tables_=false;
   }
 
   HTTRun2RecoilCorrector::~HTTRun2RecoilCorrector() {
@@ -42,6 +43,7 @@ namespace ic {
     std::cout << boost::format(param_fmt()) % "mc"              % MC2String(mc_);
     std::cout << boost::format(param_fmt()) % "met_label"       % met_label_;
     std::cout << boost::format(param_fmt()) % "jets_label"      % jets_label_;
+    std::cout << boost::format(param_fmt()) % "use_quantile_map" % use_quantile_map_;
 
     std::string process_file;
     std::string syst_file;
@@ -82,6 +84,7 @@ namespace ic {
     } else {
      if(!disable_recoil_corrs){
        corrector_ = new RecoilCorrectorRun2(process_file);
+       if(use_quantile_map_ && check_recoil_tables_) corrector_->PrintTableAccuracy();
     }
      if(!disable_met_sys){
        metSys_ = new MEtSys(syst_file);
@@ -6,6 +6,8 @@
 #include <memory>
 // ROOT
 #include "TH1.h"
+#include "TFile.h"
+#include "TNamed.h"
 // Objects
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/Muon.hh"
@@ -77,6 +79,8 @@
 
 namespace ic {
 
+// Any key read from the config here must also be listed in
+// HTTSequenceSchema() (HTTJobConfig.cc), otherwise HTT --compile rejects it
 HTTSequence::HTTSequence(std::string& chan, std::string postf, Json::Value const& json) {
   if(json["output_name"].asString()!=""){output_name=json["output_name"].asString();} else{std::cout<<"ERROR: output_name not set"<<std::endl; exit(1);};
   do_recoil = json["do_recoil"].asBool() && ((output_name.find("DY")!=output_name.npos && output_name.find("JetsToLL")!=output_name.npos) || output_name.find("HToTauTau")!=output_name.npos || output_name.find("WJetsToLNu") != output_name.npos || output_name.find("W1JetsToLNu") != output_name.npos || output_name.find("W2JetsToLNu")!=output_name.npos || output_name.find("W3JetsToLNu")!=output_name.npos || output_name.find("W4JetsToLNu")!=output_name.npos || output_name.find("WG")!=output_name.npos || output_name.find("EWKW")!=output_name.npos || output_name.find("EWKZ")!=output_name.npos || output_name.find("VBFH")!=output_name.npos || output_name.find("GluGluH")!=output_name.npos || output_name.find("ZHiggs")!=output_name.npos || output_name.find("WHiggs")!=output_name.npos );
@@ -506,6 +510,41 @@ HTTSequence::HTTSequence(std::string& chan, std::string postf, Json::Value const
 
 HTTSequence::~HTTSequence() {}
 
+std::string HTTSequence::getOutputFile() const {
+  return fs ? output_folder + output_name : "";
+}
+
+void HTTSequence::Checkpoint(unsigned number) {
+  if (!fs) return;
+  TNamed stamp("ic_checkpoint", boost::lexical_cast<std::string>(number).c_str());
+  ic::AutoSaveDirectory(&fs->file(), &stamp);
+}
+
+int HTTSequence::SavedCheckpoint(std::string const& filename) {
+  int number = -1;
+  TFile *file = TFile::Open(filename.c_str());
+  if (file && !file->IsZombie()) {
+    TNamed *stamp = dynamic_cast<TNamed*>(file->Get("ic_checkpoint"));
+    if (stamp) number = boost::lexical_cast<int>(stamp->GetTitle());
+    file->Close();
+  }
+  delete file;
+  return number;
+}
+
+void HTTSequence::RemoveCheckpointStamp(std::string const& filename) {
+  TFile *file = TFile::Open(filename.c_str(), "UPDATE");
+  if (file && !file->IsZombie()) {
+    file->Delete("ic_checkpoint;*");
+    file->Close();
+  }
+  delete file;
+}
+
+void HTTSequence::ConfigureOutputTrees(Json::Value const& cfg) {
+  if (fs) ic::ConfigureOutputTrees(&fs->file(), cfg);
+}
+
 
 void HTTSequence::BuildSequence(){
   using ROOT::Math::VectorUtil::DeltaR;
@@ -679,6 +718,7 @@ void HTTSequence::BuildSequence(){
     if((strategy_type ==strategy::fall15)&&channel!=channel::wmnu){
         HTTStitching httStitching = HTTStitching("HTTStitching")  
         .set_era(era_type)
+        .set_use_gen_summary(js["stitching_gen_summary"].asBool())
         .set_fs(fs.get());
       if ((output_name.find("DY") != output_name.npos && output_name.find("JetsToLL_M-50") != output_name.npos) || output_name.find("DYJetsToLL_M-150-LO")!=output_name.npos){
         /*httWeights.set_do_dy_soup_high_mass(true);
@@ -703,6 +743,7 @@ void HTTSequence::BuildSequence(){
     if((strategy_type ==strategy::mssmspring16||strategy_type == strategy::smspring16)&&channel!=channel::wmnu){
         HTTStitching httStitching = HTTStitching("HTTStitching")  
         .set_era(era_type)
+        .set_use_gen_summary(js["stitching_gen_summary"].asBool())
         .set_fs(fs.get());
          if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
            output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -722,6 +763,7 @@ void HTTSequence::BuildSequence(){
     if((strategy_type == strategy::mssmsummer16 || strategy_type == strategy::smsummer16 || strategy_type == strategy::cpsummer16)&&channel!=channel::wmnu&&channel!=channel::tpzee&&channel!=channel::tpzmm&&channel!=channel::tpmt&&channel!=channel::tpem){
         HTTStitching httStitching = HTTStitching("HTTStitching")  
         .set_era(era_type)
+        .set_use_gen_summary(js["stitching_gen_summary"].asBool())
         .set_fs(fs.get());
          if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
            output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -740,6 +782,7 @@ void HTTSequence::BuildSequence(){
     if(strategy_type == strategy::cpsummer17&&channel!=channel::wmnu&&channel!=channel::tpzee&&channel!=channel::tpzmm&&channel!=channel::tpmt&&channel!=channel::tpem){
         HTTStitching httStitching = HTTStitching("HTTStitching")
         .set_era(era_type)
+        .set_use_gen_summary(js["stitching_gen_summary"].asBool())
         .set_fs(fs.get());
          if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
            output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -1465,7 +1508,8 @@ if(channel != channel::wmnu) {
      .set_met_label(met_label)
      .set_jets_label(jets_label)
      .set_strategy(strategy_type)
-     .set_use_quantile_map(false)
+     .set_use_quantile_map(js["recoil_quantile_map"].asBool())
+     .set_check_recoil_tables(js["check_recoil_tables"].asBool())
      .set_met_scale_mode(metscale_mode)
      .set_met_res_mode(metres_mode)
      .set_store_boson_pt(js["make_sync_ntuple"].asBool()));
@@ -1480,7 +1524,8 @@ if(channel != channel::wmnu) {
      .set_met_label(met_label)
      .set_jets_label(jets_label)
      .set_strategy(strategy_type)
-     .set_use_quantile_map(false)
+     .set_use_quantile_map(js["recoil_quantile_map"].asBool())
+     .set_check_recoil_tables(js["check_recoil_tables"].asBool())
      .set_met_scale_mode(metscale_mode)
      .set_met_res_mode(metres_mode)
      .set_store_boson_pt(js["make_sync_ntuple"].asBool())
@@ -1839,6 +1884,7 @@ if((strategy_type == strategy::fall15 || strategy_type == strategy::mssmspring16
 
     HTTStitching httStitching = HTTStitching("HTTStitching")  
     .set_era(era_type)
+    .set_use_gen_summary(js["stitching_gen_summary"].asBool())
     .set_fs(fs.get());
   if ((output_name.find("DY") != output_name.npos && output_name.find("JetsToLL_M-50") != output_name.npos) || output_name.find("DYJetsToLL_M-150-LO")!=output_name.npos){
     /*httWeights.set_do_dy_soup_high_mass(true);
@@ -1964,6 +2010,7 @@ if((strategy_type == strategy::fall15 || strategy_type == strategy::mssmspring16
    
     HTTStitching httStitching = HTTStitching("HTTStitching")  
     .set_era(era_type)
+    .set_use_gen_summary(js["stitching_gen_summary"].asBool())
     .set_fs(fs.get());
      if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
        output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -2093,6 +2140,7 @@ if(strategy_type == strategy::mssmsummer16&&channel!=channel::wmnu){
     
     HTTStitching httStitching = HTTStitching("HTTStitching")  
         .set_era(era_type)
+        .set_use_gen_summary(js["stitching_gen_summary"].asBool())
         .set_fs(fs.get());
          if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
            output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -2164,6 +2212,7 @@ if((strategy_type == strategy::smsummer16 || strategy_type == strategy::cpsummer
     if(channel!=channel::tpzee&&channel!=channel::tpzmm&&channel!=channel::tpmt&&channel != channel::tpem){
       HTTStitching httStitching = HTTStitching("HTTStitching")  
           .set_era(era_type)
+          .set_use_gen_summary(js["stitching_gen_summary"].asBool())
           .set_fs(fs.get());
            if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
              output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -2233,6 +2282,7 @@ if((strategy_type == strategy::smsummer16 || strategy_type == strategy::cpsummer
      if(channel!=channel::tpzee&&channel!=channel::tpzmm&&channel!=channel::tpmt&&channel != channel::tpem){
        HTTStitching httStitching = HTTStitching("HTTStitching")  
            .set_era(era_type)
+           .set_use_gen_summary(js["stitching_gen_summary"].asBool())
            .set_fs(fs.get());
             if (output_name.find("WJetsToLNu-LO") != output_name.npos || output_name.find("W1JetsToLNu-LO") != output_name.npos || output_name.find("W2JetsToLNu-LO") != output_name.npos ||
               output_name.find("W3JetsToLNu-LO") != output_name.npos || output_name.find("W4JetsToLNu-LO") != output_name.npos){
@@ -2316,6 +2366,11 @@ bool do_mssm_higgspt = output_name.find("SUSYGluGluToHToTauTau_M") != output_nam
 bool do_sm_scale_wts = (output_name.find("GluGluH2JetsToTauTau_M") != output_name.npos || output_name.find("GluGluToHToTauTau_amcNLO_M-") != output_name.npos || output_name.find("GluGluToHToTauTau_M") != output_name.npos ) && output_name.find("SUSY") == output_name.npos && (strategy_type == strategy::smsummer16 || strategy_type == strategy::cpsummer16 || strategy_type == strategy::cpsummer17);
 bool do_jes_vars = jes_mode > 0 && js["baseline"]["split_by_source"].asBool();
 bool z_sample = (output_name.find("DY") != output_name.npos && (output_name.find("JetsToLL-LO") != output_name.npos || output_name.find("JetsToLL_M-10-50-LO") != output_name.npos)) || output_name.find("EWKZ2Jets") != output_name.npos;
+std::vector<std::string> variable_groups = {"all"};
+if(js["variable_groups"].isArray()) {
+  variable_groups.clear();
+  for(unsigned i = 0; i < js["variable_groups"].size(); ++i) variable_groups.push_back(js["variable_groups"][i].asString());
+}
 BuildModule(HTTCategories("HTTCategories")
     .set_fs(fs.get())
     .set_channel(channel)
@@ -2328,6 +2383,8 @@ BuildModule(HTTCategories("HTTCategories")
     .set_bjet_regression(bjet_regr_correction)
     .set_make_sync_ntuple(js["make_sync_ntuple"].asBool())
     .set_sync_output_name(js["output_folder"].asString()+"/SYNCFILE_"+output_name)
+    .set_write_friend_inputs(js["write_friend_inputs"].asBool())
+    .set_variable_groups(variable_groups)
     .set_iso_study(js["iso_study"].asBool())
     .set_tau_id_study(js["tau_id_study"].asBool())
     .set_qcd_study(js["qcd_study"].asBool())
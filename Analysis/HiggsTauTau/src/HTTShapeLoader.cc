@@ -0,0 +1,246 @@
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTShapeLoader.h"
+#include <algorithm>
+#include "TFile.h"
+#include "TKey.h"
+#include "TDirectory.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnParallel.h"
+
+namespace ic {
+
+  namespace {
+    std::string ShapeName(std::string const& process, int process_id, std::string const& mass) {
+      return (process_id <= 0) ? (process + mass) : process;
+    }
+  }
+
+  std::string HTTShapeStore::MakeKey(std::string const& channel, std::string const& era,
+                                     std::string const& category, std::string const& name) {
+    return channel + ":" + era + ":" + category + "/" + name;
+  }
+
+  unsigned HTTShapeStore::Add(std::string const& key, TH1 const& hist) {
+    auto it = index_.find(key);
+    if (it != index_.end()) return it->second;
+    Block block;
+    block.nbins = hist.GetNbinsX();
+    block.offset = contents_.size();
+    block.edge = edges_.size();
+    for (unsigned i = 0; i <= block.nbins + 1; ++i) {
+      contents_.push_back(hist.GetBinContent(i));
+      errors_.push_back(hist.GetBinError(i));
+    }
+    TAxis const* axis = hist.GetXaxis();
+    for (unsigned i = 1; i <= block.nbins + 1; ++i) {
+      edges_.push_back(axis->GetBinLowEdge(i));
+    }
+    blocks_.push_back(block);
+    index_[key] = blocks_.size() - 1;
+    return blocks_.size() - 1;
+  }
+
+  void HTTShapeStore::Merge(HTTShapeStore const& other) {
+    // Keep the order in which other's shapes were added
+    std::vector<std::string const*> keys(other.blocks_.size(), nullptr);
+    for (auto const& it : other.index_) keys[it.second] = &(it.first);
+    for (unsigned i = 0; i < keys.size(); ++i) {
+      if (index_.count(*(keys[i]))) continue;
+      Block block = other.blocks_[i];
+      block.offset = contents_.size();
+      block.edge = edges_.size();
+      contents_.insert(contents_.end(), other.contents(i), other.contents(i) + block.nbins + 2);
+      errors_.insert(errors_.end(), other.errors(i), other.errors(i) + block.nbins + 2);
+      edges_.insert(edges_.end(), other.edges(i), other.edges(i) + block.nbins + 1);
+      blocks_.push_back(block);
+      index_[*(keys[i])] = blocks_.size() - 1;
+    }
+  }
+
+  int HTTShapeStore::Find(std::string const& key) const {
+    auto it = index_.find(key);
+    return (it != index_.end()) ? int(it->second) : -1;
+  }
+
+  double HTTShapeStore::Integral(unsigned i) const {
+    double const* c = contents(i);
+    double result = 0.;
+    for (unsigned j = 1; j <= blocks_[i].nbins; ++j) result += c[j];
+    return result;
+  }
+
+  TH1F * HTTShapeStore::MakeTH1F(unsigned i, std::string const& name) const {
+    bool add_status = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(false);
+    unsigned nbins = blocks_[i].nbins;
+    TH1F *hist = new TH1F(name.c_str(), name.c_str(), nbins, edges(i));
+    TH1::AddDirectory(add_status);
+    hist->Sumw2();
+    double const* c = contents(i);
+    double const* e = errors(i);
+    for (unsigned j = 0; j <= nbins + 1; ++j) {
+      hist->SetBinContent(j, c[j]);
+      hist->SetBinError(j, e[j]);
+    }
+    return hist;
+  }
+
+  HTTShapeLoader::HTTShapeLoader() {
+    threads_ = 1;
+    verbose_ = false;
+  }
+
+  HTTShapeLoader & HTTShapeLoader::AddDatacard(std::string const& filename,
+      std::string const& channel, int category_id, std::string const& era,
+      std::string const& mass) {
+    cards_.push_back({filename, channel, category_id, era, mass});
+    return *this;
+  }
+
+  HTTShapeLoader & HTTShapeLoader::AddROOTFile(std::string const& filename,
+      std::string const& channel, std::string const& era) {
+    files_.push_back({filename, channel, era});
+    return *this;
+  }
+
+  int HTTShapeLoader::ParseCard(CardInput const& input, CardContent & content) {
+    return ParseDatacardEntries(input.filename, input.channel, input.category_id,
+                                input.era, input.mass, content.obs,
+                                content.processes, content.params);
+  }
+
+  int HTTShapeLoader::ReadFile(FileInput const& input, RequestMap const& requests,
+                               HTTShapeStore & store) {
+    TFile file(input.filename.c_str());
+    if (!file.IsOpen()) {
+      std::cerr << "Warning in <HTTShapeLoader::ReadFile>: File " << input.filename
+                << " cannot be opened" << std::endl;
+      return 1;
+    }
+    for (auto const& cat : requests) {
+      TDirectory *dir = file.GetDirectory(cat.first.c_str());
+      if (!dir) {
+        std::cerr << "Warning, category " << cat.first << " not found in ROOT File" << std::endl;
+        continue;
+      }
+      // List the directory once, keeping the highest cycle of each key
+      std::map<std::string, TKey *> keys;
+      TIter next(dir->GetListOfKeys());
+      while (TKey *key = static_cast<TKey *>(next())) {
+        TKey *& entry = keys[key->GetName()];
+        if (!entry || entry->GetCycle() < key->GetCycle()) entry = key;
+      }
+      for (auto const& name : cat.second) {
+        auto it = keys.find(name);
+        if (it == keys.end()) {
+          std::cerr << "Warning, histogram " << name << " not found in ROOT File" << std::endl;
+          continue;
+        }
+        TObject *obj = it->second->ReadObj();
+        TH1 *hist = dynamic_cast<TH1 *>(obj);
+        if (!hist) {
+          std::cerr << "Warning, object " << name << " is not a histogram" << std::endl;
+        } else {
+          store.Add(HTTShapeStore::MakeKey(input.channel, input.era, cat.first, name), *hist);
+        }
+        delete obj;
+      }
+    }
+    file.Close();
+    return 0;
+  }
+
+  int HTTShapeLoader::Load(HTTSetup & setup) {
+    unsigned n_threads = std::max(threads_, 1u);
+    int n_failed = 0;
+
+    std::vector<CardContent> content(cards_.size());
+    std::vector<int> card_status(cards_.size(), 0);
+    ParallelFor(cards_.size(), n_threads, [&](unsigned i) {
+      card_status[i] = ParseCard(cards_[i], content[i]);
+    });
+    for (unsigned i = 0; i < cards_.size(); ++i) n_failed += card_status[i];
+
+    // Work out which histograms are needed from each file before opening it
+    std::vector<RequestMap> requests(files_.size());
+    for (unsigned f = 0; f < files_.size(); ++f) {
+      RequestMap & req = requests[f];
+      for (auto const& card : content) {
+        for (auto const& proc : card.processes) {
+          if (proc.channel != files_[f].channel || proc.era != files_[f].era) continue;
+          req[proc.category].insert(ShapeName(proc.process, proc.process_id, proc.mass));
+        }
+        for (auto const& obs : card.obs) {
+          if (obs.channel != files_[f].channel || obs.era != files_[f].era) continue;
+          req[obs.category].insert(obs.process);
+        }
+        for (auto const& par : card.params) {
+          if (par.type != "shape") continue;
+          if (par.channel != files_[f].channel || par.era != files_[f].era) continue;
+          std::string name = ShapeName(par.process, par.process_id, par.mass);
+          req[par.category].insert(name);
+          req[par.category].insert(name + "_" + par.nuisance + "Up");
+          req[par.category].insert(name + "_" + par.nuisance + "Down");
+        }
+      }
+    }
+
+    std::vector<HTTShapeStore> file_stores(files_.size());
+    std::vector<int> file_status(files_.size(), 0);
+    ParallelFor(files_.size(), n_threads, [&](unsigned i) {
+      file_status[i] = ReadFile(files_[i], requests[i], file_stores[i]);
+    });
+    for (unsigned i = 0; i < files_.size(); ++i) n_failed += file_status[i];
+
+    // Merge in input order so the result is independent of the thread count.
+    // Each file store is released once merged, and the merged store only
+    // lives until the TH1F copies used by HTTSetup have been built.
+    HTTShapeStore store;
+    for (auto & fs : file_stores) {
+      store.Merge(fs);
+      fs = HTTShapeStore();
+    }
+    if (verbose_) {
+      std::cout << "Info in <HTTShapeLoader::Load>: Read " << store.size() << " shapes from "
+                << files_.size() << " file(s) for " << cards_.size() << " datacard(s)" << std::endl;
+    }
+
+    auto find = [&](std::string const& channel, std::string const& era,
+                    std::string const& category, std::string const& name) {
+      return store.Find(HTTShapeStore::MakeKey(channel, era, category, name));
+    };
+
+    for (auto & card : content) {
+      for (auto & proc : card.processes) {
+        std::string name = ShapeName(proc.process, proc.process_id, proc.mass);
+        int idx = find(proc.channel, proc.era, proc.category, name);
+        if (idx < 0) continue;
+        proc.shape = store.MakeTH1F(idx, name);
+        proc.rate = store.Integral(idx);
+      }
+      for (auto & obs : card.obs) {
+        int idx = find(obs.channel, obs.era, obs.category, obs.process);
+        if (idx < 0) continue;
+        obs.shape = store.MakeTH1F(idx, obs.process);
+        obs.errors = new TGraphAsymmErrors(BuildPoissonErrors(*(obs.shape)));
+      }
+      for (auto & par : card.params) {
+        if (par.type != "shape") continue;
+        std::string name = ShapeName(par.process, par.process_id, par.mass);
+        std::string up_name = name + "_" + par.nuisance + "Up";
+        std::string down_name = name + "_" + par.nuisance + "Down";
+        int idx = find(par.channel, par.era, par.category, name);
+        if (idx < 0) continue;
+        par.shape = store.MakeTH1F(idx, name);
+        int idx_up = find(par.channel, par.era, par.category, up_name);
+        if (idx_up < 0) continue;
+        par.shape_up = store.MakeTH1F(idx_up, up_name);
+        int idx_down = find(par.channel, par.era, par.category, down_name);
+        if (idx_down < 0) continue;
+        par.shape_down = store.MakeTH1F(idx_down, down_name);
+      }
+      setup.obs_.insert(setup.obs_.end(), card.obs.begin(), card.obs.end());
+      setup.processes_.insert(setup.processes_.end(), card.processes.begin(), card.processes.end());
+      setup.params_.insert(setup.params_.end(), card.params.begin(), card.params.end());
+    }
+    return n_failed;
+  }
+}
@@ -6,6 +6,8 @@
 #include <string>
 #include <iostream>
 #include <functional>
+#include <fstream>
+#include <iterator>
 #include "Math/QuantFuncMathCore.h"
 #include "TMath.h"
 #include "boost/lexical_cast.hpp"
@@ -730,26 +732,50 @@ namespace ic {
 	}
 
 	int HTTSetup::ParseDatacard(const std::string & filename, std::string const& channel, int category_id, std::string era, std::string mass) {
+		ParseDatacardEntries(filename, channel, category_id, era, mass, obs_, processes_, params_);
+		return 0;
+	}
 
-		std::vector<std::string> lines = ParseFileLines(filename);
+	namespace {
+		inline bool IsBlank(char c) {
+			return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+		}
+	}
 
-		bool start_nuisance_scan = false;
-		unsigned r = 0;
+	int ParseDatacardEntries(std::string const& filename, std::string const& channel,
+			int category_id, std::string const& era, std::string const& mass,
+			std::vector<Observation> & obs, std::vector<Process> & processes,
+			std::vector<Nuisance> & params) {
+		std::ifstream file(filename.c_str());
+		if (!file.is_open()) {
+			std::cerr << "Warning: File " << filename << " cannot be opened." << std::endl;
+			return 1;
+		}
+		std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
+		// Split each line into a vector of words, using any amount of
+		// whitespace as the separator, in a single scan of the file. Lines
+		// with no words are skipped.
 		std::vector<std::vector<std::string>> words;
-		
-		// Loop through lines, trimming whitespace at the beginning or end
-		// then splitting each line into a vector of words (using any amount
-		// of whitespace as the separator).  We skip any line of zero length
-		// or which starts with a "#" or "-" character.
-		for (unsigned i = 0; i < lines.size(); ++i) {
-			boost::trim(lines[i]);
-			if (lines[i].size() == 0) continue;
-			if (lines[0] == "#" || lines[0] == "-") continue;
-			words.push_back(std::vector<std::string>());
-			boost::split(words.back(), lines[i], boost::is_any_of("\t "), boost::token_compress_on);
+		std::size_t pos = 0;
+		while (pos < buffer.size()) {
+			std::size_t end = buffer.find('\n', pos);
+			if (end == std::string::npos) end = buffer.size();
+			std::vector<std::string> line;
+			std::size_t i = pos;
+			while (i < end) {
+				while (i < end && IsBlank(buffer[i])) ++i;
+				std::size_t start = i;
+				while (i < end && !IsBlank(buffer[i])) ++i;
+				if (i > start) line.push_back(buffer.substr(start, i - start));
+			}
+			if (line.size() > 0) words.push_back(std::move(line));
+			pos = end + 1;
 		}
 
+		bool start_nuisance_scan = false;
+		unsigned r = 0;
+
 		// Loop through the vector of word vectors
 		for (unsigned i = 0; i < words.size(); ++i) {
 			// Ignore line if it only has one word
@@ -764,14 +790,14 @@ namespace ic {
 							words[i-1][0] 	== "bin" && 
 							words[i].size() == words[i-1].size()) {
 					for (unsigned p = 1; p < words[i].size(); ++p) {
-						obs_.push_back(Observation());
-						obs_.back().channel = channel;
-						obs_.back().category_id = category_id;
-						obs_.back().era = era;
-						obs_.back().category = words[i-1][p];
-						obs_.back().process = "data_obs";
-						obs_.back().rate = boost::lexical_cast<double>(words[i][p]);
-						obs_.back().mass = mass;
+						obs.push_back(Observation());
+						obs.back().channel = channel;
+						obs.back().category_id = category_id;
+						obs.back().era = era;
+						obs.back().category = words[i-1][p];
+						obs.back().process = "data_obs";
+						obs.back().rate = boost::lexical_cast<double>(words[i][p]);
+						obs.back().mass = mass;
 					}
 				}
 			}
@@ -790,15 +816,15 @@ namespace ic {
 							words[i].size() == words[i-2].size() &&
 							words[i].size() == words[i-3].size()) {
 					for (unsigned p = 1; p < words[i].size(); ++p) {
-						processes_.push_back(Process());
-						processes_.back().channel = channel;
-						processes_.back().category_id = category_id;
-						processes_.back().era = era;
-						processes_.back().category = words[i-3][p];
-						processes_.back().process = words[i-1][p];
-						processes_.back().process_id = boost::lexical_cast<int>(words[i-2][p]);
-						processes_.back().rate = boost::lexical_cast<double>(words[i][p]);
-						processes_.back().mass = mass;
+						processes.push_back(Process());
+						processes.back().channel = channel;
+						processes.back().category_id = category_id;
+						processes.back().era = era;
+						processes.back().category = words[i-3][p];
+						processes.back().process = words[i-1][p];
+						processes.back().process_id = boost::lexical_cast<int>(words[i-2][p]);
+						processes.back().rate = boost::lexical_cast<double>(words[i][p]);
+						processes.back().mass = mass;
 					}
 					r = i;
 					start_nuisance_scan = true;
@@ -806,20 +832,20 @@ namespace ic {
 			}
 
 			if (start_nuisance_scan && words[i].size()-1 == words[r].size()) {
+				if (words[i][0].at(0) == '#') continue;
 				for (unsigned p = 2; p < words[i].size(); ++p) {
 					if (words[i][p] == "-") continue;
-					if (words[i][0].at(0) == '#') continue;
-					params_.push_back(Nuisance());
-					params_.back().channel = channel;
-					params_.back().category_id = category_id;
-					params_.back().category = words[r-3][p-1];
-					params_.back().era = era;
-					params_.back().process = words[r-1][p-1];
-					params_.back().process_id = boost::lexical_cast<int>(words[r-2][p-1]);
-					params_.back().nuisance = words[i][0];
-					params_.back().type = words[i][1];
-					params_.back().value = boost::lexical_cast<double>(words[i][p]);
-					params_.back().mass = mass;
+					params.push_back(Nuisance());
+					params.back().channel = channel;
+					params.back().category_id = category_id;
+					params.back().category = words[r-3][p-1];
+					params.back().era = era;
+					params.back().process = words[r-1][p-1];
+					params.back().process_id = boost::lexical_cast<int>(words[r-2][p-1]);
+					params.back().nuisance = words[i][0];
+					params.back().type = words[i][1];
+					params.back().value = boost::lexical_cast<double>(words[i][p]);
+					params.back().mass = mass;
 				}
 			}
 		}
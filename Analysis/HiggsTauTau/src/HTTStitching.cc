@@ -12,6 +12,8 @@
 #include "TSystem.h"
 #include "TFile.h"
 #include "boost/format.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace ic {
 
@@ -22,7 +24,9 @@ namespace ic {
     do_dy_soup_high_mass_     = false;
     do_dy_soup_htbinned_      = false;
     do_w_soup_htbinned_      = false;
+    use_gen_summary_          = false;
     fs_ = NULL;
+    t_gen_info_ = NULL;
   }
   HTTStitching::~HTTStitching() {
     ;
@@ -182,202 +186,123 @@ namespace ic {
       std::cout << boost::format("f ht>600=%-9.5f  n ht>600=%-9i  w ht>600=%-9.5f \n") % zf4_ % zn4_ % zw4_;
     }
 
+    // Applied in this order, so that a later soup overrides the weight of
+    // an earlier one
+    tables_.clear();
+    if (do_w_soup_) AddTable("wsoup", 5, {}, false, {-1., w1_, w2_, w3_, w4_});
+    if (do_dy_soup_) AddTable("dysoup", 5, {}, false, {-1., zw1_, zw2_, zw3_, zw4_});
+    if (do_dy_soup_high_mass_) {
+      AddTable("dysoup", 5, {}, true,
+               {-1., zw0hi_, zw1lo_, zw1hi_, zw2lo_, zw2hi_, zw3lo_, zw3hi_, zw4lo_, zw4hi_});
+    }
+    if (do_w_soup_htbinned_) AddTable("wsoup", 1, {100., 200., 400., 600.}, false, {-1., w1_, w2_, w3_, w4_});
+    if (do_dy_soup_htbinned_) AddTable("dysoup", 1, {100., 200., 400., 600.}, false, {-1., zw1_, zw2_, zw3_, zw4_});
+    if (tables_.size() > 0) std::cout << boost::format(param_fmt()) % "use_gen_summary" % use_gen_summary_;
+
     return 0;
   }
 
-  int HTTStitching::Execute(TreeEvent *event) {
-
-    std::vector<CompositeCandidate *> dilepton;
+  unsigned HTTStitching::Table::Index(unsigned partons, double ht, bool high_mass) const {
+    unsigned ht_bin = std::upper_bound(ht_edges.begin(), ht_edges.end(), ht) - ht_edges.begin();
+    unsigned idx = (n_partons > 1 ? partons : 0) * (ht_edges.size() + 1) + ht_bin;
+    return split_high_mass ? 2 * idx + high_mass : idx;
+  }
 
-    EventInfo * eventInfo = event->GetPtr<EventInfo>("eventInfo");
+  void HTTStitching::AddTable(std::string const& weight, unsigned n_partons,
+                              std::vector<double> const& ht_edges, bool split_high_mass,
+                              std::vector<double> const& values) {
+    Table table;
+    table.weight = weight;
+    table.n_partons = n_partons;
+    table.ht_edges = ht_edges;
+    table.split_high_mass = split_high_mass;
+    table.values = values;
+    if (values.size() != n_partons * (ht_edges.size() + 1) * (split_high_mass ? 2 : 1)) {
+      throw std::runtime_error("[HTTStitching] Stitching table for " + weight + " has the wrong size");
+    }
+    tables_.push_back(table);
+  }
 
-    if (do_w_soup_) {
-      unsigned partons = 0;
-      double gen_mll = 0;
-      if(era_ != era::data_2015 && era_ != era::data_2016 && era_ != era::data_2017){
-        std::vector<GenParticle*> const& parts = event->GetPtrVec<GenParticle>("genParticles");
-        bool count_jets = false;
-        for (unsigned i = 0; i < parts.size(); ++i) {
-          if (parts[i]->status() != 3) continue;
-          unsigned id = abs(parts[i]->pdgid());
-          if (count_jets) { 
-            if (id == 1 || id == 2 || id == 3 || id == 4 || id == 5 || id == 6 || id == 21) partons++;
-          }
-          if (id == 24) count_jets = true; 
-        }
-      } else if(era_ == era::data_2015 || era_ == era::data_2016 || era_ == era::data_2017) {
-        std::vector<GenParticle*> const& lhe_parts = event->GetPtrVec<GenParticle>("lheParticles");
-        std::vector<GenParticle*> zll_cands;
-        t_ht_=0;
-        for(unsigned i = 0; i< lhe_parts.size(); ++i){
-         if(lhe_parts[i]->status() != 1) continue;
-         unsigned id = abs(lhe_parts[i]->pdgid());
-         if ((id >= 1 && id <=6) || id == 21){ 
-            t_ht_+=lhe_parts[i]->pt();
-            partons++;
-         }
-        }
-          t_mll_ = gen_mll;
-          t_decay_ = 0;  // ee, mumu, tautau
-      }
-      if (partons > 4) {
-        std::cerr << "Error making soup, event has " << partons << " partons!" << std::endl;
-        throw;
+  unsigned HTTStitching::CountStatus3Partons(TreeEvent *event, unsigned boson) {
+    std::vector<GenParticle*> const& parts = event->GetPtrVec<GenParticle>("genParticles");
+    unsigned partons = 0;
+    bool count_jets = false;
+    for (unsigned i = 0; i < parts.size(); ++i) {
+      if (parts[i]->status() != 3) continue;
+      unsigned id = abs(parts[i]->pdgid());
+      if (count_jets) {
+        if (id == 1 || id == 2 || id == 3 || id == 4 || id == 5 || id == 6 || id == 21) partons++;
       }
-      if (partons == 1) eventInfo->set_weight("wsoup", w1_);
-      if (partons == 2) eventInfo->set_weight("wsoup", w2_);
-      if (partons == 3) eventInfo->set_weight("wsoup", w3_);
-      if (partons == 4) eventInfo->set_weight("wsoup", w4_);
-      t_njets_ = partons;
-
-      t_wt_ = eventInfo->weight_defined("wsoup") ? eventInfo->weight("wsoup") : 1.;
-      if(fs_) t_gen_info_->Fill();
+      if (id == boson) count_jets = true;
     }
+    return partons;
+  }
+
+  int HTTStitching::Execute(TreeEvent *event) {
 
-    if (do_dy_soup_) {
+    EventInfo * eventInfo = event->GetPtr<EventInfo>("eventInfo");
+    bool lhe_era = era_ == era::data_2015 || era_ == era::data_2016 || era_ == era::data_2017;
+
+    for (auto const& table : tables_) {
+      bool is_dy = table.weight == "dysoup";
       unsigned partons = 0;
-      double gen_mll = 0;
-      if(era_ != era::data_2015&&era_!=era::data_2016 && era_ != era::data_2017){
-        std::vector<GenParticle*> const& parts = event->GetPtrVec<GenParticle>("genParticles");
-        bool count_jets = false;
-      
-        for (unsigned i = 0; i < parts.size(); ++i) {
-          // std::cout << i << "\t" << parts[i]->status() << "\t" << parts[i]->pdgid() << "\t" << parts[i]->vector() << std::endl;
-          if (parts[i]->status() != 3) continue;
-          unsigned id = abs(parts[i]->pdgid());
-          if (count_jets) { 
-            if (id == 1 || id == 2 || id == 3 || id == 4 || id == 5 || id == 6 || id == 21) partons++;
-          }
-          if (id == 23) count_jets = true; 
+      bool high_mass = false;
+      if (table.n_partons > 1 && !lhe_era && !table.split_high_mass) {
+        partons = CountStatus3Partons(event, is_dy ? 23 : 24);
+      } else if (table.n_partons > 1) {
+        // The decay is only needed for the weight in the high mass soup,
+        // otherwise it is just for the genweights tree
+        bool need_decay = is_dy && (!use_gen_summary_ || table.split_high_mass);
+        if (use_gen_summary_) {
+          partons = eventInfo->n_outgoing_partons();
+          t_ht_ = eventInfo->gen_ht();
+          t_mll_ = eventInfo->gen_mll();
+          t_decay_ = -1;
         }
-      } else if(era_ == era::data_2015 || era_ == era::data_2016 || era_ == era::data_2017){ 
-        t_ht_=0;
-        std::vector<GenParticle*> const& lhe_parts = event->GetPtrVec<GenParticle>("lheParticles");
-        std::vector<GenParticle*> zll_cands;
-        for(unsigned i = 0; i< lhe_parts.size(); ++i){
-         if(lhe_parts[i]->status() != 1) continue;
-         unsigned id = abs(lhe_parts[i]->pdgid());
-         if ((id >= 1 && id <=6) || id == 21){ 
-            partons++;
-            t_ht_+=lhe_parts[i]->pt();
-         }
-         if (id == 11|| id ==13 || id ==15) zll_cands.push_back(lhe_parts[i]);
-        }
-        if(zll_cands.size() == 2){
-          gen_mll = (zll_cands[0]->vector()+zll_cands[1]->vector()).M();
-          t_mll_ = gen_mll;
-        } else {
-          std::cerr << "Error making soup, event has " << zll_cands.size() << " Z->ll candidates, 2 expected!" <<std::endl;
-          throw;
-        }
-        t_decay_ = 0;  // ee, mumu, tautau
-        if (std::abs(zll_cands[0]->pdgid()) == 11 &&
-            std::abs(zll_cands[1]->pdgid()) == 11) {
-          t_decay_ = 0;
-        } else if (std::abs(zll_cands[0]->pdgid()) == 13 &&
-                   std::abs(zll_cands[1]->pdgid()) == 13) {
-          t_decay_ = 1;
-        } else if (std::abs(zll_cands[0]->pdgid()) == 15 &&
-                   std::abs(zll_cands[1]->pdgid()) == 15) {
-          t_decay_ = 2;
-        } else {
-          std::cerr << "Error!\n";
-          throw;
+        if (!use_gen_summary_ || need_decay) {
+          std::vector<GenParticle*> const& lhe_parts = event->GetPtrVec<GenParticle>("lheParticles");
+          std::vector<GenParticle*> zll_cands;
+          if (!use_gen_summary_) t_ht_ = 0;
+          for (unsigned i = 0; i < lhe_parts.size(); ++i) {
+            if (lhe_parts[i]->status() != 1) continue;
+            unsigned id = abs(lhe_parts[i]->pdgid());
+            if (!use_gen_summary_ && ((id >= 1 && id <= 6) || id == 21)) {
+              partons++;
+              t_ht_ += lhe_parts[i]->pt();
+            }
+            if (id == 11 || id == 13 || id == 15) zll_cands.push_back(lhe_parts[i]);
+          }
+          if (!is_dy) {
+            t_mll_ = 0;
+            t_decay_ = 0;
+          } else if (zll_cands.size() != 2) {
+            throw std::runtime_error((boost::format("Error making soup, event has %i Z->ll candidates, 2 expected!") % zll_cands.size()).str());
+          } else {
+            if (!use_gen_summary_) t_mll_ = (zll_cands[0]->vector()+zll_cands[1]->vector()).M();
+            // ee, mumu, tautau
+            unsigned id_1 = std::abs(zll_cands[0]->pdgid());
+            unsigned id_2 = std::abs(zll_cands[1]->pdgid());
+            if (id_1 != id_2) throw std::runtime_error("Error making soup, Z->ll candidates have different flavours!");
+            t_decay_ = id_1 == 11 ? 0 : (id_1 == 13 ? 1 : 2);
+          }
         }
+        high_mass = table.split_high_mass && t_mll_ > 150 && t_decay_ == 2;
       }
       if (partons > 4) {
-        std::cerr << "Error making soup, event has " << partons << " partons!" << std::endl;
-        throw;
+        throw std::runtime_error((boost::format("Error making soup, event has %i partons!") % partons).str());
       }
-      if (partons == 1) eventInfo->set_weight("dysoup", zw1_);
-      if (partons == 2) eventInfo->set_weight("dysoup", zw2_);
-      if (partons == 3) eventInfo->set_weight("dysoup", zw3_);
-      if (partons == 4) eventInfo->set_weight("dysoup", zw4_);
-      t_njets_ = partons;
-
-      t_wt_ = eventInfo->weight_defined("dysoup") ? eventInfo->weight("dysoup") : 1.;
-      if(fs_) t_gen_info_->Fill();
-
-      // unsigned gen_match_1 = MCOrigin2UInt(event->Get<ic::mcorigin>("gen_match_1"));
-    }
 
+      double ht = table.ht_edges.empty() ? 0. : eventInfo->gen_ht();
+      double wt = table.values[table.Index(partons, ht, high_mass)];
+      if (wt >= 0.) eventInfo->set_weight(table.weight, wt);
 
-    if (do_dy_soup_high_mass_) {
-        unsigned partons = 0; 
-        double gen_mll = 0;
-        std::vector<GenParticle*> const& lhe_parts = event->GetPtrVec<GenParticle>("lheParticles");
-        std::vector<GenParticle*> zll_cands;
-        for(unsigned i = 0; i< lhe_parts.size(); ++i){
-         if(lhe_parts[i]->status() != 1) continue;
-         unsigned id = abs(lhe_parts[i]->pdgid());
-         if ((id >= 1 && id <=6) || id == 21) partons++;
-         if (id == 11|| id ==13 || id ==15) zll_cands.push_back(lhe_parts[i]);
-        }
-        if(zll_cands.size() == 2){
-         gen_mll = (zll_cands[0]->vector()+zll_cands[1]->vector()).M();
-         t_mll_ = gen_mll;
-        } else {
-          std::cerr << "Error making soup, event has " << zll_cands.size() << " Z->ll candidates, 2 expected!" <<std::endl;
-          throw;
-        } 
-      if (partons > 4) {
-        std::cerr << "Error making soup, event has " << partons << " partons!" << std::endl;
-        throw;
-      }
-      t_njets_ = partons;
-
-      t_decay_ = 0;  // ee, mumu, tautau
-      if (std::abs(zll_cands[0]->pdgid()) == 11 &&
-          std::abs(zll_cands[1]->pdgid()) == 11) {
-        t_decay_ = 0;
-      } else if (std::abs(zll_cands[0]->pdgid()) == 13 &&
-                 std::abs(zll_cands[1]->pdgid()) == 13) {
-        t_decay_ = 1;
-      } else if (std::abs(zll_cands[0]->pdgid()) == 15 &&
-                 std::abs(zll_cands[1]->pdgid()) == 15) {
-        t_decay_ = 2;
-      } else {
-        std::cerr << "Error!\n";
-        throw;
+      if (table.n_partons > 1) {
+        t_njets_ = partons;
+        t_wt_ = eventInfo->weight_defined(table.weight) ? eventInfo->weight(table.weight) : 1.;
+        if (t_gen_info_) t_gen_info_->Fill();
       }
-
-      // unsigned gen_match_1 = MCOrigin2UInt(event->Get<ic::mcorigin>("gen_match_1"));
-      bool is_ztt = (t_decay_ == 2);
-      // if(gen_match_1 < 3) is_ztt=false;
-      if (partons == 0 && gen_mll > 150 && is_ztt) eventInfo->set_weight("dysoup",zw0hi_);
-      if (partons == 1 && gen_mll <= 150) eventInfo->set_weight("dysoup", zw1lo_);
-      if (partons == 1 && gen_mll > 150 && !is_ztt) eventInfo->set_weight("dysoup", zw1lo_);
-      if (partons == 1 && gen_mll > 150 && is_ztt) eventInfo->set_weight("dysoup", zw1hi_);
-      if (partons == 2 && gen_mll <= 150) eventInfo->set_weight("dysoup", zw2lo_);
-      if (partons == 2 && gen_mll > 150 && !is_ztt) eventInfo->set_weight("dysoup", zw2lo_);
-      if (partons == 2 && gen_mll > 150 && is_ztt) eventInfo->set_weight("dysoup", zw2hi_);
-      if (partons == 3 && gen_mll <= 150) eventInfo->set_weight("dysoup", zw3lo_);
-      if (partons == 3 && gen_mll > 150 && !is_ztt) eventInfo->set_weight("dysoup", zw3lo_);
-      if (partons == 3 && gen_mll > 150 && is_ztt) eventInfo->set_weight("dysoup", zw3hi_);
-      if (partons == 4 && gen_mll <= 150) eventInfo->set_weight("dysoup", zw4lo_);
-      if (partons == 4 && gen_mll > 150 && !is_ztt) eventInfo->set_weight("dysoup", zw4lo_);
-      if (partons == 4 && gen_mll > 150 && is_ztt) eventInfo->set_weight("dysoup", zw4hi_);
-      t_wt_ = eventInfo->weight_defined("dysoup") ? eventInfo->weight("dysoup") : 1.;
-      if(fs_) t_gen_info_->Fill();
     }
 
-   if (do_w_soup_htbinned_){
-     double gen_ht = eventInfo->gen_ht() ;
-     if (100 <= gen_ht&&gen_ht <200) eventInfo->set_weight("wsoup", w1_);
-     if (200 <= gen_ht&&gen_ht <400) eventInfo->set_weight("wsoup", w2_);
-     if (400 <= gen_ht &&gen_ht<600) eventInfo->set_weight("wsoup", w3_);
-     if (gen_ht >= 600) eventInfo->set_weight("wsoup", w4_);
-   }
-
-
-   if (do_dy_soup_htbinned_){
-     double gen_ht = eventInfo->gen_ht() ;
-     if (100 <= gen_ht&&gen_ht <200) eventInfo->set_weight("dysoup", zw1_);
-     if (200 <= gen_ht&&gen_ht <400) eventInfo->set_weight("dysoup", zw2_);
-     if (400 <= gen_ht &&gen_ht<600) eventInfo->set_weight("dysoup", zw3_);
-     if (gen_ht >= 600) eventInfo->set_weight("dysoup", zw4_);
-   }
-
     return 0;
   }
 
@@ -456,4 +381,43 @@ namespace ic {
     wxs4_ = wxs4;
   }
 
+  static void ReadSoupParams(Json::Value const& params, std::vector<std::string> const& samples,
+                             std::vector<double> & xs, std::vector<double> & evt) {
+    if (samples.size() != 5) {
+      throw std::runtime_error("[HTTStitching] Need the inclusive and four binned samples");
+    }
+    for (auto const& sample : samples) {
+      if (!params.isMember(sample) || !params[sample].isMember("xs") || !params[sample].isMember("evt")) {
+        throw std::runtime_error("[HTTStitching] No xs and evt for sample " + sample);
+      }
+      xs.push_back(params[sample]["xs"].asDouble());
+      evt.push_back(params[sample]["evt"].asDouble());
+    }
+  }
+
+  void HTTStitching::SetWInputsFromParams(Json::Value const& params, std::vector<std::string> const& samples) {
+    std::vector<double> xs, evt;
+    ReadSoupParams(params, samples, xs, evt);
+    SetWInputCrossSections(xs[0], xs[1], xs[2], xs[3], xs[4]);
+    SetWInputYields(evt[0], evt[1], evt[2], evt[3], evt[4]);
+  }
+
+  void HTTStitching::SetDYInputsFromParams(Json::Value const& params, std::vector<std::string> const& samples) {
+    std::vector<double> xs, evt;
+    ReadSoupParams(params, samples, xs, evt);
+    SetDYInputCrossSections(xs[0], xs[1], xs[2], xs[3], xs[4]);
+    SetDYInputYields(evt[0], evt[1], evt[2], evt[3], evt[4]);
+  }
+
+  double HTTStitching::StitchingWeight(std::string const& weight, unsigned partons, double ht,
+                                       double mll, bool is_ztt) const {
+    double result = -1.;
+    for (auto const& table : tables_) {
+      if (table.weight != weight || (table.n_partons > 1 && partons >= table.n_partons)) continue;
+      double wt = table.values[table.Index(partons, ht, mll > 150 && is_ztt)];
+      if (wt >= 0.) result = wt;
+    }
+    return result;
+  }
+
 }
@@ -6,6 +6,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Tau.hh"
 #include "UserCode/ICHiggsTauTau/interface/EventInfo.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/BTagWeight.h"
 #include "TMath.h"
@@ -110,6 +111,25 @@ namespace ic {
     std::cout << "-------------------------------------" << std::endl;
     std::cout << "HTTWeights" << std::endl;
     std::cout << "-------------------------------------" << std::endl;
+    ggh_handle_                = EventInfo::weight_handle("ggh");
+    wt_embedding_handle_       = EventInfo::weight_handle("wt_embedding");
+    wt_stitching_handle_       = EventInfo::weight_handle("wt_stitching");
+    wt_embedding_yield_handle_ = EventInfo::weight_handle("wt_embedding_yield");
+    topquark_weight_handle_    = EventInfo::weight_handle("topquark_weight");
+    tau_fake_weight_handle_    = EventInfo::weight_handle("tau_fake_weight");
+    wt_tau_id_sf_handle_       = EventInfo::weight_handle("wt_tau_id_sf");
+    jeteta_weight_handle_      = EventInfo::weight_handle("jeteta_weight");
+    wt_zpt_handle_             = EventInfo::weight_handle("wt_zpt");
+    wt_z_handle_               = EventInfo::weight_handle("wt_z");
+    wt_tracking_eff_handle_    = EventInfo::weight_handle("wt_tracking_eff");
+    filter_eff_handle_         = EventInfo::weight_handle("filter_eff");
+    lepton_handle_             = EventInfo::weight_handle("lepton");
+    tt_muon_weight_handle_     = EventInfo::weight_handle("tt_muon_weight");
+    emu_e_fakerate_handle_     = EventInfo::weight_handle("emu_e_fakerate");
+    emu_m_fakerate_handle_     = EventInfo::weight_handle("emu_m_fakerate");
+    etau_fakerate_handle_      = EventInfo::weight_handle("etau_fakerate");
+    mtau_fakerate_handle_      = EventInfo::weight_handle("mtau_fakerate");
+    tau_mode_scale_handle_     = EventInfo::weight_handle("tau_mode_scale");
     std::cout << boost::format(param_fmt()) % "channel"             % Channel2String(channel_);
     std::cout << boost::format(param_fmt()) % "era"                 % Era2String(era_);
     std::cout << boost::format(param_fmt()) % "mc"                  % MC2String(mc_);
@@ -695,7 +715,7 @@ namespace ic {
         pt_weight =  ggh_hist_->GetBinContent(fbin);
         //std::cout << "pt: " << h_pt << "\tweight: " <<  pt_weight << std::endl;
       }
-      eventInfo->set_weight("ggh", pt_weight);
+      eventInfo->set_weight(ggh_handle_, pt_weight);
       if (mc_ == mc::summer12_53X || mc_ == mc::fall11_42X) {
         double weight_up   = ggh_hist_up_->GetBinContent(fbin)   / pt_weight;
         double weight_down = ggh_hist_down_->GetBinContent(fbin) / pt_weight;
@@ -719,10 +739,10 @@ namespace ic {
       } else if(channel_==channel::zmm){
         wt_stitching = ((run >= 272007) && (run < 275657))*(1.0/0.902)+((run >= 275657) && (run < 276315))*(1.0/0.910)+((run >= 276315) && (run < 276831))*(1.0/0.954)+((run >= 276831) && (run < 277772))*(1.0/0.946)+((run >= 277772) && (run < 278820))*(1.0/0.942)+((run >= 278820) && (run < 280919))*(1.0/0.855)+((run >= 280919) && (run < 284045))*(1.0/0.876);  
       }
-      if(eventInfo->weight_defined("wt_embedding")) {
-        if (eventInfo->weight("wt_embedding") > 1) wt_stitching = 0.0; // have to exclude unphysical events i/e where the generator weight is > 1
+      if(eventInfo->weight_defined(wt_embedding_handle_)) {
+        if (eventInfo->weight(wt_embedding_handle_) > 1) wt_stitching = 0.0; // have to exclude unphysical events i/e where the generator weight is > 1
       }
-      if(era_==era::data_2016) eventInfo->set_weight("wt_stitching", wt_stitching);
+      if(era_==era::data_2016) eventInfo->set_weight(wt_stitching_handle_, wt_stitching);
       double gen_match_undecayed_1_pt = event->Get<double>("gen_match_undecayed_1_pt");
       double gen_match_undecayed_2_pt = event->Get<double>("gen_match_undecayed_2_pt");
       double gen_match_undecayed_1_eta = event->Get<double>("gen_match_undecayed_1_eta");
@@ -744,7 +764,7 @@ namespace ic {
       //if(channel_==channel::em) wt_embedding_yield = 1.2101;
       //if(channel_==channel::tt) wt_embedding_yield = 1.2005;
       event->Add("wt_embed_mc_yield",1.13/wt_embedding_yield); 
-      eventInfo->set_weight("wt_embedding_yield", wt_embedding_yield);
+      eventInfo->set_weight(wt_embedding_yield_handle_, wt_embedding_yield);
     }
 
     if (do_topquark_weights_) {
@@ -782,7 +802,7 @@ namespace ic {
       top_wt_down = 1.0;
       event->Add("wt_tquark_up", top_wt_up / top_wt);
       event->Add("wt_tquark_down", top_wt_down / top_wt);
-      eventInfo->set_weight("topquark_weight", top_wt);
+      eventInfo->set_weight(topquark_weight_handle_, top_wt);
     }
     
     if (do_tau_fake_weights_){
@@ -790,7 +810,7 @@ namespace ic {
         Tau const* tau = dynamic_cast<Tau const*>(dilepton[0]->GetCandidate("lepton2"));
         double fake_pt = tau->pt() < 200. ? tau->pt() : 200.;
         double fake_weight = tau_fake_weights_->Eval(fake_pt);
-        eventInfo->set_weight("tau_fake_weight",fake_weight);
+        eventInfo->set_weight(tau_fake_weight_handle_,fake_weight);
         double weight_up   = (fake_weight + 0.5*(1.0-fake_weight)) / fake_weight;
         double weight_down = (fake_weight - 0.5*(1.0-fake_weight)) / fake_weight;
         event->Add("wt_tau_fake_up", weight_up);
@@ -829,8 +849,7 @@ namespace ic {
     if (do_tau_id_weights_) {
       if(era_ != era::data_2015 && era_!=era::data_2016 && era_ != era::data_2017){
         std::vector<Candidate *> tau = { (dilepton[0]->GetCandidate("lepton2")) };
-        std::vector<GenParticle *> const& particles = event->GetPtrVec<GenParticle>(gen_tau_collection_);
-        std::vector<GenJet> gen_taus = BuildTauJets(particles, false,false);
+        std::vector<GenJet> gen_taus = GenGraph::Get(event, gen_tau_collection_).TauJets(false, false);
         std::vector<GenJet *> gen_taus_ptr;
         for (auto & x : gen_taus) gen_taus_ptr.push_back(&x);
         std::vector<std::pair<Candidate*, GenJet*> > matches = MatchByDR(tau, gen_taus_ptr, 0.5, true, true);
@@ -983,7 +1002,7 @@ namespace ic {
         event->Add("wt_tau2_id_tight",tight_tau_sf_2/(tau_sf_2));
         event->Add("wt_tau2_id_vtight",vtight_tau_sf_2/(tau_sf_2));
       }
-     eventInfo->set_weight("wt_tau_id_sf",tau_sf_1*tau_sf_2);
+     eventInfo->set_weight(wt_tau_id_sf_handle_,tau_sf_1*tau_sf_2);
     }
     if (do_em_qcd_weights_){
       if(channel_ == channel::em){
@@ -1119,7 +1138,7 @@ namespace ic {
         if (eta >= 1.6 && eta < 2.0)               { wt = 1.07689347695; }
         if (eta >= 2.0)                            { wt = 1.13656881923; }
       }
-      eventInfo->set_weight("jeteta_weight", wt);
+      eventInfo->set_weight(jeteta_weight_handle_, wt);
     }
     
     if (do_top_factors_) {
@@ -1155,7 +1174,7 @@ namespace ic {
           double wtzpt = z_pt_mass_hist_->GetBinContent(z_pt_mass_hist_->FindBin(zmass,zpt));
           double wtzpt_down=1.0;
           double wtzpt_up = wtzpt*wtzpt;
-          eventInfo->set_weight("wt_zpt",wtzpt);
+          eventInfo->set_weight(wt_zpt_handle_,wtzpt);
           event->Add("wt_zpt_up",wtzpt_up/wtzpt);
           event->Add("wt_zpt_down",wtzpt_down/wtzpt);
       } else if(mc_ == mc::summer16_80X && strategy_== strategy::mssmsummer16){
@@ -1174,7 +1193,7 @@ namespace ic {
         
         double wtzpt_down=1.0;
         double wtzpt_up = wtzpt*wtzpt;
-        eventInfo->set_weight("wt_zpt",wtzpt);
+        eventInfo->set_weight(wt_zpt_handle_,wtzpt);
         event->Add("wt_zpt_up",wtzpt_up/wtzpt);
         event->Add("wt_zpt_down",wtzpt_down/wtzpt);
         event->Add("wt_zpt_stat_m400pt0_up"    , m400pt0_up  /wtzpt);
@@ -1192,7 +1211,7 @@ namespace ic {
         double wtzpt = fns_["zpt_weight_nom"]->eval(args.data());
         double wtzpt_down=1.0;
         double wtzpt_up = wtzpt*wtzpt;
-        eventInfo->set_weight("wt_zpt",wtzpt);
+        eventInfo->set_weight(wt_zpt_handle_,wtzpt);
         event->Add("wt_zpt_up",wtzpt_up/wtzpt);
         event->Add("wt_zpt_down",wtzpt_down/wtzpt);
       }
@@ -1263,7 +1282,7 @@ namespace ic {
           }
         }
       }
-      eventInfo->set_weight("wt_z",wt_z);
+      eventInfo->set_weight(wt_z_handle_,wt_z);
       event->Add("wt_z_mjj", wt_z_mjj);
       event->Add("wt_z_up", wt_z_mjj_up/wt_z_mjj);
       event->Add("wt_z_down", wt_z_mjj_down/wt_z_mjj);
@@ -1310,7 +1329,7 @@ namespace ic {
       }
       event->Add("trackingweight_1",tracking_wt_1);
       event->Add("trackingweight_2",tracking_wt_2);
-      eventInfo->set_weight("wt_tracking_eff",tracking_wt_1*tracking_wt_2);
+      eventInfo->set_weight(wt_tracking_eff_handle_,tracking_wt_1*tracking_wt_2);
     }
          
 
@@ -2140,7 +2159,7 @@ namespace ic {
         //trigweight_1 is actually the full trigger weight because of the way the efficiencies are combined
         event->Add("trigweight_1", e_trg);
         event->Add("trigweight_2", double(1.0));
-        if(mc_==mc::summer16_80X) eventInfo->set_weight("filter_eff",double(0.979));
+        if(mc_==mc::summer16_80X) eventInfo->set_weight(filter_eff_handle_,double(0.979));
        } else if (mc_ == mc::mc2017) {
         if (trg_applied_in_mc_){
           e_trg = (m_trg_23*e_trg_12 + m_trg_8*e_trg_23 - m_trg_23*e_trg_23)/(m_trg_23_mc*e_trg_12_mc + m_trg_8_mc*e_trg_23_mc - m_trg_23_mc*e_trg_23_mc);
@@ -2150,7 +2169,7 @@ namespace ic {
         //trigweight_1 is actually the full trigger weight because of the way the efficiencies are combined
         event->Add("trigweight_1", e_trg);
         event->Add("trigweight_2", double(1.0));
-        //eventInfo->set_weight("filter_eff",double(0.979));
+        //eventInfo->set_weight(filter_eff_handle_,double(0.979));
 
        }
       } else if (channel_ == channel::tt){
@@ -3263,7 +3282,7 @@ namespace ic {
         event->Add("isoweight_2", double(1.0));
        }
     }
-    eventInfo->set_weight("lepton", weight);
+    eventInfo->set_weight(lepton_handle_, weight);
 
 
     if (do_tt_muon_weights_) {
@@ -3317,7 +3336,7 @@ namespace ic {
         if (m_pt > 75.0 && m_pt <= 100.0) m_wt = 1.056;
         if (m_pt > 100.0)                 m_wt = 1.056;
       }
-      eventInfo->set_weight("tt_muon_weight", m_wt);
+      eventInfo->set_weight(tt_muon_weight_handle_, m_wt);
     }
 
 
@@ -3332,7 +3351,7 @@ namespace ic {
       double elefakerate = eleprob/(1.0 - eleprob);
       //double elefakerate_errlow = ElectronFakeRateHist_PtEta->GetError(elefopt,fabs(elec->eta()),mithep::TH2DAsymErr::kStatErrLow)/pow((1-ElectronFakeRateHist_PtEta->GetError(elefopt,fabs(elec->eta()),mithep::TH2DAsymErr::kStatErrLow)),2);
       //double elefakerate_errhigh = ElectronFakeRateHist_PtEta->GetError(elefopt,fabs(elec->eta()),mithep::TH2DAsymErr::kStatErrHigh)/pow((1-ElectronFakeRateHist_PtEta->GetError(elefopt,fabs(elec->eta()),mithep::TH2DAsymErr::kStatErrHigh)),2);
-      eventInfo->set_weight("emu_e_fakerate", elefakerate);
+      eventInfo->set_weight(emu_e_fakerate_handle_, elefakerate);
     }
 
     if (do_emu_m_fakerates_) {
@@ -3346,7 +3365,7 @@ namespace ic {
       double mufakerate = muprob/(1.0 - muprob);
       //double mufakerate_errlow = MuonFakeRateHist_PtEta->GetError(mufopt,fabs(muon->eta()),mithep::TH2DAsymErr::kStatErrLow)/pow((1-MuonFakeRateHist_PtEta->GetError(mufopt,fabs(muon->eta()),mithep::TH2DAsymErr::kStatErrLow)),2);
       //double mufakerate_errhigh = MuonFakeRateHist_PtEta->GetError(mufopt,fabs(muon->eta()),mithep::TH2DAsymErr::kStatErrHigh)/pow((1-MuonFakeRateHist_PtEta->GetError(mufopt,fabs(muon->eta()),mithep::TH2DAsymErr::kStatErrHigh)),2);
-      eventInfo->set_weight("emu_m_fakerate", mufakerate);
+      eventInfo->set_weight(emu_m_fakerate_handle_, mufakerate);
     }
 
     if (do_etau_fakerate_ && era_!=era::data_2015 && era_!=era::data_2016 && era_ != era::data_2017) {
@@ -3365,20 +3384,20 @@ namespace ic {
       if (matches.size() > 0) {
         if (mc_ == mc::fall11_42X) {
           if (fabs(tau_cand[0]->eta()) < 1.5) {
-            if (tau->decay_mode() == 0) eventInfo->set_weight("etau_fakerate", 1.142);
-            if (tau->decay_mode() == 1) eventInfo->set_weight("etau_fakerate", 1.617);
+            if (tau->decay_mode() == 0) eventInfo->set_weight(etau_fakerate_handle_, 1.142);
+            if (tau->decay_mode() == 1) eventInfo->set_weight(etau_fakerate_handle_, 1.617);
           } else {
-            if (tau->decay_mode() == 0) eventInfo->set_weight("etau_fakerate", 0.859);
-            if (tau->decay_mode() == 1) eventInfo->set_weight("etau_fakerate", 0.610);
+            if (tau->decay_mode() == 0) eventInfo->set_weight(etau_fakerate_handle_, 0.859);
+            if (tau->decay_mode() == 1) eventInfo->set_weight(etau_fakerate_handle_, 0.610);
           }
         } else {
           if (era_ == era::data_2012_rereco) {
             if (fabs(tau_cand[0]->eta()) < 1.5) {
-              if (tau->decay_mode() == 0) eventInfo->set_weight("etau_fakerate", 1.37);
-              if (tau->decay_mode() == 1) eventInfo->set_weight("etau_fakerate", 2.18);
+              if (tau->decay_mode() == 0) eventInfo->set_weight(etau_fakerate_handle_, 1.37);
+              if (tau->decay_mode() == 1) eventInfo->set_weight(etau_fakerate_handle_, 2.18);
             } else {
-              if (tau->decay_mode() == 0) eventInfo->set_weight("etau_fakerate", 1.11);
-              if (tau->decay_mode() == 1) eventInfo->set_weight("etau_fakerate", 0.47);
+              if (tau->decay_mode() == 0) eventInfo->set_weight(etau_fakerate_handle_, 1.11);
+              if (tau->decay_mode() == 1) eventInfo->set_weight(etau_fakerate_handle_, 0.47);
             }
           }
         }
@@ -3490,12 +3509,12 @@ namespace ic {
           }
         }
       }
-     eventInfo->set_weight("etau_fakerate",etau_fakerate_1*etau_fakerate_2);
+     eventInfo->set_weight(etau_fakerate_handle_,etau_fakerate_1*etau_fakerate_2);
     }
     if (do_etau_fakerate_ && era_==era::data_2017) {
       double etau_fakerate_1 = 1.0;
       double etau_fakerate_2 = 1.0;
-      eventInfo->set_weight("etau_fakerate",etau_fakerate_1*etau_fakerate_2);
+      eventInfo->set_weight(etau_fakerate_handle_,etau_fakerate_1*etau_fakerate_2);
     }
 
     if (do_mtau_fakerate_ && era_!=era::data_2016 && era_ != era::data_2017) {
@@ -3508,7 +3527,7 @@ namespace ic {
       std::vector<std::pair<Candidate*, GenParticle*> > matches = MatchByDR(tau_cand, parts, 0.5, true, true);
       //We didnt use this for any of 2011 or 2012 in the end, just leaving the code here with a weight of 1 for now.
       if (matches.size() > 0) {
-       eventInfo->set_weight("mtau_fakerate", 1.00);
+       eventInfo->set_weight(mtau_fakerate_handle_, 1.00);
       }
     }
    
@@ -3707,19 +3726,19 @@ namespace ic {
           }
         }
       }
-     eventInfo->set_weight("mtau_fakerate",mtau_fakerate_1*mtau_fakerate_2);
+     eventInfo->set_weight(mtau_fakerate_handle_,mtau_fakerate_1*mtau_fakerate_2);
     }
     if (do_mtau_fakerate_ && era_==era::data_2017) {
       double mtau_fakerate_1 = 1.0;
       double mtau_fakerate_2 = 1.0;  
-      eventInfo->set_weight("mtau_fakerate",mtau_fakerate_1*mtau_fakerate_2);
+      eventInfo->set_weight(mtau_fakerate_handle_,mtau_fakerate_1*mtau_fakerate_2);
     }
 
 
     if (do_tau_mode_scale_) {
       Tau const* tau = dynamic_cast<Tau const*>(dilepton[0]->GetCandidate("lepton2"));
       if (tau->decay_mode() == 0 && era_ == era::data_2012_rereco) {
-        eventInfo->set_weight("tau_mode_scale", 0.88);
+        eventInfo->set_weight(tau_mode_scale_handle_, 0.88);
       }
     }
 
@@ -5,7 +5,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Met.hh"
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/Muon.hh"
-#include "TMVA/Reader.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
 #include "Math/VectorUtil.h"
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
@@ -30,9 +30,9 @@ namespace ic {
     std::cout << "-------------------------------------" << std::endl;    
     std::cout << boost::format(param_fmt()) % "jets_label"  % jets_label_;
     std::cout << boost::format(param_fmt()) % "regression_mva_file"     % regression_mva_file_;
-    //regression_reader_ = new TMVA::Reader("!Color:!Silent:Error");
-    regression_reader_ = new TMVA::Reader();
-    std::vector<TMVA::Reader *> readers = {regression_reader_};
+    //regression_reader_ = new MVAReader("!Color:!Silent:Error");
+    regression_reader_ = new MVAReader();
+    std::vector<MVAReader *> readers = {regression_reader_};
     for (auto & reader : readers) {
 	  reader->AddVariable("jetBtag", &prebjet_bcsv );
 	  reader->AddVariable("jetPt", &prebjet_pt );
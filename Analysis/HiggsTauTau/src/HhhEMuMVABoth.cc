@@ -5,7 +5,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Met.hh"
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/Muon.hh"
-#include "TMVA/Reader.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
 #include "Math/VectorUtil.h"
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
@@ -37,9 +37,9 @@ namespace ic {
 		std::cout << boost::format(param_fmt()) % "met_label"       % met_label_;
 		std::cout << boost::format(param_fmt()) % "gf_mva_file"     % gf_mva_file_bdt_;
 		std::cout << boost::format(param_fmt()) % "gf_mva_file_2"    % gf_mva_file_bdtg_;
-		gf_reader_bdt_ = new TMVA::Reader("!Color:!Silent:Error");
-		gf_reader_bdtg_ = new TMVA::Reader("!Color:!Silent:Error");
-		std::vector<TMVA::Reader *> readers = {gf_reader_bdt_,gf_reader_bdtg_};
+		gf_reader_bdt_ = new MVAReader("!Color:!Silent:Error");
+		gf_reader_bdtg_ = new MVAReader("!Color:!Silent:Error");
+		std::vector<MVAReader *> readers = {gf_reader_bdt_,gf_reader_bdtg_};
 
 /*		std::vector<std::string> vars;
 		ifstream parafile(mva_input_data_.c_str());
@@ -5,7 +5,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Met.hh"
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/Muon.hh"
-#include "TMVA/Reader.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
 #include "Math/VectorUtil.h"
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
@@ -38,9 +38,9 @@ namespace ic {
     std::cout << boost::format(param_fmt()) % "met_label"       % met_label_;
     std::cout << boost::format(param_fmt()) % "gf_mva_file"     % gf_mva_file_;
     std::cout << boost::format(param_fmt()) % "gf_mva_file_2"    % gf_mva_file_2_;
-    gf_reader_ = new TMVA::Reader("!Color:!Silent:Error");
-    gf_reader_2_ = new TMVA::Reader("!Color:!Silent:Error");
-    std::vector<TMVA::Reader *> readers = {gf_reader_,gf_reader_2_};
+    gf_reader_ = new MVAReader("!Color:!Silent:Error");
+    gf_reader_2_ = new MVAReader("!Color:!Silent:Error");
+    std::vector<MVAReader *> readers = {gf_reader_,gf_reader_2_};
     for (auto & r : readers) {
 			r->AddVariable("met",&fmet_);
 			r->AddVariable("mt_1",&fmt_1_);
@@ -175,8 +175,10 @@ namespace ic {
     return algo.getMass();
   }
 
+*/
+
+#ifdef IC_SVFIT_STANDALONE
   std::pair<Candidate, double> SVFitService::SVFitCandidateEleHad(Candidate const* lep, Candidate const* had, int decm2, Met const* met, bool MC) {
-    svFitStandalone::Vector met_vec(met->vector().px(), met->vector().py(), met->vector().pz());
     TMatrixD covMET(2, 2);
     covMET(0,0) = met->xx_sig();
     covMET(1,0) = met->yx_sig();
@@ -202,7 +204,6 @@ namespace ic {
   }
 
   std::pair<Candidate, double> SVFitService::SVFitCandidateMuHad(Candidate const* lep, Candidate const* had, int decm2, Met const* met, bool MC) {
-    svFitStandalone::Vector met_vec(met->vector().px(), met->vector().py(), met->vector().pz());
     TMatrixD covMET(2, 2);
     covMET(0,0) = met->xx_sig();
     covMET(1,0) = met->yx_sig();
@@ -228,7 +229,6 @@ namespace ic {
 
 
   std::pair<Candidate, double> SVFitService::SVFitCandidateEleMu(Candidate const* lep1, Candidate const* lep2, Met const* met, bool MC) {
-    svFitStandalone::Vector met_vec(met->vector().px(), met->vector().py(), met->vector().pz());
     TMatrixD covMET(2, 2);
     covMET(0,0) = met->xx_sig();
     covMET(1,0) = met->yx_sig();
@@ -254,7 +254,6 @@ namespace ic {
   }
 
   std::pair<Candidate, double> SVFitService::SVFitCandidateHadHad(Candidate const* had1, int decm1, Candidate const* had2, int decm2, Met const* met, bool MC) {
-    svFitStandalone::Vector met_vec(met->vector().px(), met->vector().py(), met->vector().pz());
     TMatrixD covMET(2, 2);
     covMET(0,0) = met->xx_sig();
     covMET(1,0) = met->yx_sig();
@@ -278,7 +277,7 @@ namespace ic {
 
     return std::make_pair(fitresult, algo.getMass());
   }
-*/
+#endif
 
 
 
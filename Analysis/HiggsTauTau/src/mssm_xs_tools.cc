@@ -7,7 +7,10 @@
 #define mssm_xs_tools_cxx
 #include "TH2F.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/mssm_xs_tools.h"
+#include "TKey.h"
 #include <iostream>
+#include <algorithm>
+#include <stdexcept>
 mssm_xs_tools::mssm_xs_tools(){
    std::cout<<"Welcome to the MSSM neutral cross section tool"<<std::endl;
    std::cout<<" Version 0.4 \n by  Monica Vazquez Acosta (Monica.Vazquez.Acosta@cern.ch),\n     Trevor Vickey         (Trevor.Vickey@cern.ch)\n     Markus Warsinsky      (Markus.Warsinsky@cern.ch)\n"<<std::endl;
@@ -197,6 +200,8 @@ void mssm_xs_tools::SetInput(char const* filename){
   m_h_mh = (TH2F*) m_input->Get("h_mh"); 
   m_h_mH = (TH2F*) m_input->Get("h_mH"); 
 
+  BuildGrids();
+
  
   std::cout<<"some info about the setup used for your chosen output file:"<<std::endl;
   TObjString* description=(TObjString*) m_input->Get("description");
@@ -955,3 +960,172 @@ Double_t mssm_xs_tools::GiveXsec_UncDown_Santander_A(Double_t mA, Double_t tanb,
 }
    
   
+
+int mssm_xs_tools::Axis::FindBin(Double_t x) const{
+  int n=edges.size()-1;
+  if (x<edges[0]) return 0;
+  if (!(x<edges[n])) return n+1;
+  if (uniform) return 1+int(n*(x-edges[0])/(edges[n]-edges[0]));
+  return std::upper_bound(edges.begin(),edges.end(),x)-edges.begin();
+}
+
+void mssm_xs_tools::Axis::Bracket(Double_t x, int & lo, int & hi, Double_t & w) const{
+  int n=edges.size()-1;
+  w=0.;
+  if (!(x>Centre(1))) {
+    lo=hi=1;
+  } else if (!(x<Centre(n))) {
+    lo=hi=n;
+  } else {
+    lo=FindBin(x);
+    if (x<Centre(lo)) --lo;
+    hi=lo+1;
+    w=(x-Centre(lo))/(Centre(hi)-Centre(lo));
+  }
+}
+
+void mssm_xs_tools::BuildGrids(){
+  m_grids.clear();
+  m_columns.clear();
+  auto make_axis = [](TAxis const* axis) {
+    Axis res;
+    int n=axis->GetNbins();
+    res.uniform=(axis->GetXbins()->GetSize()==0);
+    for (int i=1; i<=n; ++i) res.edges.push_back(axis->GetBinLowEdge(i));
+    res.edges.push_back(res.uniform ? axis->GetXmax() : axis->GetBinUpEdge(n));
+    return res;
+  };
+  // the histograms in each grid, in column order
+  std::vector<std::vector<TH2F*> > hists;
+  TIter next(m_input->GetListOfKeys());
+  while (TKey* key=(TKey*) next()) {
+    std::string name=key->GetName();
+    if (std::string(key->GetClassName())!="TH2F" || name.compare(0,2,"h_")!=0) continue;
+    // only the highest cycle, which comes first
+    if (m_columns.count(name.substr(2))) continue;
+    TH2F* h=(TH2F*) m_input->Get(name.c_str());
+    Axis x=make_axis(h->GetXaxis());
+    Axis y=make_axis(h->GetYaxis());
+    unsigned g=0;
+    while (g<m_grids.size() && (m_grids[g].x.edges!=x.edges || m_grids[g].y.edges!=y.edges)) ++g;
+    if (g==m_grids.size()) {
+      m_grids.push_back(Grid());
+      m_grids[g].x=x;
+      m_grids[g].y=y;
+      hists.push_back(std::vector<TH2F*>());
+    }
+    m_columns[name.substr(2)]=std::make_pair(g, unsigned(hists[g].size()));
+    hists[g].push_back(h);
+  }
+  for (unsigned g=0; g<m_grids.size(); ++g) {
+    Grid & grid=m_grids[g];
+    unsigned n_cells=(grid.x.edges.size()+1)*(grid.y.edges.size()+1);
+    grid.n_columns=hists[g].size();
+    grid.table.resize(n_cells*grid.n_columns);
+    for (unsigned c=0; c<n_cells; ++c) {
+      for (unsigned k=0; k<grid.n_columns; ++k) {
+        grid.table[c*grid.n_columns+k]=hists[g][k]->GetBinContent(c);
+      }
+    }
+  }
+}
+
+std::vector<std::string> mssm_xs_tools::Give_Quantities() const{
+  std::vector<std::string> names;
+  for (auto const& it : m_columns) names.push_back(it.first);
+  return names;
+}
+
+void mssm_xs_tools::Give_Values(std::vector<std::string> const& names,
+                                std::vector<Double_t> const& mA, std::vector<Double_t> const& tanb,
+                                std::vector<Double_t> & values, bool interpolate) const{
+  if (mA.size()!=tanb.size()) {
+    throw std::runtime_error("mssm_xs_tools: mA and tanb have different sizes");
+  }
+  unsigned n_q=names.size();
+  std::vector<std::pair<unsigned, unsigned> > columns(n_q);
+  for (unsigned q=0; q<n_q; ++q) {
+    auto it=m_columns.find(names[q]);
+    if (it==m_columns.end()) {
+      throw std::runtime_error("mssm_xs_tools: no histogram h_"+names[q]+" in the input file");
+    }
+    columns[q]=it->second;
+  }
+  values.resize(mA.size()*n_q);
+  // the cells and weights at the current point, for each grid it is needed in
+  std::vector<unsigned> point(m_grids.size(), 0);
+  std::vector<std::vector<unsigned> > cells(m_grids.size(), std::vector<unsigned>(4));
+  std::vector<std::vector<Double_t> > weights(m_grids.size(), std::vector<Double_t>(4));
+  for (unsigned p=0; p<mA.size(); ++p) {
+    for (unsigned q=0; q<n_q; ++q) {
+      unsigned g=columns[q].first;
+      Grid const& grid=m_grids[g];
+      unsigned row=grid.x.edges.size()+1;
+      if (point[g]!=p+1) {
+        point[g]=p+1;
+        if (!interpolate) {
+          cells[g][0]=grid.x.FindBin(mA[p])+row*grid.y.FindBin(tanb[p]);
+        } else {
+          int xlo, xhi, ylo, yhi;
+          Double_t wx, wy;
+          grid.x.Bracket(mA[p], xlo, xhi, wx);
+          grid.y.Bracket(tanb[p], ylo, yhi, wy);
+          cells[g][0]=xlo+row*ylo;
+          cells[g][1]=xhi+row*ylo;
+          cells[g][2]=xlo+row*yhi;
+          cells[g][3]=xhi+row*yhi;
+          weights[g][0]=(1.-wx)*(1.-wy);
+          weights[g][1]=wx*(1.-wy);
+          weights[g][2]=(1.-wx)*wy;
+          weights[g][3]=wx*wy;
+        }
+      }
+      unsigned n=grid.n_columns;
+      unsigned k=columns[q].second;
+      if (!interpolate) {
+        values[p*n_q+q]=grid.table[cells[g][0]*n+k];
+      } else {
+        Double_t sum=0.;
+        for (unsigned i=0; i<4; ++i) sum+=weights[g][i]*grid.table[cells[g][i]*n+k];
+        values[p*n_q+q]=sum;
+      }
+    }
+  }
+}
+
+void mssm_xs_tools::Give_XsecBR(std::vector<std::string> const& productions, std::string const& decay,
+                                std::vector<Double_t> const& mA, std::vector<Double_t> const& tanb,
+                                std::vector<Double_t> & values, bool interpolate) const{
+  static const char* bosons[3]={"h", "H", "A"};
+  // the factor from the units of each production's histograms to fb, as
+  // applied by the single-point accessors: Give_Xsec_ggF*, Give_Xsec_bb*5f,
+  // Give_Xsec_bb*4f and Give_Xsec_ggFplusbb*5f
+  static const std::map<std::string, Double_t> to_fb={
+    {"ggF", 1000.}, {"bbH", 1.}, {"bbH4f", 1.}, {"ggFplusbbH", 1000.}};
+  unsigned n_prod=productions.size();
+  std::vector<Double_t> scale(n_prod);
+  for (unsigned i=0; i<n_prod; ++i) {
+    auto it=to_fb.find(productions[i]);
+    if (it==to_fb.end()) {
+      throw std::runtime_error("[mssm_xs_tools] Units of production "+productions[i]+" are not known");
+    }
+    scale[i]=it->second;
+  }
+  // the xsections of each production, then the BRs
+  std::vector<std::string> names;
+  for (unsigned i=0; i<n_prod; ++i) {
+    for (unsigned j=0; j<3; ++j) names.push_back(productions[i]+"_xsec_"+bosons[j]);
+  }
+  for (unsigned j=0; j<3; ++j) names.push_back("br"+decay+"_"+bosons[j]);
+  std::vector<Double_t> res;
+  Give_Values(names, mA, tanb, res, interpolate);
+  unsigned n_q=names.size();
+  values.resize(mA.size()*n_prod*3);
+  for (unsigned p=0; p<mA.size(); ++p) {
+    for (unsigned i=0; i<n_prod; ++i) {
+      for (unsigned j=0; j<3; ++j) {
+        values[(p*n_prod+i)*3+j]=scale[i]*res[p*n_q+i*3+j]*res[p*n_q+n_prod*3+j];
+      }
+    }
+  }
+}
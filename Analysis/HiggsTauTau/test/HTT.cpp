@@ -3,6 +3,10 @@
 #include <string>
 #include <fstream>
 #include <map>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <cstdio>
 // #include "boost/lexical_cast.hpp"
 #include "boost/algorithm/string.hpp"
 #include "boost/program_options.hpp"
@@ -10,6 +14,7 @@
 // #include "boost/function.hpp"
 // #include "boost/format.hpp"
 #include "TSystem.h"
+#include "TROOT.h"
 #include "Utilities/interface/json.h"
 #include "UserCode/ICHiggsTauTau/interface/Electron.hh"
 #include "UserCode/ICHiggsTauTau/interface/CompositeCandidate.hh"
@@ -24,8 +29,11 @@
 // #include "Modules/interface/OverlapFilter.h"
 // #include "Modules/interface/CheckEvents.h"
 #include "Modules/interface/CompositeProducer.h"
+#include "Modules/interface/LumiMask.h"
+#include "Utilities/interface/EventIndex.h"
 #include "HiggsTauTau/interface/HTTSequence.h"
 #include "HiggsTauTau/interface/HTTConfig.h"
+#include "HiggsTauTau/interface/HTTJobConfig.h"
 
 // using boost::lexical_cast;
 // using boost::bind;
@@ -48,49 +56,99 @@ int main(int argc, char* argv[]) {
   vector<string> cfgs;
   vector<string> jsons;
   vector<string> flatjsons;
+  string compile_output;
+  string compiled_input;
   unsigned offset;
   unsigned nlines;
+  string job_plan;
+  unsigned job;
+  string checkpoint;
+  unsigned checkpoint_events;
+  string pick_events;
+  string event_index;
 
+  // A job config can be resolved and validated once with --compile, and the
+  // output given to each job with --compiled instead of --cfg etc.
   po::options_description config("config");
   config.add_options()
       ("offset", po::value<unsigned>(&offset)->default_value(0))
-      ("nlines", po::value<unsigned>(&nlines)->default_value(0))(
-      "cfg", po::value<vector<string>>(&cfgs)->multitoken()->required(),
+      ("nlines", po::value<unsigned>(&nlines)->default_value(0))
+      ("job_plan", po::value<string>(&job_plan)->default_value(""),
+       "entry ranges of each job, written by python/jobs.py")
+      ("job", po::value<unsigned>(&job)->default_value(0),
+       "the job of the --job_plan to run")
+      ("checkpoint", po::value<string>(&checkpoint)->default_value(""),
+       "save the progress of the job to this file, and resume from it if it exists")
+      ("checkpoint_events", po::value<unsigned>(&checkpoint_events)->default_value(100000),
+       "events between checkpoints")
+      ("pick_events", po::value<string>(&pick_events)->default_value(""),
+       "only process the events in this file, one run:lumi:event per line")
+      ("event_index", po::value<string>(&event_index)->default_value(""),
+       "event index of the input files for --pick_events, built if it doesn't exist")(
+      "cfg", po::value<vector<string>>(&cfgs)->multitoken(),
       "json config files")(
       "json", po::value<vector<string>>(&jsons)->multitoken(),
       "json fragments")(
       "flatjson", po::value<vector<string>>(&flatjsons)->multitoken(),
-      "json flat fragments");
+      "json flat fragments")(
+      "compile", po::value<string>(&compile_output)->default_value(""),
+      "validate the config, write it in compiled form to this file and exit")(
+      "compiled", po::value<string>(&compiled_input)->default_value(""),
+      "run from a config written with --compile");
   po::variables_map vm;
   po::store(po::command_line_parser(argc, argv).options(config).run(), vm);
   po::notify(vm);
 
-  Json::Value js_init = ic::ExtractJsonFromFile(cfgs[0]);
-  for (unsigned i = 1; i < cfgs.size(); ++i) {
-    std::cout << ">> Updating config with file " << cfgs[i] << ":\n";
-    Json::Value extra = ic::ExtractJsonFromFile(cfgs[i]);
-    std::cout << extra;
-    ic::UpdateJson(js_init, extra);
-  }
-  for (unsigned i = 0; i < jsons.size(); ++i) {
-    std::vector<std::string> json_strs;
-    Json::Value extra ;
-    Json::Reader reader(Json::Features::all());
-    reader.parse(jsons[i], extra);
-    std::cout << ">> Updating config with fragment:\n";
-    std::cout << extra;
-    ic::UpdateJson(js_init, extra);
-  }
-  for (unsigned i = 0; i < flatjsons.size(); ++i) {
-    Json::Value extra = ic::ExtractJsonFromFlatString(flatjsons[i]);
-    std::cout << ">> Updating config with fragment:\n";
-    std::cout << extra;
-    ic::UpdateJson(js_init, extra);
-  }
+  Json::Value compiled;
+  if (compiled_input != "") {
+    if (cfgs.size() || jsons.size() || flatjsons.size()) {
+      std::cerr << "--compiled cannot be combined with --cfg, --json or --flatjson" << std::endl;
+      return 1;
+    }
+    compiled = ic::ExtractJsonFromBinaryFile(compiled_input);
+    std::cout << ">> Using compiled config " << compiled_input << std::endl;
+  } else {
+    if (cfgs.size() == 0) {
+      std::cerr << "Either --cfg or --compiled is required" << std::endl;
+      return 1;
+    }
+    Json::Value js_init = ic::ExtractJsonFromFile(cfgs[0]);
+    for (unsigned i = 1; i < cfgs.size(); ++i) {
+      std::cout << ">> Updating config with file " << cfgs[i] << ":\n";
+      Json::Value extra = ic::ExtractJsonFromFile(cfgs[i]);
+      std::cout << extra;
+      ic::UpdateJson(js_init, extra);
+    }
+    for (unsigned i = 0; i < jsons.size(); ++i) {
+      std::vector<std::string> json_strs;
+      Json::Value extra ;
+      Json::Reader reader(Json::Features::all());
+      reader.parse(jsons[i], extra);
+      std::cout << ">> Updating config with fragment:\n";
+      std::cout << extra;
+      ic::UpdateJson(js_init, extra);
+    }
+    for (unsigned i = 0; i < flatjsons.size(); ++i) {
+      Json::Value extra = ic::ExtractJsonFromFlatString(flatjsons[i]);
+      std::cout << ">> Updating config with fragment:\n";
+      std::cout << extra;
+      ic::UpdateJson(js_init, extra);
+    }
 
+    vector<string> errors, warnings;
+    compiled = ic::CompileHTTJobConfig(js_init, errors, warnings);
+    for (auto const& w : warnings) std::cout << ">> Config warning: " << w << std::endl;
+    for (auto const& e : errors) std::cerr << ">> Config error: " << e << std::endl;
+    if (compile_output != "") {
+      if (errors.size() > 0) return 1;
+      ic::WriteJsonToBinaryFile(compiled, compile_output);
+      std::cout << ">> Wrote " << compiled["sequences"].size() << " sequences to "
+                << compile_output << std::endl;
+      return 0;
+    }
+  }
 
-  Json::Value const js = js_init;
-  std::string output_folder = "";
+  Json::Value const& js = compiled;
   
 
   /*
@@ -98,7 +156,32 @@ int main(int argc, char* argv[]) {
     declaration. GetPrefixedFilelist(prefix, filelist)
   */
   vector<string> files;
-  if(nlines != 0){
+  vector<int64_t> file_entries;
+  int64_t first_entry = 0;
+  int64_t last_entry = -1;
+  std::string output_suffix = std::to_string(offset);
+  if (job_plan != "") {
+    // The plan splits the entries of the filelist across the jobs, and
+    // replaces the --offset/--nlines file splitting
+    Json::Value plan = ic::ExtractJsonFromFile(job_plan);
+    if (plan["filelist"].asString() != js["job"]["filelist"].asString()) {
+      std::cerr << ">> Job plan " << job_plan << " is for filelist "
+                << plan["filelist"].asString() << std::endl;
+      return 1;
+    }
+    if (nlines != 0 || job >= plan["jobs"].size()) {
+      std::cerr << ">> --job must be one of the " << plan["jobs"].size()
+                << " jobs of the plan, without --nlines" << std::endl;
+      return 1;
+    }
+    for (unsigned i = 0; i < plan["files"].size(); ++i) {
+      files.push_back(plan["files"][i].asString());
+      file_entries.push_back(plan["entries"][i].asInt64());
+    }
+    first_entry = plan["jobs"][job][0].asInt64();
+    last_entry = plan["jobs"][job][1].asInt64();
+    output_suffix = std::to_string(job);
+  } else if(nlines != 0){
     vector<string> files_all = ic::ParseFileLines(js["job"]["filelist"].asString());
     for(unsigned k=0; k<nlines; k++){
       if((offset*nlines)+k < files_all.size()){
@@ -116,63 +199,146 @@ int main(int argc, char* argv[]) {
   analysis.RetryFileAfterFailure(7, 3);
 //  analysis.DoSkimming("./skim/");
   analysis.CalculateTimings(js["job"]["timings"].asBool());
+  // With implicit multi-threading the baskets of an output tree are
+  // compressed and written in parallel when they are flushed
+  if (js["job"]["output_threads"].asUInt() > 0) {
+    ROOT::EnableImplicitMT(js["job"]["output_threads"].asUInt());
+  }
+  if (pick_events != "") {
+    ic::EventIndex index;
+    if (event_index == "" || !index.Load(event_index, files)) {
+      index.Build(files, "icEventProducer/EventTree");
+      if (event_index != "") index.Save(event_index);
+    }
+    analysis.SetPickedEntries(
+        index.PickedEntries(ic::EventIndex::ParseEventList(pick_events)));
+  }
+  if (job_plan != "") {
+    analysis.SetInputEntries(file_entries);
+    analysis.SetEntryRange(first_entry, last_entry);
+  }
   
   std::map<std::string, ic::HTTSequence> seqs;
-  std::vector<std::string> ignore_chans;
 
-  for(unsigned i = 0; i<js["job"]["ignore_channels"].size();++i){
-   ignore_chans.push_back(js["job"]["ignore_channels"][i].asString());
+  // Each attempt at a job writes its own outputs, which are merged into the
+  // outputs of the first attempt when the job completes
+  unsigned segment = 0;
+  if (checkpoint != "") {
+    segment = analysis.SetCheckpoint(checkpoint, checkpoint_events, [&](unsigned number) {
+      for (auto & it : seqs) it.second.Checkpoint(number);
+    });
+  }
+  auto segment_suffix = [&](unsigned k) {
+    return output_suffix + (k > 0 ? "_seg" + std::to_string(k) : "");
+  };
+  // Swaps the suffix of this attempt in an output name for that of attempt k
+  auto segment_output = [&](std::string const& name, unsigned k) {
+    return name.substr(0, name.size() - (segment_suffix(segment) + ".root").size()) +
+           segment_suffix(k) + ".root";
+  };
+  if (js["job"].isMember("output_trees")) {
+    analysis.SetPreLoopFunction([&]() {
+      for (auto & it : seqs) it.second.ConfigureOutputTrees(js["job"]["output_trees"]);
+    });
   }
 
-  std::string output_name = js["sequence"]["output_name"].asString();
-  bool is_data = js["sequence"]["is_data"].asBool();
-  bool is_embedded = js["sequence"]["is_embedded"].asBool();
-  for (unsigned i = 0; i < js["job"]["channels"].size(); ++i) {
-    std::string channel_str = js["job"]["channels"][i].asString();
-
-    if(is_data &&  ( (channel_str.find("em") != channel_str.npos && output_name.find("MuonEG")==output_name.npos && channel_str.find("tpem") == channel_str.npos)|| (channel_str.find("mt") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("et") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tt") != channel_str.npos && output_name.find("Tau") == output_name.npos) || (channel_str.find("zmm") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("tpzmm") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("zee") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tpzee") != channel_str.npos && output_name.find("SingleEle") == output_name.npos ) || (channel_str.find("tpmt") != channel_str.npos && output_name.find("SingleMuon") == output_name.npos ) || (channel_str.find("tpem") != channel_str.npos && output_name.find("SingleEle")==output_name.npos ) )) continue; 
-
-    if(is_embedded &&  ( (channel_str.find("em") != channel_str.npos && output_name.find("EmbeddingElMu")==output_name.npos )|| (channel_str.find("mt") != channel_str.npos && output_name.find("EmbeddingMuTau") == output_name.npos ) || (channel_str.find("et") != channel_str.npos && output_name.find("EmbeddingElTau") == output_name.npos ) || (channel_str.find("tt") != channel_str.npos && output_name.find("EmbeddingTauTau") == output_name.npos) || (channel_str.find("tpzmm") != channel_str.npos && output_name.find("EmbeddingMuMu") == output_name.npos ) ||  (channel_str.find("tpzee") != channel_str.npos && output_name.find("EmbeddingElEl") == output_name.npos ) || (channel_str.find("tpmt") != channel_str.npos && output_name.find("EmbeddingMuTau") == output_name.npos ))) continue; 
+  // The LumiMask of each sequence, if it has one
+  std::vector<ic::LumiMask*> lumi_masks;
 
-    bool ignore_channel =false;
-    bool duplicate_channel = false;
-    for(unsigned k = 0; k<ignore_chans.size();k++){
-      if(ignore_chans.at(k)==channel_str){ignore_channel=true;}
-    }
-    if(ignore_channel){
-      std::cout<<"SKIPPING CHANNEL "<<channel_str<<std::endl;
-      continue;
-    } 
-    for(unsigned k=0;k<js["job"]["channels"].size();++k){
-      if(k!=i&&js["job"]["channels"][k].asString()==js["job"]["channels"][i].asString()){duplicate_channel=true;}
-    }
-    if(duplicate_channel){
-      std::cout<<"Channel "<<js["job"]["channels"][i].asString()<<" sequences already created, skipping"<<std::endl; 
-      continue;
+  for (auto const& entry : js["sequences"]) {
+    std::string seq_str = entry["name"].asString();
+    std::string channel_str = entry["channel"].asString();
+    seqs[seq_str] = ic::HTTSequence(channel_str,segment_suffix(segment),entry["config"]);
+    seqs[seq_str].BuildSequence();
+    ic::HTTSequence::ModuleSequence seq_run = *(seqs[seq_str].getSequence());
+    ic::LumiMask *lumi_mask = nullptr;
+    for (auto m : seq_run) {
+      analysis.AddModule(seq_str, m.get());
+      if (!lumi_mask) lumi_mask = dynamic_cast<ic::LumiMask*>(m.get());
     }
-    std::vector<std::string> vars;
-    for (unsigned j = 0; j < js["job"]["sequences"]["all"].size(); ++j) {
-      vars.push_back(js["job"]["sequences"]["all"][j].asString());
+    lumi_masks.push_back(lumi_mask);
+  }
+
+  // The outputs of the previous attempt may have been saved at the last
+  // checkpoint record or, if it stopped while saving them, the one before.
+  // The job resumes from whichever they all have.
+  if (segment > 0) {
+    std::set<int> saved;
+    for (auto & it : seqs) {
+      std::string name = it.second.getOutputFile();
+      if (name == "") continue;
+      saved.insert(ic::HTTSequence::SavedCheckpoint(segment_output(name, segment - 1)));
     }
-    for (unsigned j = 0; j < js["job"]["sequences"][channel_str].size(); ++j) {
-      vars.push_back(js["job"]["sequences"][channel_str][j].asString());
+    if (saved.count(-1) || saved.size() > 1) {
+      std::cerr << ">> The outputs of the previous attempt were not all saved at "
+                   "the same checkpoint, the job cannot be resumed" << std::endl;
+      return 1;
     }
+    if (saved.size() == 1) analysis.SelectCheckpoint(*saved.begin());
+  }
 
-
-    for (unsigned j = 0; j < vars.size(); ++j) {
-      std::string seq_str = channel_str+"_"+vars[j];
-      Json::Value js_merged = js["sequence"];
-      ic::UpdateJson(js_merged, js["channels"][channel_str]);
-      ic::UpdateJson(js_merged, js["sequences"][vars[j]]);
-      // std::cout << js_merged;
-      seqs[seq_str] = ic::HTTSequence(channel_str,std::to_string(offset),js_merged);
-      seqs[seq_str].BuildSequence();
-      ic::HTTSequence::ModuleSequence seq_run = *(seqs[seq_str].getSequence());
-      for (auto m : seq_run) analysis.AddModule(seq_str, m.get());
+  // Data jobs can apply the lumi mask to each input file before the event
+  // loop and skip the rejected entries entirely. An entry is read if the mask
+  // of any sequence accepts it, so every sequence must have one (MC jobs have
+  // none and are left as they are). Masks writing output jsons must see
+  // every event, so they also turn it off.
+  unsigned n_no_mask = std::count(lumi_masks.begin(), lumi_masks.end(), nullptr);
+  bool output_jsons = std::any_of(lumi_masks.begin(), lumi_masks.end(),
+      [](ic::LumiMask *m) { return m && m->ProducesOutputJsons(); });
+  if (js["job"]["preselect_lumi_mask"].asBool() && n_no_mask < lumi_masks.size()) {
+    if (n_no_mask > 0) {
+      std::cout << ">> preselect_lumi_mask ignored: not every sequence has a LumiMask\n";
+    } else if (output_jsons) {
+      std::cout << ">> preselect_lumi_mask ignored: a LumiMask produces output jsons\n";
+    } else {
+      analysis.SetEntryPreselection([&](TTree *tree) {
+        std::vector<int64_t> entries;
+        for (auto lumi_mask : lumi_masks) {
+          std::vector<int64_t> accepted = lumi_mask->AcceptedEntries(tree);
+          std::vector<int64_t> merged;
+          std::set_union(entries.begin(), entries.end(), accepted.begin(),
+                         accepted.end(), std::back_inserter(merged));
+          entries.swap(merged);
+        }
+        return entries;
+      });
     }
   }
 
   analysis.RunAnalysis();
 
+  if (checkpoint != "") {
+    std::vector<std::vector<std::string>> outputs;
+    for (auto & it : seqs) {
+      std::string name = it.second.getOutputFile();
+      if (name == "") continue;
+      outputs.push_back(std::vector<std::string>());
+      for (unsigned k = 0; k <= segment; ++k) {
+        outputs.back().push_back(segment_output(name, k));
+      }
+    }
+    // Closes the output files
+    seqs.clear();
+    for (auto const& parts : outputs) {
+      if (segment == 0) continue;
+      std::cout << ">> Merging " << parts.size() << " parts of " << parts[0]
+                << std::endl;
+      if (!ic::MergeFiles(parts, parts[0] + ".merge")) {
+        std::cerr << ">> Unable to merge the outputs of " << parts[0] << std::endl;
+        return 1;
+      }
+    }
+    // With the checkpoint gone a restart would begin again, so it's removed
+    // before the first output is replaced
+    std::remove(checkpoint.c_str());
+    for (auto const& parts : outputs) {
+      if (segment > 0) {
+        std::rename((parts[0] + ".merge").c_str(), parts[0].c_str());
+        for (unsigned k = 1; k < parts.size(); ++k) std::remove(parts[k].c_str());
+      }
+      ic::HTTSequence::RemoveCheckpointStamp(parts[0]);
+    }
+  }
+
   return 0;
 }
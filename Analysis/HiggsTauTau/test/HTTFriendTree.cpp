@@ -0,0 +1,591 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <tuple>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "boost/program_options.hpp"
+#include "boost/algorithm/string.hpp"
+#include "boost/functional/hash.hpp"
+#include "boost/format.hpp"
+#include "TFile.h"
+#include "TTree.h"
+#include "TTreeFormula.h"
+#include "TH1.h"
+#include "TStopwatch.h"
+#include "UserCode/ICHiggsTauTau/interface/Candidate.hh"
+#include "UserCode/ICHiggsTauTau/interface/Met.hh"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnRootTools.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnParallel.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/CompiledBDT.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTConfig.h"
+#include "HiggsTauTau/interface/SVFitService.h"
+
+namespace po = boost::program_options;
+
+// Adds SVFit, MELA and MVA variables to trees already written by
+// HTTCategories, as friend trees with one entry per entry of the input tree:
+//
+//   HTTFriendTree --filelist=files.dat --channel=mt --era=data_2016 --svfit=true
+//       --mela_files=mela_outputs.dat --mva="bdt_vbf:weights/vbf.xml"
+//
+// writes X_friend.root next to each input X.root. The friend tree is
+// aligned with the input and also indexed on (run, event), so it can be
+// attached with
+//
+//   ntuple->AddFriend("friend", "X_friend.root");
+//
+// and its branches used as friend.m_sv etc.
+//
+// SVFit needs the inputs that HTTCategories writes with
+// "write_friend_inputs": true. The same event usually appears with
+// identical SVFit inputs in many of the systematic shift files, so the fit
+// is only run once for each distinct (run, lumi, event, objects_hash,
+// inputs) combination across all the input files. The fits are shared out
+// between worker processes, as the SVFit integration is not thread-safe.
+// As in HTTSequence, the 2015-2017 eras use svFitStandalone with the tau
+// decay modes from the tau_decay_mode_1/2 branches, and the Run 1 eras use
+// the legacy SVFit. The former needs a build with SVFIT_STANDALONE=1.
+//
+// MELA itself runs outside this package. With --mela_files the D0 and DCP
+// values in the "mela" output trees that MELATest reads back in its
+// run_mode 2 are joined to the entries by (run, lumi, event).
+//
+// Each --mva is "name:weight_file" or "name:weight_file:expr1,expr2,...".
+// Without an explicit list the variable expressions are taken from the
+// weight file and evaluated as formulas on the input tree.
+
+namespace {
+
+  // The SVFit inputs of one entry, as read from the flat tree
+  enum SVFitVar {
+    kPt1, kEta1, kPhi1, kM1, kPt2, kEta2, kPhi2, kM2,
+    kMet, kMetPhi, kCov00, kCov01, kCov10, kCov11, kNSVFitVars
+  };
+  const char * svfit_var_names[kNSVFitVars] = {
+    "pt_1", "eta_1", "phi_1", "m_1", "pt_2", "eta_2", "phi_2", "m_2",
+    "met", "met_phi", "metcov00", "metcov01", "metcov10", "metcov11"
+  };
+
+  struct SVFitKey {
+    int run;
+    int lumi;
+    ULong64_t event;
+    ULong64_t objects_hash;
+    int tau_decay_mode_1;
+    int tau_decay_mode_2;
+    double x[kNSVFitVars];
+
+    bool operator==(SVFitKey const& r) const {
+      return run == r.run && lumi == r.lumi && event == r.event &&
+             objects_hash == r.objects_hash &&
+             tau_decay_mode_1 == r.tau_decay_mode_1 &&
+             tau_decay_mode_2 == r.tau_decay_mode_2 &&
+             std::memcmp(x, r.x, sizeof(x)) == 0;
+    }
+  };
+
+  struct SVFitKeyHash {
+    std::size_t operator()(SVFitKey const& k) const {
+      std::size_t id = 0;
+      boost::hash_combine(id, k.run);
+      boost::hash_combine(id, k.lumi);
+      boost::hash_combine(id, k.event);
+      boost::hash_combine(id, k.objects_hash);
+      boost::hash_combine(id, k.tau_decay_mode_1);
+      boost::hash_combine(id, k.tau_decay_mode_2);
+      for (unsigned i = 0; i < kNSVFitVars; ++i) boost::hash_combine(id, k.x[i]);
+      return id;
+    }
+  };
+
+  struct SVFitResult {
+    double m;
+    double pt;
+    double eta;
+    double phi;
+  };
+
+  struct MVASpec {
+    std::string name;
+    std::string file;
+    std::vector<std::string> variables;
+  };
+
+  // What is kept of each input file between the passes
+  struct InputFile {
+    std::string name;
+    std::string output;
+    bool ok;
+    bool has_run;
+    std::vector<SVFitKey> keys;
+    std::vector<unsigned> svfit_index;
+  };
+
+  ic::Candidate MakeCandidate(double pt, double eta, double phi, double m) {
+    ic::Candidate cand;
+    double p = pt * std::cosh(eta);
+    cand.set_vector(ROOT::Math::PtEtaPhiEVector(pt, eta, phi, std::sqrt(p * p + m * m)));
+    return cand;
+  }
+
+  // Picks the fit by channel in the same way as the SVFitTest module
+  SVFitResult RunSVFit(SVFitKey const& k, ic::channel channel, bool legacy, bool mc) {
+    ic::Candidate c1 = MakeCandidate(k.x[kPt1], k.x[kEta1], k.x[kPhi1], k.x[kM1]);
+    ic::Candidate c2 = MakeCandidate(k.x[kPt2], k.x[kEta2], k.x[kPhi2], k.x[kM2]);
+    ic::Met met;
+    met.set_vector(ROOT::Math::PtEtaPhiEVector(k.x[kMet], 0., k.x[kMetPhi], k.x[kMet]));
+    met.set_xx_sig(k.x[kCov00]);
+    met.set_xy_sig(k.x[kCov01]);
+    met.set_yx_sig(k.x[kCov10]);
+    met.set_yy_sig(k.x[kCov11]);
+    std::pair<ic::Candidate, double> res;
+    if (legacy) {
+      res = (channel == ic::channel::em) ?
+        ic::SVFitService::SVFitCandidateLepLep(&c1, &c2, &met, mc) :
+        ic::SVFitService::SVFitCandidateLepHad(&c1, &c2, &met, mc);
+#ifdef IC_SVFIT_STANDALONE
+    } else if (channel == ic::channel::mt) {
+      res = ic::SVFitService::SVFitCandidateMuHad(&c1, &c2, k.tau_decay_mode_2, &met, mc);
+    } else if (channel == ic::channel::et) {
+      res = ic::SVFitService::SVFitCandidateEleHad(&c1, &c2, k.tau_decay_mode_2, &met, mc);
+    } else if (channel == ic::channel::em) {
+      res = ic::SVFitService::SVFitCandidateEleMu(&c1, &c2, &met, mc);
+    } else {
+      res = ic::SVFitService::SVFitCandidateHadHad(&c1, k.tau_decay_mode_1, &c2, k.tau_decay_mode_2, &met, mc);
+#endif
+    }
+    SVFitResult out = {res.second, res.first.pt(), res.first.eta(), res.first.phi()};
+    return out;
+  }
+
+  // Runs the fits for all the keys, split into contiguous chunks over up to
+  // n_jobs worker processes which send their results back through a pipe
+  void RunSVFits(std::vector<SVFitKey> const& keys, ic::channel channel, bool legacy, bool mc,
+                 unsigned n_jobs, std::vector<SVFitResult> & results) {
+    SVFitResult const empty = {-9999., -9999., -9999., -9999.};
+    results.assign(keys.size(), empty);
+    if (n_jobs > keys.size()) n_jobs = keys.size();
+    if (n_jobs <= 1) {
+      for (unsigned i = 0; i < keys.size(); ++i) results[i] = RunSVFit(keys[i], channel, legacy, mc);
+      return;
+    }
+    std::cout.flush();
+    fflush(stdout);
+    std::vector<int> readfd(n_jobs, -1);
+    std::vector<pid_t> pids(n_jobs, -1);
+    std::vector<std::pair<unsigned, unsigned> > ranges(n_jobs);
+    for (unsigned j = 0; j < n_jobs; ++j) {
+      ranges[j] = std::make_pair(keys.size() * j / n_jobs, keys.size() * (j + 1) / n_jobs);
+      int fds[2];
+      pid_t pid = -1;
+      if (pipe(fds) == 0) pid = fork();
+      if (pid == 0) {
+        close(fds[0]);
+        bool ok = true;
+        for (unsigned i = ranges[j].first; ok && i < ranges[j].second; ++i) {
+          SVFitResult res = RunSVFit(keys[i], channel, legacy, mc);
+          ok = write(fds[1], &res, sizeof(res)) == static_cast<ssize_t>(sizeof(res));
+        }
+        close(fds[1]);
+        _exit(ok ? 0 : 1);
+      }
+      if (pid < 0) {
+        std::cerr << "Could not start SVFit worker " << j << ", running its fits in-process" << std::endl;
+        for (unsigned i = ranges[j].first; i < ranges[j].second; ++i) results[i] = RunSVFit(keys[i], channel, legacy, mc);
+      } else {
+        close(fds[1]);
+        readfd[j] = fds[0];
+        pids[j] = pid;
+      }
+    }
+    // Reading the pipes in turn can't deadlock: a worker that fills its pipe
+    // just waits until we get to it
+    for (unsigned j = 0; j < n_jobs; ++j) {
+      if (pids[j] < 0) continue;
+      unsigned i = ranges[j].first;
+      SVFitResult res;
+      while (i < ranges[j].second) {
+        ssize_t n = 0;
+        std::size_t got = 0;
+        char * buf = reinterpret_cast<char *>(&res);
+        while (got < sizeof(res) && (n = read(readfd[j], buf + got, sizeof(res) - got)) > 0) got += n;
+        if (got != sizeof(res)) break;
+        results[i++] = res;
+      }
+      close(readfd[j]);
+      int wstatus = 0;
+      waitpid(pids[j], &wstatus, 0);
+      if (i != ranges[j].second || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) {
+        std::cerr << "SVFit worker " << j << " failed after " << (i - ranges[j].first) << " of "
+                  << (ranges[j].second - ranges[j].first) << " fits" << std::endl;
+      }
+    }
+  }
+
+  typedef std::tuple<int, int, ULong64_t> tri_key;
+
+  // Reads the D0 and DCP values from the MELA output files
+  bool ReadMELA(std::vector<std::string> const& files, std::map<tri_key, std::pair<float, float> > & mela) {
+    for (auto const& name : files) {
+      TFile *f = TFile::Open(name.c_str());
+      TTree *t = f ? dynamic_cast<TTree *>(f->Get("mela")) : nullptr;
+      if (!t) {
+        std::cerr << "Could not read the mela tree from " << name << std::endl;
+        if (f) delete f;
+        return false;
+      }
+      unsigned event = 0, lumi = 0, run = 0;
+      float D0 = 0., DCP = 0.;
+      t->SetBranchAddress("event", &event);
+      t->SetBranchAddress("lumi", &lumi);
+      t->SetBranchAddress("run", &run);
+      t->SetBranchAddress("D0", &D0);
+      t->SetBranchAddress("DCP", &DCP);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+        t->GetEntry(i);
+        mela[tri_key(run, lumi, event)] = std::make_pair(D0, DCP);
+      }
+      delete f;
+    }
+    return true;
+  }
+}
+
+int main(int argc, char* argv[]){
+  std::string filelist, input_path, tree_name, friend_name, postfix, channel_str, era_str, mela_filelist;
+  std::vector<std::string> inputs, mva_args;
+  bool do_svfit, svfit_mc;
+  unsigned n_threads;
+
+  po::options_description config("Configuration");
+  po::variables_map vm;
+  config.add_options()
+      ("help,h", "print this message")
+      ("input", po::value<std::vector<std::string> >(&inputs)->multitoken(), "input files")
+      ("filelist", po::value<std::string>(&filelist)->default_value(""), "file containing a list of input files")
+      ("input_path", po::value<std::string>(&input_path)->default_value(""), "path to add to the files in the file list")
+      ("tree", po::value<std::string>(&tree_name)->default_value("ntuple"), "name of the input tree")
+      ("friend_tree", po::value<std::string>(&friend_name)->default_value("friend"), "name of the friend tree")
+      ("postfix", po::value<std::string>(&postfix)->default_value("_friend"), "added to the input file name to form the output name")
+      ("channel", po::value<std::string>(&channel_str)->default_value("mt"), "channel, selects the SVFit decay types")
+      ("era", po::value<std::string>(&era_str)->default_value("data_2016"), "era, data_2015 and later use svFitStandalone")
+      ("svfit", po::value<bool>(&do_svfit)->default_value(false), "add m_sv, pt_sv, eta_sv and phi_sv")
+      ("svfit_mc", po::value<bool>(&svfit_mc)->default_value(true), "use Markov-Chain integration for SVFit")
+      ("mela_files", po::value<std::string>(&mela_filelist)->default_value(""), "file containing a list of MELA output files, adds D0 and DCP")
+      ("mva", po::value<std::vector<std::string> >(&mva_args)->composing(), "name:weight_file[:expr1,expr2,...], may be repeated")
+      ("threads", po::value<unsigned>(&n_threads)->default_value(1), "number of threads, and of SVFit worker processes");
+  po::store(po::command_line_parser(argc, argv).options(config).run(), vm);
+  po::notify(vm);
+  if (vm.count("help")) {
+    std::cout << config << std::endl;
+    return 0;
+  }
+
+  if (filelist != "") {
+    std::vector<std::string> files = ic::ParseFileLines(filelist);
+    for (auto const& f : files) inputs.push_back(input_path + f);
+  }
+  if (inputs.size() == 0) {
+    std::cerr << "No input files given" << std::endl;
+    return 1;
+  }
+
+  ic::channel channel = ic::String2Channel(channel_str);
+  ic::era era = ic::String2Era(era_str);
+  bool legacy_svfit = era == ic::era::data_2011 || era == ic::era::data_2012_rereco;
+#ifndef IC_SVFIT_STANDALONE
+  if (do_svfit && !legacy_svfit) {
+    std::cerr << "SVFit for " << era_str << " needs svFitStandalone, rebuild with SVFIT_STANDALONE=1" << std::endl;
+    return 1;
+  }
+#endif
+  if (do_svfit && !legacy_svfit && channel != ic::channel::et && channel != ic::channel::mt &&
+      channel != ic::channel::em && channel != ic::channel::tt) {
+    std::cerr << "svFitStandalone is not supported for channel " << channel_str << std::endl;
+    return 1;
+  }
+
+  std::vector<MVASpec> mvas;
+  for (auto const& arg : mva_args) {
+    std::vector<std::string> parts;
+    boost::split(parts, arg, boost::is_any_of(":"));
+    if (parts.size() < 2 || parts.size() > 3) {
+      std::cerr << "Could not parse --mva " << arg << std::endl;
+      return 1;
+    }
+    MVASpec spec;
+    spec.name = parts[0];
+    spec.file = parts[1];
+    if (parts.size() == 3) {
+      boost::split(spec.variables, parts[2], boost::is_any_of(","));
+    } else {
+      ic::CompiledBDT bdt;
+      if (!bdt.Load(spec.file)) {
+        std::cerr << "Give the variables of " << spec.file << " explicitly" << std::endl;
+        return 1;
+      }
+      spec.variables = bdt.variables();
+    }
+    mvas.push_back(spec);
+  }
+
+  std::map<tri_key, std::pair<float, float> > mela;
+  bool do_mela = mela_filelist != "";
+  if (do_mela && !ReadMELA(ic::ParseFileLines(mela_filelist), mela)) return 1;
+
+  std::cout << "-------------------------------------------------------------------" << std::endl;
+  std::cout << "HTTFriendTree" << std::endl;
+  std::cout << "-------------------------------------------------------------------" << std::endl;
+  boost::format fmt("%-25s %-40s\n");
+  std::cout << fmt % "input files" % inputs.size();
+  std::cout << fmt % "tree" % tree_name;
+  std::cout << fmt % "friend_tree" % friend_name;
+  std::cout << fmt % "channel" % ic::Channel2String(channel);
+  std::cout << fmt % "era" % ic::Era2String(era);
+  std::cout << fmt % "svfit" % do_svfit;
+  if (do_svfit) std::cout << fmt % "legacy svfit" % legacy_svfit;
+  std::cout << fmt % "mela entries" % mela.size();
+  for (auto const& mva : mvas) std::cout << fmt % ("mva " + mva.name) % mva.file;
+  std::cout << fmt % "threads" % n_threads;
+
+  TH1::AddDirectory(kFALSE);
+  TStopwatch timer;
+
+  // First pass: the event identifiers and SVFit inputs of every entry
+  std::vector<InputFile> files(inputs.size());
+  ic::ParallelFor(files.size(), n_threads, [&](unsigned ifile) {
+    InputFile & in = files[ifile];
+    in.name = inputs[ifile];
+    in.output = in.name;
+    std::size_t pos = in.output.rfind(".root");
+    if (pos != in.output.npos) in.output.replace(pos, 5, postfix + ".root");
+    else in.output += postfix + ".root";
+    in.ok = false;
+    TFile *f = TFile::Open(in.name.c_str());
+    TTree *t = f ? dynamic_cast<TTree *>(f->Get(tree_name.c_str())) : nullptr;
+    if (!t) {
+      std::cerr << "Could not read " << tree_name << " from " << in.name << std::endl;
+      if (f) delete f;
+      return;
+    }
+    in.has_run = t->GetBranch("run") && t->GetBranch("lumi");
+    bool has_hash = t->GetBranch("objects_hash");
+    if (do_mela && !in.has_run) {
+      std::cerr << in.name << " has no run and lumi branches, needed to join MELA" << std::endl;
+      delete f;
+      return;
+    }
+    int run = 0, lumi = 0;
+    ULong64_t event = 0, objects_hash = 0;
+    t->SetBranchStatus("*", 0);
+    t->SetBranchStatus("event", 1);
+    t->SetBranchAddress("event", &event);
+    if (in.has_run) {
+      t->SetBranchStatus("run", 1);
+      t->SetBranchStatus("lumi", 1);
+      t->SetBranchAddress("run", &run);
+      t->SetBranchAddress("lumi", &lumi);
+    }
+    if (has_hash) {
+      t->SetBranchStatus("objects_hash", 1);
+      t->SetBranchAddress("objects_hash", &objects_hash);
+    }
+    // The kNSVFitVars inputs, followed by the two tau decay modes for
+    // svFitStandalone
+    std::vector<std::string> names;
+    if (do_svfit) {
+      names.assign(svfit_var_names, svfit_var_names + kNSVFitVars);
+      if (!legacy_svfit) {
+        names.push_back("tau_decay_mode_1");
+        names.push_back("tau_decay_mode_2");
+      }
+    }
+    std::vector<TTreeFormula*> formulas;
+    for (auto const& name : names) {
+      if (!t->GetBranch(name.c_str())) {
+        std::cerr << in.name << " has no " << name
+                  << " branch, it should be produced with write_friend_inputs" << std::endl;
+        for (auto form : formulas) delete form;
+        delete f;
+        return;
+      }
+      t->SetBranchStatus(name.c_str(), 1);
+      formulas.push_back(new TTreeFormula(name.c_str(), name.c_str(), t));
+    }
+    Long64_t n = t->GetEntries();
+    in.keys.resize(n);
+    for (Long64_t i = 0; i < n; ++i) {
+      t->GetEntry(i);
+      SVFitKey & k = in.keys[i];
+      std::memset(&k, 0, sizeof(k));
+      k.run = run;
+      k.lumi = lumi;
+      k.event = event;
+      k.objects_hash = objects_hash;
+      for (unsigned v = 0; v < formulas.size(); ++v) {
+        formulas[v]->GetNdata();
+        double val = formulas[v]->EvalInstance(0);
+        if (v < kNSVFitVars) k.x[v] = val;
+        else if (v == kNSVFitVars) k.tau_decay_mode_1 = val;
+        else k.tau_decay_mode_2 = val;
+      }
+    }
+    for (auto form : formulas) delete form;
+    delete f;
+    in.ok = true;
+  });
+
+  // Each distinct set of SVFit inputs is fitted once
+  std::vector<SVFitKey> unique_keys;
+  std::vector<SVFitResult> svfit_results;
+  if (do_svfit) {
+    std::unordered_map<SVFitKey, unsigned, SVFitKeyHash> seen;
+    std::size_t n_entries = 0;
+    for (auto & in : files) {
+      if (!in.ok) continue;
+      in.svfit_index.resize(in.keys.size());
+      for (unsigned i = 0; i < in.keys.size(); ++i) {
+        auto it = seen.find(in.keys[i]);
+        if (it == seen.end()) {
+          it = seen.insert(std::make_pair(in.keys[i], unique_keys.size())).first;
+          unique_keys.push_back(in.keys[i]);
+        }
+        in.svfit_index[i] = it->second;
+      }
+      n_entries += in.keys.size();
+    }
+    std::cout << "Running SVFit for " << unique_keys.size() << " distinct inputs out of "
+              << n_entries << " entries" << std::endl;
+    RunSVFits(unique_keys, channel, legacy_svfit, svfit_mc, n_threads, svfit_results);
+  }
+
+  // Second pass: evaluate the MVAs and write the friend trees
+  std::vector<unsigned> n_mela_missing(files.size(), 0);
+  ic::ParallelFor(files.size(), n_threads, [&](unsigned ifile) {
+    InputFile & in = files[ifile];
+    if (!in.ok) return;
+    Long64_t n = in.keys.size();
+
+    std::vector<std::vector<double> > mva_values(mvas.size(), std::vector<double>(n, 0.));
+    if (mvas.size() > 0) {
+      TFile *f = TFile::Open(in.name.c_str());
+      TTree *t = f ? dynamic_cast<TTree *>(f->Get(tree_name.c_str())) : nullptr;
+      if (!t) {
+        std::cerr << "Could not re-open " << in.name << std::endl;
+        in.ok = false;
+        if (f) delete f;
+        return;
+      }
+      for (unsigned m = 0; m < mvas.size(); ++m) {
+        MVASpec const& spec = mvas[m];
+        unsigned nvars = spec.variables.size();
+        std::vector<float> bound(nvars, 0.);
+        ic::MVAReader reader("!Color:!Silent");
+        std::vector<TTreeFormula*> formulas;
+        for (unsigned v = 0; v < nvars; ++v) {
+          reader.AddVariable(spec.variables[v], &bound[v]);
+          std::string expr = spec.variables[v];
+          std::size_t def = expr.find(":=");
+          if (def != expr.npos) expr = expr.substr(def + 2);
+          formulas.push_back(new TTreeFormula(("v" + std::to_string(v)).c_str(), expr.c_str(), t));
+        }
+        reader.BookMVA(spec.name, spec.file);
+        unsigned const block = 1000;
+        std::vector<float> x(std::size_t(block) * nvars);
+        for (Long64_t start = 0; start < n; start += block) {
+          unsigned nblock = std::min<Long64_t>(block, n - start);
+          for (unsigned i = 0; i < nblock; ++i) {
+            t->GetEntry(start + i);
+            for (unsigned v = 0; v < nvars; ++v) {
+              formulas[v]->GetNdata();
+              x[std::size_t(i) * nvars + v] = formulas[v]->EvalInstance(0);
+            }
+          }
+          reader.EvaluateBatch(spec.name, x.data(), nblock, nvars, &mva_values[m][start]);
+        }
+        for (auto form : formulas) delete form;
+      }
+      delete f;
+    }
+
+    TFile *out = new TFile(in.output.c_str(), "RECREATE");
+    TTree *otree = new TTree(friend_name.c_str(), friend_name.c_str());
+    int run = 0, lumi = 0;
+    ULong64_t event = 0, objects_hash = 0;
+    SVFitResult sv = {0., 0., 0., 0.};
+    float D0 = -9999., DCP = -9999.;
+    std::vector<double> mva_out(mvas.size(), 0.);
+    otree->Branch("event", &event, "event/l");
+    if (in.has_run) {
+      otree->Branch("run", &run, "run/I");
+      otree->Branch("lumi", &lumi, "lumi/I");
+    }
+    otree->Branch("objects_hash", &objects_hash, "objects_hash/l");
+    if (do_svfit) {
+      otree->Branch("m_sv", &sv.m, "m_sv/D");
+      otree->Branch("pt_sv", &sv.pt, "pt_sv/D");
+      otree->Branch("eta_sv", &sv.eta, "eta_sv/D");
+      otree->Branch("phi_sv", &sv.phi, "phi_sv/D");
+    }
+    if (do_mela) {
+      otree->Branch("D0", &D0, "D0/F");
+      otree->Branch("DCP", &DCP, "DCP/F");
+    }
+    for (unsigned m = 0; m < mvas.size(); ++m) {
+      otree->Branch(mvas[m].name.c_str(), &mva_out[m], (mvas[m].name + "/D").c_str());
+    }
+    for (Long64_t i = 0; i < n; ++i) {
+      SVFitKey const& k = in.keys[i];
+      run = k.run;
+      lumi = k.lumi;
+      event = k.event;
+      objects_hash = k.objects_hash;
+      if (do_svfit) sv = svfit_results[in.svfit_index[i]];
+      if (do_mela) {
+        auto it = mela.find(tri_key(k.run, k.lumi, k.event));
+        if (it != mela.end()) {
+          D0 = it->second.first;
+          DCP = it->second.second;
+        } else {
+          D0 = -9999.;
+          DCP = -9999.;
+          ++n_mela_missing[ifile];
+        }
+      }
+      for (unsigned m = 0; m < mvas.size(); ++m) mva_out[m] = mva_values[m][i];
+      otree->Fill();
+    }
+    // The entries are aligned with the input tree, the index also allows
+    // the friend to be used with a skimmed or reordered copy of it
+    if (in.has_run) otree->BuildIndex("run", "event");
+    else otree->BuildIndex("event");
+    out->cd();
+    otree->Write();
+    delete otree;
+    out->Close();
+    delete out;
+  });
+
+  unsigned n_failed = 0;
+  for (unsigned i = 0; i < files.size(); ++i) {
+    if (!files[i].ok) {
+      ++n_failed;
+      continue;
+    }
+    std::cout << files[i].output << ": " << files[i].keys.size() << " entries";
+    if (do_mela) std::cout << ", " << n_mela_missing[i] << " without MELA output";
+    std::cout << std::endl;
+  }
+  std::cout << "Done in " << timer.RealTime() << " s";
+  if (n_failed > 0) std::cout << ", " << n_failed << " files failed";
+  std::cout << std::endl;
+  return n_failed > 0 ? 1 : 0;
+}
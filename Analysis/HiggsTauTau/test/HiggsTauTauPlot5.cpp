@@ -75,6 +75,8 @@ int main(int argc, char* argv[]){
   bool no_central;
   string signal_bins;
   bool add_ztt_modes;
+  string shape_cache;                           // Directory of the persistent shape cache
+  string shape_cache_invalidate;                // Samples whose cached shapes should be dropped
 
 	// Program options
   po::options_description preconfig("Pre-Configuration");
@@ -141,7 +143,9 @@ int main(int argc, char* argv[]){
 	  ("check_ztt_top_frac",      po::value<bool>(&check_ztt_top_frac)->default_value(false))
 	  ("add_ztt_modes",           po::value<bool>(&add_ztt_modes)->default_value(false))
 	  ("scan_bins",               po::value<unsigned>(&scan_bins)->default_value(0))
-	  ("qcd_os_ss_factor",  	    po::value<double>(&qcd_os_ss_factor)->default_value(-1));
+	  ("qcd_os_ss_factor",  	    po::value<double>(&qcd_os_ss_factor)->default_value(-1))
+	  ("shape_cache",             po::value<string>(&shape_cache)->default_value(""))
+	  ("shape_cache_invalidate",  po::value<string>(&shape_cache_invalidate)->default_value(""));
 
    
 	HTTPlot plot;
@@ -226,7 +230,15 @@ int main(int argc, char* argv[]){
 	// ************************************************************************
 	// Setup HTTRun2Analysis 
 	// ************************************************************************
+	std::shared_ptr<ShapeCache> cache;
+	if (shape_cache != "") {
+		cache = std::make_shared<ShapeCache>(shape_cache);
+		std::vector<std::string> invalidate;
+		if (shape_cache_invalidate != "") boost::split(invalidate, shape_cache_invalidate, boost::is_any_of(","));
+		for (auto const& sample : invalidate) cache->Invalidate(sample);
+	}
 	HTTRun2Analysis ana(String2Channel(channel_str), year, verbosity,is_sm);
+	ana.SetShapeCache(cache);
     ana.SetQCDRatio(qcd_os_ss_factor);
     if (do_ss){
        ana.SetQCDRatio(1.0);
@@ -507,6 +519,7 @@ int main(int argc, char* argv[]){
 		std::cout << "-----------------------------------------------------------------------------------" << std::endl;
 		std::cout << "[HiggsTauTauPlot5] Doing systematic templates for \"" << syst.second << "\"..." << std::endl;
 		HTTRun2Analysis ana_syst(String2Channel(channel_str), year, verbosity,is_sm);
+		ana_syst.SetShapeCache(cache);
         ana_syst.SetQCDRatio(qcd_os_ss_factor);
         if(do_ss) {
             ana_syst.SetSS();
@@ -954,6 +967,12 @@ int main(int argc, char* argv[]){
 
   if(!no_central) plot.GeneratePlot(hmap);
 
+  if (cache) {
+    std::cout << "[HiggsTauTauPlot5] Shape cache " << cache->dir() << ": " << cache->hits() << " hits, "
+              << cache->misses() << " misses" << std::endl;
+    cache->Flush();
+  }
+
   return 0;
 }
 
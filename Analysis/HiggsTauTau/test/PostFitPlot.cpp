@@ -18,6 +18,7 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TextElement.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnRootTools.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTStatTools.h"
+#include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/HTTShapeLoader.h"
 #include "UserCode/ICHiggsTauTau/Analysis/HiggsTauTau/interface/mssm_xs_tools.h"
 
 
@@ -93,6 +94,7 @@ int main(int argc, char* argv[]){
   bool log_y            = false;
   string default_title  = "CMS Preliminary, #sqrt{s} = 7-8 TeV, L = 24.3 fb^{-1}";
   int signal_factor     = 1;
+  unsigned load_threads = 1;
   bool blind;                                   // Blind some region of the data
   bool custom_x_axis_range;                     // Choose own x axis range
   double x_axis_min;                            // If custom_x_axis is true, use this as min x for the plot
@@ -120,6 +122,7 @@ int main(int argc, char* argv[]){
     ("title_left",           po::value<string>(&title_left)->default_value(default_title),   "the plot title")
     ("x_axis_label",         po::value<string>(&x_axis_label)->default_value("M_{#tau#tau} [GeV]"),   "the plot title")
     ("mssm",                 po::value<bool>(&mssm)->default_value(false),                   "input is an MSSM datacard")
+    ("load_threads",         po::value<unsigned>(&load_threads)->default_value(1),           "number of threads used to read the datacards and shape files")
     ("log_y",                po::value<bool>(&log_y)->default_value(false),                  "y-axis in log scale")
     ("signal_factor",        po::value<int>(&signal_factor)->default_value(1),               "scale the signal by an integer factor")
     ("blind",                po::value<bool>(&blind)->default_value(false),  "blind the data distribution")
@@ -157,19 +160,21 @@ int main(int argc, char* argv[]){
   }
 
   HTTSetup setup;
+  HTTShapeLoader loader;
   for (unsigned j = 0; j < v_eras.size(); ++j) {
     for (unsigned k = 0; k < v_columns.second.size(); ++k) {
       string cat = v_columns.second[k];
-      setup.ParseDatacard(datacard_path+"/"+"htt_"+channel+"_"+cat+"_"+v_eras[j]+".txt", channel, boost::lexical_cast<int>(cat), v_eras[j], signal_mass);        
+      loader.AddDatacard(datacard_path+"/"+"htt_"+channel+"_"+cat+"_"+v_eras[j]+".txt", channel, boost::lexical_cast<int>(cat), v_eras[j], signal_mass);        
     }
   }
   for (unsigned i = 0; i < v_eras.size(); ++i) {
     if (!mssm) {
-      setup.ParseROOTFile(root_file_path+"/"+"htt_"+channel+".input_"+v_eras[i]+".root", channel, v_eras[i]);
+      loader.AddROOTFile(root_file_path+"/"+"htt_"+channel+".input_"+v_eras[i]+".root", channel, v_eras[i]);
     } else {
-      setup.ParseROOTFile(root_file_path+"/"+"htt_"+channel+".inputs-mssm-"+v_eras[i]+"-0.root", channel, v_eras[i]);
+      loader.AddROOTFile(root_file_path+"/"+"htt_"+channel+".inputs-mssm-"+v_eras[i]+"-0.root", channel, v_eras[i]);
     }
   }
+  loader.set_threads(load_threads).Load(setup);
   setup.ParsePulls(pulls_file);
   if (postfit) setup.ApplyPulls(true);
 
@@ -230,9 +235,12 @@ int main(int argc, char* argv[]){
       }
       xs_tool.SetInput(file.c_str());
       std::cout << "*****************************************************************************" << std::endl;
-      double br =  xs_tool.Give_BR_A_tautau(d_mass, d_tanb);
-      double xs_ggh = xs_tool.Give_Xsec_ggFA(d_mass, d_tanb) / 1000.;
-      double xs_bbh = xs_tool.Give_Xsec_bbA5f(d_mass, d_tanb) / 1000.;
+      // The ggF xsections are stored in pb, the bbH ones in fb
+      std::vector<double> xs_values;
+      xs_tool.Give_Values({"brtautau_A", "ggF_xsec_A", "bbH_xsec_A"}, {d_mass}, {d_tanb}, xs_values);
+      double br = xs_values[0];
+      double xs_ggh = xs_values[1];
+      double xs_bbh = xs_values[2] / 1000.;
       std::cout << "Era: " << v_eras[i] << " BR: " << br << " XS(ggH): " << xs_ggh << " XS(bbH): " << xs_bbh << std::endl; 
       TH1F ggh_hist = setup.era({v_eras[i]}).process({"ggH"}).GetShape();
       TH1F bbh_hist = setup.era({v_eras[i]}).process({"bbH"}).GetShape();
@@ -3,10 +3,13 @@
 
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TreeEvent.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/DRMatrix.h"
 #include "UserCode/ICHiggsTauTau/interface/Objects.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Modules/interface/SimpleCounter.h"
 #include <string>
+#include <vector>
+#include <algorithm>
 
 namespace ic {
 
@@ -57,7 +60,15 @@ int IDOverlapFilter<T, U>::Execute(TreeEvent *event) {
   std::vector<T *> & vec = event->GetPtrVec<T>(input_label_);
   // Get the reference input collection
   std::vector<U *> const& ref_vec = event->GetPtrVec<U>(reference_label_);
-  ic::erase_if(vec, boost::bind(FoundIdInCollection<T, U>, _1, ref_vec));
+  // Sorted ids of the reference collection, searched once per input object
+  std::vector<std::size_t> ref_ids(ref_vec.size());
+  for (unsigned i = 0; i < ref_vec.size(); ++i) ref_ids[i] = ref_vec[i]->id();
+  std::sort(ref_ids.begin(), ref_ids.end());
+  std::vector<bool> keep(vec.size());
+  for (unsigned i = 0; i < vec.size(); ++i) {
+    keep[i] = !std::binary_search(ref_ids.begin(), ref_ids.end(), vec[i]->id());
+  }
+  KeepSelected(vec, keep);
   return 0;
 }
 
@@ -4,28 +4,45 @@
 #include "Core/interface/TreeEvent.h"
 #include "Core/interface/ModuleBase.h"
 #include "Utilities/interface/JsonTools.h"
+#include "Utilities/interface/LumiRanges.h"
 #include <string>
+#include <vector>
+
+class TTree;
 
 namespace ic {
 
 /**
  * Filters events using a standard CMS luminosity json file
  *
+ * The accepted (run, lumi) pairs and, if produce_output_jsons is set, the
+ * accepted and rejected lumisections seen are only looked up and recorded
+ * when the lumisection changes from the previous event.
+ *
+ * AcceptedEntries() applies the mask to a whole input tree up front,
+ * reading only the run and lumi of the eventInfo branch, so that the
+ * rejected entries never have to be read. See
+ * AnalysisBase::SetEntryPreselection.
  */
 class LumiMask : public ModuleBase {
  private:
   typedef std::map<unsigned, std::set<unsigned>> JsonMap;
   typedef std::map<unsigned, std::set<unsigned>>::const_iterator JsonIt;
 
-  JsonMap input_json_;
+  LumiRanges input_ranges_;
   JsonMap accept_json_;
   JsonMap reject_json_;
   JsonMap all_json_;
   CLASS_MEMBER(LumiMask, std::string, input_file)
   CLASS_MEMBER(LumiMask, std::string, produce_output_jsons)
 
+  unsigned last_run_;
+  unsigned last_ls_;
+  bool last_accept_;
+  bool last_valid_;
+
  private:
-  void FillJsonMapFromJson(JsonMap & jsmap, Json::Value const& js);
+  bool Accept(unsigned run, unsigned ls);
   Json::Value JsonFromJsonMap(JsonMap const& jsmap);
   void WriteJson(JsonMap const& json, std::ofstream& output);
 
@@ -37,6 +54,20 @@ class LumiMask : public ModuleBase {
   virtual int Execute(TreeEvent* event);
   virtual int PostAnalysis();
   virtual void PrintInfo();
+
+  /// True if the accepted, rejected and all lumisections are written out
+  bool ProducesOutputJsons() const;
+
+  /**
+   * The entries of tree that pass the mask, in increasing order
+   *
+   * Only the run and lumi_block of the eventInfo branch are read. Every
+   * lumisection in the tree is recorded for the output jsons, not just
+   * those of the entries that are later processed, so a job writing output
+   * jsons should not preselect its entries.
+   */
+  std::vector<int64_t> AcceptedEntries(TTree * tree,
+                                       std::string const& branch = "eventInfo");
 };
 }
 
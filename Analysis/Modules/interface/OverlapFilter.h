@@ -3,6 +3,7 @@
 
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TreeEvent.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/DRMatrix.h"
 #include "UserCode/ICHiggsTauTau/interface/Objects.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Modules/interface/SimpleCounter.h"
@@ -101,7 +102,10 @@ int OverlapFilter<T, U>::Execute(TreeEvent *event) {
   std::vector<T *> & vec = event->GetPtrVec<T>(input_label_);
   // Get the reference input collection
   std::vector<U *> const& ref_vec = event->GetPtrVec<U>(reference_label_);
-  ic::erase_if(vec, !boost::bind(MinDRToCollection<U*>, _1, ref_vec, min_dr_));
+  DRMatrix dr_matrix(vec, ref_vec);
+  std::vector<bool> keep;
+  dr_matrix.NotWithin(min_dr_, keep);
+  KeepSelected(vec, keep);
   return 0;
 }
 
@@ -139,9 +143,14 @@ int OverlapFilter<T, CompositeCandidate>::Execute(TreeEvent *event) {
   std::vector<T *> & vec = event->GetPtrVec<T>(input_label_);
   // Get the reference input collection
   std::vector<CompositeCandidate *> const& ref_vec = event->GetPtrVec<CompositeCandidate>(reference_label_);
+  // Remove anything close to any of the constituents
+  DRMatrix dr_matrix(vec, std::vector<Candidate *>());
   for (unsigned i = 0; i < ref_vec.size(); ++i) {
-  ic::erase_if(vec, !boost::bind(MinDRToCollection<Candidate*>, _1, ref_vec[i]->AsVector(), min_dr_));
+    dr_matrix.Append(ref_vec[i]->AsVector());
   }
+  std::vector<bool> keep;
+  dr_matrix.NotWithin(min_dr_, keep);
+  KeepSelected(vec, keep);
   return 0;
 }
 
@@ -4,12 +4,18 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TreeEvent.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Core/interface/ModuleBase.h"
 #include <string>
+#include <vector>
+#include <algorithm>
 
 namespace ic {
 
 class RunFilter : public ModuleBase {
  private:
-  std::set<int> runs_to_filter;
+  // Sorted, with the result for the previous event's run cached
+  std::vector<int> runs_to_filter;
+  int last_run_;
+  bool last_reject_;
+  bool last_valid_;
 
  public:
   RunFilter(std::string const& name);
@@ -21,7 +27,9 @@ class RunFilter : public ModuleBase {
   virtual void PrintInfo();
 
   void FilterRun(int const& run) {
-    runs_to_filter.insert(run);
+    auto it = std::lower_bound(runs_to_filter.begin(), runs_to_filter.end(), run);
+    if (it == runs_to_filter.end() || *it != run) runs_to_filter.insert(it, run);
+    last_valid_ = false;
   }
 };
 
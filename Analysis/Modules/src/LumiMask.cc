@@ -4,10 +4,17 @@
 #include "UserCode/ICHiggsTauTau/interface/EventInfo.hh"
 #include "boost/lexical_cast.hpp"
 #include <fstream>
+#include "TTree.h"
+#include "TBranch.h"
 
 namespace ic {
 
-LumiMask::LumiMask(std::string const& name) : ModuleBase(name) {
+LumiMask::LumiMask(std::string const& name)
+    : ModuleBase(name),
+      last_run_(0),
+      last_ls_(0),
+      last_accept_(false),
+      last_valid_(false) {
   produce_output_jsons_ = "";
 }
 
@@ -18,7 +25,9 @@ int LumiMask::PreAnalysis() {
   if (input_file_ != "") {
     PrintArg("input_file", input_file_);
     Json::Value js = ExtractJsonFromFile(input_file_);
-    FillJsonMapFromJson(input_json_, js);
+    input_ranges_.AddJson(js);
+    PrintArg("runs", input_ranges_.n_runs());
+    PrintArg("lumi_ranges", input_ranges_.n_ranges());
   } else {
     PrintArg("input_file", "-");
   }
@@ -32,28 +41,52 @@ int LumiMask::PreAnalysis() {
 }
 
 int LumiMask::Execute(TreeEvent* event) {
-  EventInfo const* eventInfo = event->GetPtr<EventInfo>("eventInfo");
-  unsigned run = eventInfo->run();
-  unsigned ls = eventInfo->lumi_block();
-  all_json_[run].insert(ls);
-  bool accept = false;
-  if (input_json_.find(run) != input_json_.end()) {
-    if (input_json_[run].find(ls) != input_json_[run].end()) accept = true;
-  }
+  EventInfo const* eventInfo = event->GetConstPtr<EventInfo>("eventInfo");
+  return Accept(eventInfo->run(), eventInfo->lumi_block()) ? 0 : 1;
+}
+
+bool LumiMask::Accept(unsigned run, unsigned ls) {
+  // Consecutive events are nearly always from the same lumisection
+  if (last_valid_ && run == last_run_ && ls == last_ls_) return last_accept_;
   // If no input json file was loaded we will also accept this event
-  if (input_file_ == "") {
-    accept = true;
-  }
-  if (accept) {
-    accept_json_[run].insert(ls);
-    return 0;
-  } else {
-    reject_json_[run].insert(ls);
-    return 1;
+  bool accept = (input_file_ == "") || input_ranges_.Contains(run, ls);
+  if (produce_output_jsons_ != "") {
+    all_json_[run].insert(ls);
+    if (accept) {
+      accept_json_[run].insert(ls);
+    } else {
+      reject_json_[run].insert(ls);
+    }
   }
+  last_run_ = run;
+  last_ls_ = ls;
+  last_accept_ = accept;
+  last_valid_ = true;
+  return accept;
+}
 
-  return 0;
+std::vector<int64_t> LumiMask::AcceptedEntries(TTree* tree,
+                                               std::string const& branch) {
+  TBranch* info_br = tree->GetBranch(branch.c_str());
+  TBranch* run_br = info_br ? info_br->FindBranch("run_") : nullptr;
+  TBranch* ls_br = info_br ? info_br->FindBranch("lumi_block_") : nullptr;
+  if (!run_br || !ls_br) {
+    throw std::runtime_error("[LumiMask] Unable to find the run and lumi_block of branch " + branch);
+  }
+  EventInfo* info = nullptr;
+  tree->SetBranchAddress(branch.c_str(), &info);
+  std::vector<int64_t> entries;
+  int64_t n = tree->GetEntries();
+  for (int64_t i = 0; i < n; ++i) {
+    run_br->GetEntry(i);
+    ls_br->GetEntry(i);
+    if (Accept(info->run(), info->lumi_block())) entries.push_back(i);
+  }
+  tree->ResetBranchAddress(info_br);
+  delete info;
+  return entries;
 }
+
 int LumiMask::PostAnalysis() {
   if (produce_output_jsons_ != "") {
     std::ofstream output;
@@ -70,28 +103,6 @@ int LumiMask::PostAnalysis() {
   return 0;
 }
 
-void LumiMask::FillJsonMapFromJson(JsonMap & jsmap, Json::Value const& js) {
-  for (auto const& key : js.getMemberNames()) {
-    Json::Value const& run_js = js[key];
-    unsigned run = boost::lexical_cast<unsigned>(key);
-    for (unsigned i = 0; i < run_js.size(); ++i) {
-      if (run_js[i].size() != 2) {
-        throw std::runtime_error(
-            "[LumiMask] Lumi range not in the form [X,Y]");
-      }
-      unsigned range_min = run_js[i][0].asUInt();
-      unsigned range_max = run_js[i][1].asUInt();
-      if (range_max < range_min) {
-        throw std::runtime_error(
-            "[LumiMask] Have lumi range [X,Y] where Y < X");
-      }
-      for (unsigned i = range_min; i <= range_max; ++i) {
-          jsmap[run].insert(i);
-      }
-    }
-  }
-}
-
 Json::Value LumiMask::JsonFromJsonMap(JsonMap const& jsmap) {
   Json::Value js;
   for (auto const& info : jsmap) {
@@ -126,4 +137,8 @@ void LumiMask::WriteJson(JsonMap const& json, std::ofstream& output) {
 }
 
 void LumiMask::PrintInfo() { ; }
+
+bool LumiMask::ProducesOutputJsons() const {
+  return produce_output_jsons_ != "";
+}
 }
@@ -4,7 +4,8 @@
 
 namespace ic {
 
-  RunFilter::RunFilter(std::string const& name) : ModuleBase(name) {
+  RunFilter::RunFilter(std::string const& name) : ModuleBase(name),
+      last_run_(0), last_reject_(false), last_valid_(false) {
     ;
   }
 
@@ -17,16 +18,21 @@ namespace ic {
     std::cout << "PreAnalysis Info for Run Filter" << std::endl;
     std::cout << "----------------------------------------" << std::endl;
     std::cout << "Filtered runs:" << std::endl;
-    for (std::set<int>::const_iterator it = runs_to_filter.begin(); it != runs_to_filter.end(); ++it) {
+    for (std::vector<int>::const_iterator it = runs_to_filter.begin(); it != runs_to_filter.end(); ++it) {
       std::cout << *it << std::endl;
     }
     return 0;
   }
 
   int RunFilter::Execute(TreeEvent *event) {
-    EventInfo const* eventInfo = event->GetPtr<EventInfo>("eventInfo");
-    unsigned run = eventInfo->run();
-    if (runs_to_filter.count(run) > 0) {
+    EventInfo const* eventInfo = event->GetConstPtr<EventInfo>("eventInfo");
+    int run = eventInfo->run();
+    if (!last_valid_ || run != last_run_) {
+      last_reject_ = std::binary_search(runs_to_filter.begin(), runs_to_filter.end(), run);
+      last_run_ = run;
+      last_valid_ = true;
+    }
+    if (last_reject_) {
       return 1;
     } else {
       return 0;
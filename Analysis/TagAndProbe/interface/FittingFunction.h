@@ -1,10 +1,35 @@
 #ifndef ICHiggsTauTau_Analysis_TagAndProbe_FittingFunction_h
 #define ICHiggsTauTau_Analysis_TagAndProbe_FittingFunction_h
 #include <string>
+#include <vector>
+#include <utility>
 
 
     int fit(std::string filename, std::string type, bool elec, bool isdata);
     int fitone(std::string filename, std::string type, bool elec, bool isdata, double low, double high, bool isbifurc, bool samemean);
 
+    // Outcome of the simultaneous pass/fail fit in one bin
+    struct FitBinResult {
+        std::string bin;
+        std::string type;
+        double eff;
+        double eff_err;
+        double nsig_pass;
+        double nsig_fail;
+        int status;       // minimiser status, -1 if the fit could not be run
+        int cov_qual;     // 3 for a full, accurate covariance matrix
+        double prob_pass; // chi2 probability of the pass and fail fits
+        double prob_fail;
+        bool good;        // same criterion as fit(): both probabilities > 0.005
+    };
+
+    // Runs the same fit as fit() for each (bin, type) pair. The bins are
+    // independent, so up to njobs of them are fitted at once, each in its
+    // own process with its own copy of the model and data. The efficiencies
+    // are appended to the usual <lepton>_eff_<data/MC>.txt file in the
+    // order of the input and a summary table is printed at the end.
+    std::vector<FitBinResult> fitbins(std::vector<std::pair<std::string, std::string> > const& bins,
+                                      bool elec, bool isdata, unsigned njobs);
+
 
 #endif
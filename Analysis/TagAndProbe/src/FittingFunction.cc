@@ -1,5 +1,9 @@
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/wait.h>
 #include <TSystem.h>
 #include "TFile.h"
 #include "TMath.h"
@@ -33,303 +37,201 @@ using std::ios;
 using std::cerr;
 using std::endl;
 
-    int fit(std::string filename, std::string type, bool elec, bool isdata){
-
-        RooRealVar* rooMass_ = new RooRealVar("Mass","Mass of lepton pair",60.0, 120.0,
-            "GeV/c^{2}");
-
-        RooRealVar Mass = *rooMass_;
-        RooCategory sample("sample","");
-        sample.defineType("Pass", 1);
-        sample.defineType("Fail", 2); 
-
-        std::string TP,TF;
-
-        if(type =="id" || type=="idbins")
-        {
-            TP="id_h_TP_";
-            TF="id_h_TF_";
-        }
-        if(type =="iso" || type=="isobins")
-        {
-            TP="iso_h_TP_";
-            TF="iso_h_TF_";
-        }
-        if(type =="idiso" || type == "idisobins")
-        {
-            TP="idiso_h_TP_";
-            TF="idiso_h_TF_";
-        }
-        if(type =="trg")
-        {
-            TP="h_TP_";
-            TF="h_TF_";
-        }
-
-        TFile* f=NULL;
-
-        if(elec && (type=="id" || type=="iso" || type=="idiso"|| type=="idbins" || type=="isobins" || type=="idisobins") && isdata)
-        {
-            f=new TFile("eeTandPIdIsodata.root","r");
-        }
-        if(elec && (type=="id" || type=="iso" || type=="idiso"|| type=="idbins" || type=="isobins" || type=="idisobins") && !isdata)
-        {
-            f=new TFile("eeTandPIdIsoMC.root","r");
-        }
-        if(elec && (type=="trg") && isdata)
-        {
-            f=new TFile("eeTandPtrgdata.root","r");
-        }
-        if(elec && (type=="trg") && !isdata)
-        {
-            f=new TFile("eeTandPtrgMC.root","r");
-        }
-        if(!elec && (type=="id" || type=="iso" || type=="idiso"|| type=="idbins" || type=="isobins" || type=="idisobins") && isdata)
-        {
-            f=new TFile("mumuTandPIdIsodata.root","r");
-        }
-        if(!elec && (type=="id" || type=="iso" || type=="idiso"|| type=="idbins" || type=="isobins" || type=="idisobins") && !isdata)
-        {
-            f=new TFile("mumuTandPIdIsoMC.root","r");
-        }
-        if(!elec && (type=="trg") && isdata)
-        {
-            f=new TFile("mumuTandPtrgdata.root","r");
-        }
-        if(!elec && (type=="trg") && !isdata)
-        {
-            f=new TFile("mumuTandPtrgMC.root","r");
-        }
-
-
-        TFile* f2 = new TFile("FitHistos.root", "RECREATE");
-        f2->cd();
-
-        std::ofstream myfile, myfile2;
-        if(elec && isdata)
-        {
-            myfile2.open("electron_eff_data.txt", ios::out | ios::app);
-        }
-        if(!elec && isdata)
-        {
-            myfile2.open("muon_eff_data.txt", ios::out | ios::app);
-        }
-        if(elec && !isdata)
-        {
-            myfile2.open("electron_eff_MC.txt", ios::out | ios::app);
-        }
-        if(!elec && !isdata)
-        {
-            myfile2.open("muon_eff_MC.txt", ios::out | ios::app);
-        }
-        //Read in the pass and fail histograms, output of eeTagandProbe.C.
-        TH1F *hist_pass = (TH1F*)f->Get((TP+filename).c_str());
-        TH1F *hist_fail = (TH1F*)f->Get((TF+filename).c_str());
-
-        
-        //Specify the two sets of data in the form of DataHists.
-        RooDataHist* data_pass = new RooDataHist("data_pass","data_pass",
-        RooArgList(Mass), hist_pass);
-        RooDataHist* data_fail = new RooDataHist("data_fail","data_fail",
-        RooArgList(Mass), hist_fail);
-        //Create a combined dataset of the two datasets so that they can be fit
-        //simultanously at the end.
-        RooDataHist* data_comb = new RooDataHist("fitData","fitData",
-        RooArgList(Mass),RooFit::Index(sample),RooFit::Import("Pass",*data_pass),
-        RooFit::Import("Fail",*data_fail) );
-
-
-        //Set up the fit parameters for background and signal
-        //RooRealVar* MeanFail_= new RooRealVar("MeanFail","MeanFail",
-        //91.1, 88.8, 93.2);
-        //90.0, 86.2, 95.2);
-
-        RooRealVar* WidthFail_= new RooRealVar("WidthFail","WidthFail", 2, 1, 10);
-
-        RooRealVar* ResolutionFail_= new RooRealVar("ResolutionFail",
-        "ResolutionFail", 2.0, 0.1, 5.);
-
-        RooRealVar* MeanPass_= new RooRealVar("MeanPass","MeanPass",
-        91.1, 88.8, 93.2);
-        //90.0, 86.2, 95.2);
-        RooRealVar* WidthPass_= new RooRealVar("WidthPass","WidthPass", 2.5, 1, 10);
-        RooRealVar* ResolutionPass_= new RooRealVar("ResolutionPass",
-        "ResolutionPass", 1.5, 0.1, 5.);
-
-
-        //RooRealVar* WidthLPass_  = new RooRealVar("WidthLPass","WidthLPass",
-       // 3., 1., 10.);
-       // RooRealVar* WidthRPass_  = new RooRealVar("WidthRPass","WidthRPass",
-       // 3., 1., 10.);
-//        RooRealVar* BifurGaussFracPass_ = new RooRealVar("BifurGaussFracPass",
-//        "",0.2, 0.0, 1.0);
-
-
-//        RooRealVar* WidthLFail_  = new RooRealVar("WidthLFail","WidthLFail",
-//        3., 1., 10.);
-//        RooRealVar* WidthRFail_  = new RooRealVar("WidthRFail","WidthRFail",
-//        3., 1., 10.);
-//        RooRealVar* BifurGaussFracFail_ = new RooRealVar("BifurGaussFracFail",
-//        "", 0.2, 0.0, 1.0);
-
-
-        //Generate PDFs based on these parameters for fitting. There are many 
-        //possibilities and combinations that could be used-see Andrew's 
-        //original code for some ideas.
+namespace {
 
-        //voigtian=breit wigner convoluted with gaussian for detector resolution.
+    // Input file and pass/fail histogram prefixes, as chosen in fit()
+    std::string InputFileName(std::string const& type, bool elec, bool isdata)
+    {
+        std::string kind;
+        if(type=="id" || type=="iso" || type=="idiso"|| type=="idbins" || type=="isobins" || type=="idisobins") kind="IdIso";
+        if(type=="trg") kind="trg";
+        if(kind=="") return "";
+        return std::string(elec ? "ee" : "mumu")+"TandP"+kind+(isdata ? "data" : "MC")+".root";
+    }
 
-        RooAbsPdf* voigtianPassPdf= new RooVoigtian("voigtianPassPdf", "", Mass,
-        *MeanPass_, *WidthPass_, *ResolutionPass_);
-        RooAbsPdf* voigtianFailPdf= new RooVoigtian("voigtianFailPdf", "", Mass,
-        *MeanPass_, *WidthFail_, *ResolutionFail_);
+    // The text file the efficiencies are appended to
+    std::string EffFileName(bool elec, bool isdata)
+    {
+        return std::string(elec ? "electron" : "muon")+"_eff_"+(isdata ? "data" : "MC")+".txt";
+    }
 
+    std::pair<std::string, std::string> HistPrefixes(std::string const& type)
+    {
+        if(type =="id" || type=="idbins") return std::make_pair("id_h_TP_", "id_h_TF_");
+        if(type =="iso" || type=="isobins") return std::make_pair("iso_h_TP_", "iso_h_TF_");
+        if(type =="idiso" || type=="idisobins") return std::make_pair("idiso_h_TP_", "idiso_h_TF_");
+        if(type =="trg") return std::make_pair("h_TP_", "h_TF_");
+        return std::make_pair("", "");
+    }
 
-/*
-        //bifur=bifurcated gaussian
+    // The numerical part of FitBinResult, passed back from the worker
+    // processes through a pipe
+    struct FitNumbers {
+        double eff, eff_err, nsig_pass, nsig_fail, prob_pass, prob_fail;
+        int status, cov_qual;
+        bool good;
+    };
+
+    // The simultaneous pass/fail model and fit used by fit() and fitbins(),
+    // with every object owned by this call so that bins never share state.
+    // With verbose the fit result and yields are printed and the pass and
+    // fail fits are drawn on the canvases c1 and c2, which are left open.
+    FitNumbers FitPassFail(TH1 *hist_pass, TH1 *hist_fail, bool verbose = false)
+    {
+        FitNumbers res = {0., 0., 0., 0., 0., 0., -1, -1, false};
+
+        RooRealVar Mass("Mass","Mass of lepton pair",60.0, 120.0, "GeV/c^{2}");
+        RooCategory sample("sample","");
+        sample.defineType("Pass", 1);
+        sample.defineType("Fail", 2);
 
-        RooAbsPdf* bifurGaussPassPdf_ = new RooBifurGauss("bifurGaussPassPdf", 
-        "", Mass, *MeanPass_, *WidthLPass_, *WidthRPass_);
-        RooAbsPdf* bifurGaussFailPdf_ = new RooBifurGauss("bifurGaussFailPdf",
-        "", Mass, *MeanFail_, *WidthLFail_, *WidthRFail_);
+        RooDataHist data_pass("data_pass","data_pass", RooArgList(Mass), hist_pass);
+        RooDataHist data_fail("data_fail","data_fail", RooArgList(Mass), hist_fail);
+        RooDataHist data_comb("fitData","fitData", RooArgList(Mass),RooFit::Index(sample),
+        RooFit::Import("Pass",data_pass), RooFit::Import("Fail",data_fail));
 
-*/
+        RooRealVar WidthFail("WidthFail","WidthFail", 2, 1, 10);
+        RooRealVar ResolutionFail("ResolutionFail", "ResolutionFail", 2.0, 0.1, 5.);
+        RooRealVar MeanPass("MeanPass","MeanPass", 91.1, 88.8, 93.2);
+        RooRealVar WidthPass("WidthPass","WidthPass", 2.5, 1, 10);
+        RooRealVar ResolutionPass("ResolutionPass", "ResolutionPass", 1.5, 0.1, 5.);
 
-        //--------------------------------------------------------------------------
-        // Variables for the fraction when using two summed PDFs
-        //--------------------------------------------------------------------------
-  //       RooRealVar* FracPass_ = new RooRealVar("FracPass","",0.75, 0.5, 1.0);
-  //       RooRealVar* FracFail_ = new RooRealVar("FracFail","",0.75, 0.5, 1.0);
+        RooVoigtian voigtianPassPdf("voigtianPassPdf", "", Mass, MeanPass, WidthPass, ResolutionPass);
+        RooVoigtian voigtianFailPdf("voigtianFailPdf", "", Mass, MeanPass, WidthFail, ResolutionFail);
 
-        RooAbsPdf* signalShapePassPdf= voigtianPassPdf;
-        RooAbsPdf* signalShapeFailPdf= voigtianFailPdf;
-/*
-        RooAbsPdf* signalShapePassPdf= new RooAddPdf("signalShapePassPdf", "", 
-        *voigtianPassPdf, *bifurGaussPassPdf_, *FracPass_);
-        RooAbsPdf* signalShapeFailPdf= new RooAddPdf("signalShapeFailPdf", "", 
-        *voigtianFailPdf, *bifurGaussFailPdf_, *FracFail_);
-*/
+        RooRealVar bkgShapePass("bkgShapePass","bkgShapePass", -0.0001,-10.,0.);
+        RooRealVar bkgShapeFail("bkgShapeFail","bkgShapeFail", -0.0001,-10.,0.);
+        RooExponential bkgShapePassPdf("bkgShapePassPdf", "bkgShapePassPdf",Mass, bkgShapePass);
+        RooExponential bkgShapeFailPdf("bkgShapeFailPdf", "bkgShapeFailPdf",Mass, bkgShapeFail);
 
-        // Background PDFs are exponentials (so why all the stuff above?) 
-        RooRealVar* bkgShapePass = new RooRealVar("bkgShapePass","bkgShapePass",
-        -0.0001,-10.,0.);
-        RooRealVar* bkgShapeFail = new RooRealVar("bkgShapeFail","bkgShapeFail",
-        -0.0001,-10.,0.);
+        RooRealVar nSigPass("nSigPass", "nSigPass", 1000,0.0,5000000.0);
+        RooRealVar nSigFail("nSigFail", "nSigFail", 1000,0.0,5000000.0);
+        RooRealVar nBkgPass("nBkgPass","nBkgPass", 1000.0, 0.0, 10000000.0);
+        RooRealVar nBkgFail("nBkgFail","nBkgFail", 1000.0, 0.0, 10000000.0);
+        RooFormulaVar eff("eff","nSigPass/(nSigPass+nSigFail)",RooArgList(nSigPass,nSigFail));
 
-        RooExponential* bkgShapePassPdf = new RooExponential("bkgShapePassPdf",
-        "bkgShapePassPdf",Mass, *bkgShapePass);
-        RooExponential* bkgShapeFailPdf = new RooExponential("bkgShapeFailPdf",
-        "bkgShapeFailPdf",Mass, *bkgShapeFail);
+        RooAddPdf pdfPass("pdfPass","extended sum pdf", RooArgList(voigtianPassPdf,bkgShapePassPdf), RooArgList(nSigPass, nBkgPass));
+        RooAddPdf pdfFail("pdfFail","extended sum pdf", RooArgList(voigtianFailPdf,bkgShapeFailPdf), RooArgList(nSigFail, nBkgFail));
 
-        RooRealVar* nSigPass = new RooRealVar("nSigPass", "nSigPass",
-        1000,0.0,5000000.0);
-        RooRealVar* nSigFail = new RooRealVar("nSigFail", "nSigFail",
-        1000,0.0,5000000.0);
-        RooRealVar* nBkgPass = new RooRealVar("nBkgPass","nBkgPass",
-        1000.0, 0.0, 10000000.0);
-        RooRealVar* nBkgFail = new RooRealVar("nBkgFail","nBkgFail",
-        1000.0, 0.0, 10000000.0);
-        RooFormulaVar* eff = new RooFormulaVar("eff","nSigPass/(nSigPass+nSigFail)",RooArgList(*nSigPass,*nSigFail));
-
-        RooArgList componentsPass(*signalShapePassPdf,*bkgShapePassPdf);
-        RooArgList yieldsPass(*nSigPass, *nBkgPass);
-        RooArgList componentsFail(*signalShapeFailPdf,*bkgShapeFailPdf);
-        RooArgList yieldsFail(*nSigFail, *nBkgFail);
-
-        //Add the signal and background components together weighted by the numbers
-        //of signal and background.
-        RooAddPdf pdfPass("pdfPass","extended sum pdf", componentsPass, yieldsPass);
-        RooAddPdf pdfFail("pdfFail","extended sum pdf", componentsFail, yieldsFail);
-
-        // The total simultaneous fit ...
         RooSimultaneous totalPdf("totalPdf","totalPdf", sample);
         totalPdf.addPdf(pdfPass,"Pass");
-        totalPdf.Print();
         totalPdf.addPdf(pdfFail,"Fail");
-        totalPdf.Print();
-
-        RooFitResult *fitResult = totalPdf.fitTo(*data_comb, RooFit::Save(true), 
-        RooFit::Extended(true), RooFit::PrintLevel(-1),SumW2Error(kFALSE));
-        if (fitResult->covQual()!=3) cerr << "WARNING -- inaccurate errors" << endl;
-        fitResult->Print("v");
-
-        std::cout << "nSigPass: " << nSigPass->getVal() << std::endl;
-        std::cout << "nBkgPass: " << nBkgPass->getVal() << std::endl;
-        std::cout << "Total: " << nSigPass->getVal()+ nBkgPass->getVal()
-        << std::endl;
-        std::cout << "nSigFail: " << nSigFail->getVal() << std::endl;
-        std::cout << "nBkgFail: " << nBkgFail->getVal() << std::endl;
-        std::cout << "Total: " << nSigFail->getVal()+ nBkgFail->getVal()
-        << std::endl;
-        std::cout << "Eff: " << eff->getVal()<< "+/-" << 
-        eff->getPropagatedError(*fitResult) << std::endl;
-        RooAbsData::ErrorType errorType = RooAbsData::Poisson;
+        if (verbose) totalPdf.Print();
+
+        std::unique_ptr<RooFitResult> fitResult(totalPdf.fitTo(data_comb, RooFit::Save(true),
+        RooFit::Extended(true), RooFit::PrintLevel(-1),SumW2Error(kFALSE)));
+        if (!fitResult) return res;
+
+        res.status = fitResult->status();
+        res.cov_qual = fitResult->covQual();
+        res.eff = eff.getVal();
+        res.eff_err = eff.getPropagatedError(*fitResult);
+        res.nsig_pass = nSigPass.getVal();
+        res.nsig_fail = nSigFail.getVal();
+
+        if (verbose)
+        {
+            if (fitResult->covQual()!=3) cerr << "WARNING -- inaccurate errors" << endl;
+            fitResult->Print("v");
+            std::cout << "nSigPass: " << nSigPass.getVal() << std::endl;
+            std::cout << "nBkgPass: " << nBkgPass.getVal() << std::endl;
+            std::cout << "Total: " << nSigPass.getVal()+ nBkgPass.getVal() << std::endl;
+            std::cout << "nSigFail: " << nSigFail.getVal() << std::endl;
+            std::cout << "nBkgFail: " << nBkgFail.getVal() << std::endl;
+            std::cout << "Total: " << nSigFail.getVal()+ nBkgFail.getVal() << std::endl;
+            std::cout << "Eff: " << res.eff << "+/-" << res.eff_err << std::endl;
+        }
+
+        // chi2 of the full pdf against the data. The background component is
+        // only drawn before it, so it does not enter the chi2.
+        std::unique_ptr<RooPlot> frame1(Mass.frame());
+        data_pass.plotOn(frame1.get(),RooFit::DataError(RooAbsData::Poisson),SumW2Error(kTRUE));
+        if (verbose) pdfPass.plotOn(frame1.get(),RooFit::ProjWData(data_pass),
+        RooFit::Components(bkgShapePassPdf),RooFit::LineColor(kRed), SumW2Error(kTRUE));
+        pdfPass.plotOn(frame1.get(),RooFit::ProjWData(data_pass), SumW2Error(kTRUE));
+        res.prob_pass = TMath::Prob(frame1->chiSquare(), 6);
+        std::unique_ptr<RooPlot> frame2(Mass.frame());
+        data_fail.plotOn(frame2.get(),RooFit::DataError(RooAbsData::Poisson));
+        if (verbose) pdfFail.plotOn(frame2.get(),RooFit::ProjWData(data_fail),
+        RooFit::Components(bkgShapeFailPdf),RooFit::LineColor(kRed));
+        pdfFail.plotOn(frame2.get(),RooFit::ProjWData(data_fail));
+        res.prob_fail = TMath::Prob(frame2->chiSquare(), 6);
+
+        if (verbose)
+        {
+            // The frames are handed over to the canvases
+            TCanvas* c1 = new TCanvas("c1","c1",600,600);
+            frame1->SetMinimum(0);
+            std::cout << frame1->chiSquare() << std::endl;
+            std::cout << res.prob_pass << std::endl;
+            frame1.release()->Draw("e0");
+            c1->Update();
+            TCanvas* c2 = new TCanvas("c2","c2",600,600);
+            frame2->SetMinimum(0);
+            std::cout << frame2->chiSquare() << std::endl;
+            std::cout << res.prob_fail << std::endl;
+            frame2.release()->Draw("e0");
+            c2->Update();
+        }
+
+        res.good = res.prob_pass > 0.005 && res.prob_fail > 0.005;
+        return res;
+    }
 
-        //TCanvas* c1 = new TCanvas("c1","c1",600,600);
-        RooPlot* frame1 = Mass.frame();
-        frame1->SetMinimum(0);
-        data_pass->plotOn(frame1,RooFit::DataError(errorType),SumW2Error(kTRUE));
-        pdfPass.plotOn(frame1,RooFit::ProjWData(*data_pass), 
-        RooFit::Components(*bkgShapePassPdf),RooFit::LineColor(kRed), SumW2Error(kTRUE));
-        pdfPass.plotOn(frame1,RooFit::ProjWData(*data_pass), SumW2Error(kTRUE));
-        TCanvas* c1 = new TCanvas("c1","c1",600,600);
-        frame1->Draw("e0");
+    FitNumbers FitBin(std::string const& bin, std::string const& type, bool elec, bool isdata)
+    {
+        FitNumbers res = {0., 0., 0., 0., 0., 0., -1, -1, false};
+        std::string filename = InputFileName(type, elec, isdata);
+        std::pair<std::string, std::string> prefixes = HistPrefixes(type);
+        if(filename=="")
+        {
+            cerr << "Unknown measurement type " << type << endl;
+            return res;
+        }
+        TFile f(filename.c_str(), "r");
+        TH1 *hist_pass = dynamic_cast<TH1*>(f.Get((prefixes.first+bin).c_str()));
+        TH1 *hist_fail = dynamic_cast<TH1*>(f.Get((prefixes.second+bin).c_str()));
+        if(!hist_pass || !hist_fail)
+        {
+            cerr << "Pass/fail histograms for bin " << bin << " not found in " << filename << endl;
+            return res;
+        }
+        res = FitPassFail(hist_pass, hist_fail);
+        f.Close();
+        return res;
+    }
+}
 
-        std::cout << frame1->chiSquare() << std::endl;
-        std::cout << TMath::Prob(frame1->chiSquare(), 6) << std::endl;
+    int fit(std::string filename, std::string type, bool elec, bool isdata){
 
-        // Add some text with the results
-      /*  TLatex *title_latex = new TLatex();
-        title_latex->SetNDC();
-        title_latex->SetTextSize(0.03);
-        boost::format f_nSigPass("SigPass: %.1f #pm %.1f");
-        f_nSigPass % nSigPass->getVal() % nSigPass->getError();
-        boost::format f_nBkgPass("BkgPass: %.1f #pm %.1f");
-        f_nBkgPass % nBkgPass->getVal() % nBkgPass->getError();
-        boost::format f_eff("Eff: %.3f #pm %.3f");
-        f_eff % eff->getVal() %eff->getPropagatedError(*fitResult);
-        title_latex->DrawLatex(0.62,0.89,f_nSigPass.str().c_str());
-        title_latex->DrawLatex(0.62,0.85,f_nBkgPass.str().c_str());
-        title_latex->DrawLatex(0.62,0.81,f_eff.str().c_str());*/
+        std::string input = InputFileName(type, elec, isdata);
+        std::pair<std::string, std::string> prefixes = HistPrefixes(type);
+        if(input=="")
+        {
+            cerr << "Unknown measurement type " << type << endl;
+            return 1;
+        }
+        TFile* f=new TFile(input.c_str(),"r");
 
-        c1->Update();
-    //    c1->SaveAs("ee_TP_fit.pdf");
+        TFile* f2 = new TFile("FitHistos.root", "RECREATE");
+        f2->cd();
 
-        TCanvas* c2 = new TCanvas("c2","c2",600,600);
-        RooPlot* frame2 = Mass.frame();
-        frame2->SetMinimum(0);
-        data_fail->plotOn(frame2,RooFit::DataError(errorType));
-        pdfFail.plotOn(frame2,RooFit::ProjWData(*data_fail), 
-        RooFit::Components(*bkgShapeFailPdf),RooFit::LineColor(kRed));
-        pdfFail.plotOn(frame2,RooFit::ProjWData(*data_fail));
-        frame2->Draw("e0");
-        std::cout << frame2->chiSquare() << std::endl;
-        std::cout << TMath::Prob(frame2->chiSquare(), 6) << std::endl;
+        std::ofstream myfile2;
+        myfile2.open(EffFileName(elec, isdata).c_str(), ios::out | ios::app);
 
+        //Read in the pass and fail histograms, output of eeTagandProbe.C.
+        TH1F *hist_pass = (TH1F*)f->Get((prefixes.first+filename).c_str());
+        TH1F *hist_fail = (TH1F*)f->Get((prefixes.second+filename).c_str());
 
-       /* boost::format f_nSigFail("SigFail: %.1f #pm %.1f");
-        f_nSigFail % nSigFail->getVal() % nSigFail->getError();
-        boost::format f_nBkgFail("BkgFail: %.1f #pm %.1f");
-        f_nBkgFail % nBkgFail->getVal() % nBkgFail->getError();
-        title_latex->DrawLatex(0.62,0.89,f_nSigFail.str().c_str());
-        title_latex->DrawLatex(0.62,0.85,f_nBkgFail.str().c_str());
-        title_latex->DrawLatex(0.62,0.81,f_eff.str().c_str());
-*/
-        c2->Update();
-    //    c2->SaveAs("ee_TF_fit.pdf");
-        double results[2];
-        results[0]=eff->getVal();
-        results[1]=eff->getPropagatedError(*fitResult);
-        if(TMath::Prob(frame1->chiSquare(),6)>0.005 && TMath::Prob(frame2->chiSquare(),6)>0.005)
+        FitNumbers res = FitPassFail(hist_pass, hist_fail, true);
+        if(res.good)
         { 
-      //      myfile << type << " " << filename << " " << results[0] << " " << results[1] << std::endl;
-            myfile2 << type << " " << filename << " " << results[0] << " " << results[1] << std::endl;
+            myfile2 << type << " " << filename << " " << res.eff << " " << res.eff_err << std::endl;
         }
         else
         { 
             std::cout << "============POOR FIT: " << filename << " ============"<< std::endl;
-        //    myfile << "============POOR FIT: " << filename << " ============"<< std::endl;
-            myfile2 << "============POOR FIT========: " << type << " " << filename << " " << results[0] << " " << results[1] << std::endl;
+            myfile2 << "============POOR FIT========: " << type << " " << filename << " " << res.eff << " " << res.eff_err << std::endl;
         }
         myfile2.close();
 
@@ -682,3 +584,113 @@ using std::endl;
 
 
 
+
+
+    std::vector<FitBinResult> fitbins(std::vector<std::pair<std::string, std::string> > const& bins,
+                                      bool elec, bool isdata, unsigned njobs){
+
+        std::vector<FitNumbers> numbers(bins.size());
+        if(njobs<=1)
+        {
+            for(unsigned i=0; i<bins.size(); ++i) numbers[i]=FitBin(bins[i].first, bins[i].second, elec, isdata);
+        }
+        else
+        {
+            // Fork one worker per bin, keeping at most njobs alive. RooFit
+            // is not thread-safe, so processes rather than threads are used.
+            std::cout.flush();
+            fflush(stdout);
+            std::vector<int> readfd(bins.size(), -1);
+            std::vector<pid_t> pids(bins.size(), -1);
+            unsigned next=0, running=0;
+            while(next<bins.size() || running>0)
+            {
+                if(next<bins.size() && running<njobs)
+                {
+                    int fds[2];
+                    pid_t pid = -1;
+                    if(pipe(fds)==0) pid = fork();
+                    if(pid==0)
+                    {
+                        close(fds[0]);
+                        FitNumbers res = FitBin(bins[next].first, bins[next].second, elec, isdata);
+                        ssize_t written = write(fds[1], &res, sizeof(res));
+                        close(fds[1]);
+                        _exit(written==static_cast<ssize_t>(sizeof(res)) ? 0 : 1);
+                    }
+                    if(pid<0)
+                    {
+                        cerr << "Could not start a worker for bin " << bins[next].first << ", fitting it in-process" << endl;
+                        numbers[next]=FitBin(bins[next].first, bins[next].second, elec, isdata);
+                    }
+                    else
+                    {
+                        close(fds[1]);
+                        readfd[next]=fds[0];
+                        pids[next]=pid;
+                        ++running;
+                    }
+                    ++next;
+                    continue;
+                }
+                int wstatus=0;
+                pid_t done = wait(&wstatus);
+                if(done<0) break;
+                for(unsigned i=0; i<bins.size(); ++i)
+                {
+                    if(pids[i]!=done) continue;
+                    FitNumbers res = {0., 0., 0., 0., 0., 0., -1, -1, false};
+                    if(read(readfd[i], &res, sizeof(res))!=static_cast<ssize_t>(sizeof(res)))
+                    {
+                        cerr << "Worker for bin " << bins[i].first << " failed" << endl;
+                    }
+                    numbers[i]=res;
+                    close(readfd[i]);
+                    pids[i]=-1;
+                    --running;
+                }
+            }
+        }
+
+        std::ofstream myfile2;
+        myfile2.open(EffFileName(elec, isdata).c_str(), ios::out | ios::app);
+
+        std::vector<FitBinResult> results(bins.size());
+        std::cout << boost::format("%-10s %-12s %8s %8s %10s %10s %6s %4s %8s %8s %s\n")
+            % "type" % "bin" % "eff" % "err" % "nSigPass" % "nSigFail" % "status" % "cov" % "probP" % "probF" % "";
+        for(unsigned i=0; i<bins.size(); ++i)
+        {
+            FitNumbers const& n = numbers[i];
+            FitBinResult & r = results[i];
+            r.bin=bins[i].first;
+            r.type=bins[i].second;
+            r.eff=n.eff;
+            r.eff_err=n.eff_err;
+            r.nsig_pass=n.nsig_pass;
+            r.nsig_fail=n.nsig_fail;
+            r.status=n.status;
+            r.cov_qual=n.cov_qual;
+            r.prob_pass=n.prob_pass;
+            r.prob_fail=n.prob_fail;
+            r.good=n.good;
+            if(r.status<0) continue;
+            if(r.good)
+            {
+                myfile2 << r.type << " " << r.bin << " " << r.eff << " " << r.eff_err << std::endl;
+            }
+            else
+            {
+                myfile2 << "============POOR FIT========: " << r.type << " " << r.bin << " " << r.eff << " " << r.eff_err << std::endl;
+            }
+        }
+        myfile2.close();
+
+        for(unsigned i=0; i<results.size(); ++i)
+        {
+            FitBinResult const& r = results[i];
+            std::cout << boost::format("%-10s %-12s %8.4f %8.4f %10.1f %10.1f %6i %4i %8.3g %8.3g %s\n")
+                % r.type % r.bin % r.eff % r.eff_err % r.nsig_pass % r.nsig_fail % r.status % r.cov_qual
+                % r.prob_pass % r.prob_fail % (r.status<0 ? "FAILED" : (r.good ? "" : "POOR FIT"));
+        }
+        return results;
+    }
@@ -23,13 +23,16 @@ bool isdata;
   for (int i = 0; i < argc; ++i){
     std::cout << i << "\t" << argv[i] << std::endl;
   }
-  if (argc != 4){
-    std::cerr << "Need 2 args: <id/iso/idiso/trg> <iselec> <isdata>" << std::endl;
+  if (argc != 4 && argc != 5){
+    std::cerr << "Need args: <id/iso/idiso/trg> <iselec> <isdata> [njobs]" << std::endl;
     exit(1);
   }
 
     elec=boost::lexical_cast<bool>(argv[2]);
     isdata=boost::lexical_cast<bool>(argv[3]);
+    //Number of bins to fit at once
+    unsigned njobs = argc==5 ? boost::lexical_cast<unsigned>(argv[4]) : 1;
+    std::vector<std::pair<std::string, std::string> > bins;
 
 //std::cout << "elec:  " << elec << " argv[2]: " << argv[2]<<std::endl;
 //std::cout << "isdata:  " << isdata << " argv[3]: " << *argv[3] << std::endl;
@@ -48,22 +51,22 @@ bool isdata;
         std::string s9="3Eb";
         if(elec)
         {
-            fit(s1,"id", elec, isdata);
-            fit(s2,"id", elec, isdata);
-            fit(s4,"id", elec, isdata);
-            fit(s5,"id", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("id")));
+            bins.push_back(std::make_pair(s2, std::string("id")));
+            bins.push_back(std::make_pair(s4, std::string("id")));
+            bins.push_back(std::make_pair(s5, std::string("id")));
         }
         else
         {
-            fit(s1,"id", elec, isdata);
-            fit(s2,"id", elec, isdata);
-            fit(s3,"id", elec, isdata);
-            fit(s4,"id", elec, isdata);
-            fit(s5,"id", elec, isdata);
-            fit(s6,"id", elec, isdata);
-            fit(s7,"id", elec, isdata);
-            fit(s8,"id", elec, isdata);
-            fit(s9,"id", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("id")));
+            bins.push_back(std::make_pair(s2, std::string("id")));
+            bins.push_back(std::make_pair(s3, std::string("id")));
+            bins.push_back(std::make_pair(s4, std::string("id")));
+            bins.push_back(std::make_pair(s5, std::string("id")));
+            bins.push_back(std::make_pair(s6, std::string("id")));
+            bins.push_back(std::make_pair(s7, std::string("id")));
+            bins.push_back(std::make_pair(s8, std::string("id")));
+            bins.push_back(std::make_pair(s9, std::string("id")));
         }
     }
     if(type=="iso")
@@ -79,22 +82,22 @@ bool isdata;
         std::string s9="3Eb";
         if(elec)
         {
-            fit(s1,"iso", elec, isdata);
-            fit(s2,"iso", elec, isdata);
-            fit(s4,"iso", elec, isdata);
-            fit(s5,"iso", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("iso")));
+            bins.push_back(std::make_pair(s2, std::string("iso")));
+            bins.push_back(std::make_pair(s4, std::string("iso")));
+            bins.push_back(std::make_pair(s5, std::string("iso")));
         }
         else
         {
-            fit(s1,"iso", elec, isdata);
-            fit(s2,"iso", elec, isdata);
-            fit(s3,"iso", elec, isdata);
-            fit(s4,"iso", elec, isdata);
-            fit(s5,"iso", elec, isdata);
-            fit(s6,"iso", elec, isdata);
-            fit(s7,"iso", elec, isdata);
-            fit(s8,"iso", elec, isdata);
-            fit(s9,"iso", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("iso")));
+            bins.push_back(std::make_pair(s2, std::string("iso")));
+            bins.push_back(std::make_pair(s3, std::string("iso")));
+            bins.push_back(std::make_pair(s4, std::string("iso")));
+            bins.push_back(std::make_pair(s5, std::string("iso")));
+            bins.push_back(std::make_pair(s6, std::string("iso")));
+            bins.push_back(std::make_pair(s7, std::string("iso")));
+            bins.push_back(std::make_pair(s8, std::string("iso")));
+            bins.push_back(std::make_pair(s9, std::string("iso")));
         }
     }
     if(type=="idiso")
@@ -110,22 +113,22 @@ bool isdata;
         std::string s9="3Eb";
         if(elec)
         {
-            fit(s1,"idiso", elec, isdata);
-            fit(s2,"idiso", elec, isdata);
-            fit(s4,"idiso", elec, isdata);
-            fit(s5,"idiso", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("idiso")));
+            bins.push_back(std::make_pair(s2, std::string("idiso")));
+            bins.push_back(std::make_pair(s4, std::string("idiso")));
+            bins.push_back(std::make_pair(s5, std::string("idiso")));
         }
         else
         {
-            fit(s1,"idiso", elec, isdata);
-            fit(s2,"idiso", elec, isdata);
-            fit(s3,"idiso", elec, isdata);
-            fit(s4,"idiso", elec, isdata);
-            fit(s5,"idiso", elec, isdata);
-            fit(s6,"idiso", elec, isdata);
-            fit(s7,"idiso", elec, isdata);
-            fit(s8,"idiso", elec, isdata);
-            fit(s9,"idiso", elec, isdata);
+            bins.push_back(std::make_pair(s1, std::string("idiso")));
+            bins.push_back(std::make_pair(s2, std::string("idiso")));
+            bins.push_back(std::make_pair(s3, std::string("idiso")));
+            bins.push_back(std::make_pair(s4, std::string("idiso")));
+            bins.push_back(std::make_pair(s5, std::string("idiso")));
+            bins.push_back(std::make_pair(s6, std::string("idiso")));
+            bins.push_back(std::make_pair(s7, std::string("idiso")));
+            bins.push_back(std::make_pair(s8, std::string("idiso")));
+            bins.push_back(std::make_pair(s9, std::string("idiso")));
         }
         
     }
@@ -146,21 +149,21 @@ bool isdata;
         std::string s25="1vtx";
         std::string s26="2vtx";
         std::string s27="3vtx";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);/*
-        fit(s25, "trg", elec, isdata);
-        fit(s26, "trg", elec, isdata);
-        fit(s27, "trg", elec, isdata);*/
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));/*
+        bins.push_back(std::make_pair(s25, std::string("trg")));
+        bins.push_back(std::make_pair(s26, std::string("trg")));
+        bins.push_back(std::make_pair(s27, std::string("trg")));*/
     }
     if(type=="trgE")
     {
@@ -188,32 +191,32 @@ bool isdata;
         std::string s22="10Eb";
         std::string s23="11Eb";
         std::string s24="12Eb";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));
         if(!elec)
         {
-            fit(s13, "trg", elec, isdata);
-            fit(s14, "trg", elec, isdata);
-            fit(s15, "trg", elec, isdata);
-            fit(s16, "trg", elec, isdata);
-            fit(s17, "trg", elec, isdata);
-            fit(s18, "trg", elec, isdata);
-            fit(s19, "trg", elec, isdata);
-            fit(s20, "trg", elec, isdata);
-            fit(s21, "trg", elec, isdata);
-            fit(s22, "trg", elec, isdata);
-            fit(s23, "trg", elec, isdata);
-            fit(s24, "trg", elec, isdata);
+            bins.push_back(std::make_pair(s13, std::string("trg")));
+            bins.push_back(std::make_pair(s14, std::string("trg")));
+            bins.push_back(std::make_pair(s15, std::string("trg")));
+            bins.push_back(std::make_pair(s16, std::string("trg")));
+            bins.push_back(std::make_pair(s17, std::string("trg")));
+            bins.push_back(std::make_pair(s18, std::string("trg")));
+            bins.push_back(std::make_pair(s19, std::string("trg")));
+            bins.push_back(std::make_pair(s20, std::string("trg")));
+            bins.push_back(std::make_pair(s21, std::string("trg")));
+            bins.push_back(std::make_pair(s22, std::string("trg")));
+            bins.push_back(std::make_pair(s23, std::string("trg")));
+            bins.push_back(std::make_pair(s24, std::string("trg")));
         }
     }
     if(type=="trgBplus")
@@ -230,18 +233,18 @@ bool isdata;
         std::string s10="10Bplus";
         std::string s11="11Bplus";
         std::string s12="12Bplus";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));
     }
     if(type=="trgEplus")
     {
@@ -269,32 +272,32 @@ bool isdata;
         std::string s22="10Ebplus";
         std::string s23="11Ebplus";
         std::string s24="12Ebplus";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));
         if(!elec)
         {
-            fit(s13, "trg", elec, isdata);
-            fit(s14, "trg", elec, isdata);
-            fit(s15, "trg", elec, isdata);
-            fit(s16, "trg", elec, isdata);
-            fit(s17, "trg", elec, isdata);
-            fit(s18, "trg", elec, isdata);
-            fit(s19, "trg", elec, isdata);
-            fit(s20, "trg", elec, isdata);
-            fit(s21, "trg", elec, isdata);
-            fit(s22, "trg", elec, isdata);
-            fit(s23, "trg", elec, isdata);
-            fit(s24, "trg", elec, isdata);
+            bins.push_back(std::make_pair(s13, std::string("trg")));
+            bins.push_back(std::make_pair(s14, std::string("trg")));
+            bins.push_back(std::make_pair(s15, std::string("trg")));
+            bins.push_back(std::make_pair(s16, std::string("trg")));
+            bins.push_back(std::make_pair(s17, std::string("trg")));
+            bins.push_back(std::make_pair(s18, std::string("trg")));
+            bins.push_back(std::make_pair(s19, std::string("trg")));
+            bins.push_back(std::make_pair(s20, std::string("trg")));
+            bins.push_back(std::make_pair(s21, std::string("trg")));
+            bins.push_back(std::make_pair(s22, std::string("trg")));
+            bins.push_back(std::make_pair(s23, std::string("trg")));
+            bins.push_back(std::make_pair(s24, std::string("trg")));
         }
     }
     if(type=="trgBminus")
@@ -311,18 +314,18 @@ bool isdata;
         std::string s10="10Bminus";
         std::string s11="11Bminus";
         std::string s12="12Bminus";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));
     }
     if(type=="trgEminus")
     {
@@ -350,32 +353,32 @@ bool isdata;
         std::string s22="10Ebminus";
         std::string s23="11Ebminus";
         std::string s24="12Ebminus";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
-        fit(s11, "trg", elec, isdata);
-        fit(s12, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
+        bins.push_back(std::make_pair(s11, std::string("trg")));
+        bins.push_back(std::make_pair(s12, std::string("trg")));
         if(!elec)
         {
-            fit(s13, "trg", elec, isdata);
-            fit(s14, "trg", elec, isdata);
-            fit(s15, "trg", elec, isdata);
-            fit(s16, "trg", elec, isdata);
-            fit(s17, "trg", elec, isdata);
-            fit(s18, "trg", elec, isdata);
-            fit(s19, "trg", elec, isdata);
-            fit(s20, "trg", elec, isdata);
-            fit(s21, "trg", elec, isdata);
-            fit(s22, "trg", elec, isdata);
-            fit(s23, "trg", elec, isdata);
-            fit(s24, "trg", elec, isdata);
+            bins.push_back(std::make_pair(s13, std::string("trg")));
+            bins.push_back(std::make_pair(s14, std::string("trg")));
+            bins.push_back(std::make_pair(s15, std::string("trg")));
+            bins.push_back(std::make_pair(s16, std::string("trg")));
+            bins.push_back(std::make_pair(s17, std::string("trg")));
+            bins.push_back(std::make_pair(s18, std::string("trg")));
+            bins.push_back(std::make_pair(s19, std::string("trg")));
+            bins.push_back(std::make_pair(s20, std::string("trg")));
+            bins.push_back(std::make_pair(s21, std::string("trg")));
+            bins.push_back(std::make_pair(s22, std::string("trg")));
+            bins.push_back(std::make_pair(s23, std::string("trg")));
+            bins.push_back(std::make_pair(s24, std::string("trg")));
         }
     }
     if(type=="trgbins")
@@ -390,16 +393,16 @@ bool isdata;
         std::string s8="8eta";
         std::string s9="9eta";
         std::string s10="10eta";
-        fit(s1, "trg", elec, isdata);
-        fit(s2, "trg", elec, isdata);
-        fit(s3, "trg", elec, isdata);
-        fit(s4, "trg", elec, isdata);
-        fit(s5, "trg", elec, isdata);
-        fit(s6, "trg", elec, isdata);
-        fit(s7, "trg", elec, isdata);
-        fit(s8, "trg", elec, isdata);
-        fit(s9, "trg", elec, isdata);
-        fit(s10, "trg", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("trg")));
+        bins.push_back(std::make_pair(s2, std::string("trg")));
+        bins.push_back(std::make_pair(s3, std::string("trg")));
+        bins.push_back(std::make_pair(s4, std::string("trg")));
+        bins.push_back(std::make_pair(s5, std::string("trg")));
+        bins.push_back(std::make_pair(s6, std::string("trg")));
+        bins.push_back(std::make_pair(s7, std::string("trg")));
+        bins.push_back(std::make_pair(s8, std::string("trg")));
+        bins.push_back(std::make_pair(s9, std::string("trg")));
+        bins.push_back(std::make_pair(s10, std::string("trg")));
     }
     if(type=="idbins")
     {
@@ -429,32 +432,32 @@ bool isdata;
         std::string s24="8vtx";
         std::string s25="9vtx";
         std::string s26="10vtx";
-        fit(s1, "idbins", elec, isdata);
-        fit(s2, "idbins", elec, isdata);
-        fit(s3, "idbins", elec, isdata);
-        fit(s4, "idbins", elec, isdata);
-        fit(s5, "idbins", elec, isdata);
-        fit(s6, "idbins", elec, isdata);
-        fit(s7, "idbins", elec, isdata);
-        fit(s8, "idbins", elec, isdata);
-        fit(s9, "idbins", elec, isdata);
-        fit(s10, "idbins", elec, isdata);
-        fit(s11, "idbins", elec, isdata);
-        fit(s12, "idbins", elec, isdata);
-        fit(s13, "idbins", elec, isdata);
-        fit(s14, "idbins", elec, isdata);
-        fit(s15, "idbins", elec, isdata);
-        fit(s16, "idbins", elec, isdata);
-        fit(s17, "idbins", elec, isdata);
-        fit(s18, "idbins", elec, isdata);
-        fit(s19, "idbins", elec, isdata);
-        fit(s20, "idbins", elec, isdata);
-        fit(s21, "idbins", elec, isdata);
-        fit(s22, "idbins", elec, isdata);
-        fit(s23, "idbins", elec, isdata);
-        fit(s24, "idbins", elec, isdata);
-        fit(s25, "idbins", elec, isdata);
-        fit(s26, "idbins", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("idbins")));
+        bins.push_back(std::make_pair(s2, std::string("idbins")));
+        bins.push_back(std::make_pair(s3, std::string("idbins")));
+        bins.push_back(std::make_pair(s4, std::string("idbins")));
+        bins.push_back(std::make_pair(s5, std::string("idbins")));
+        bins.push_back(std::make_pair(s6, std::string("idbins")));
+        bins.push_back(std::make_pair(s7, std::string("idbins")));
+        bins.push_back(std::make_pair(s8, std::string("idbins")));
+        bins.push_back(std::make_pair(s9, std::string("idbins")));
+        bins.push_back(std::make_pair(s10, std::string("idbins")));
+        bins.push_back(std::make_pair(s11, std::string("idbins")));
+        bins.push_back(std::make_pair(s12, std::string("idbins")));
+        bins.push_back(std::make_pair(s13, std::string("idbins")));
+        bins.push_back(std::make_pair(s14, std::string("idbins")));
+        bins.push_back(std::make_pair(s15, std::string("idbins")));
+        bins.push_back(std::make_pair(s16, std::string("idbins")));
+        bins.push_back(std::make_pair(s17, std::string("idbins")));
+        bins.push_back(std::make_pair(s18, std::string("idbins")));
+        bins.push_back(std::make_pair(s19, std::string("idbins")));
+        bins.push_back(std::make_pair(s20, std::string("idbins")));
+        bins.push_back(std::make_pair(s21, std::string("idbins")));
+        bins.push_back(std::make_pair(s22, std::string("idbins")));
+        bins.push_back(std::make_pair(s23, std::string("idbins")));
+        bins.push_back(std::make_pair(s24, std::string("idbins")));
+        bins.push_back(std::make_pair(s25, std::string("idbins")));
+        bins.push_back(std::make_pair(s26, std::string("idbins")));
     }
     if(type=="isobins")
     {
@@ -484,32 +487,32 @@ bool isdata;
         std::string s24="8vtx";
         std::string s25="9vtx";
         std::string s26="10vtx";
-        fit(s1, "isobins", elec, isdata);
-        fit(s2, "isobins", elec, isdata);
-        fit(s3, "isobins", elec, isdata);
-        fit(s4, "isobins", elec, isdata);
-        fit(s5, "isobins", elec, isdata);
-        fit(s6, "isobins", elec, isdata);
-        fit(s7, "isobins", elec, isdata);
-        fit(s8, "isobins", elec, isdata);
-        fit(s9, "isobins", elec, isdata);
-        fit(s10, "isobins", elec, isdata);
-        fit(s11, "isobins", elec, isdata);
-        fit(s12, "isobins", elec, isdata);
-        fit(s13, "isobins", elec, isdata);
-        fit(s14, "isobins", elec, isdata);
-        fit(s15, "isobins", elec, isdata);
-        fit(s16, "isobins", elec, isdata);
-        fit(s17, "isobins", elec, isdata);
-        fit(s18, "isobins", elec, isdata);
-        fit(s19, "isobins", elec, isdata);
-        fit(s20, "isobins", elec, isdata);
-        fit(s21, "isobins", elec, isdata);
-        fit(s22, "isobins", elec, isdata);
-        fit(s23, "isobins", elec, isdata);
-        fit(s24, "isobins", elec, isdata);
-        fit(s25, "isobins", elec, isdata);
-        fit(s26, "isobins", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("isobins")));
+        bins.push_back(std::make_pair(s2, std::string("isobins")));
+        bins.push_back(std::make_pair(s3, std::string("isobins")));
+        bins.push_back(std::make_pair(s4, std::string("isobins")));
+        bins.push_back(std::make_pair(s5, std::string("isobins")));
+        bins.push_back(std::make_pair(s6, std::string("isobins")));
+        bins.push_back(std::make_pair(s7, std::string("isobins")));
+        bins.push_back(std::make_pair(s8, std::string("isobins")));
+        bins.push_back(std::make_pair(s9, std::string("isobins")));
+        bins.push_back(std::make_pair(s10, std::string("isobins")));
+        bins.push_back(std::make_pair(s11, std::string("isobins")));
+        bins.push_back(std::make_pair(s12, std::string("isobins")));
+        bins.push_back(std::make_pair(s13, std::string("isobins")));
+        bins.push_back(std::make_pair(s14, std::string("isobins")));
+        bins.push_back(std::make_pair(s15, std::string("isobins")));
+        bins.push_back(std::make_pair(s16, std::string("isobins")));
+        bins.push_back(std::make_pair(s17, std::string("isobins")));
+        bins.push_back(std::make_pair(s18, std::string("isobins")));
+        bins.push_back(std::make_pair(s19, std::string("isobins")));
+        bins.push_back(std::make_pair(s20, std::string("isobins")));
+        bins.push_back(std::make_pair(s21, std::string("isobins")));
+        bins.push_back(std::make_pair(s22, std::string("isobins")));
+        bins.push_back(std::make_pair(s23, std::string("isobins")));
+        bins.push_back(std::make_pair(s24, std::string("isobins")));
+        bins.push_back(std::make_pair(s25, std::string("isobins")));
+        bins.push_back(std::make_pair(s26, std::string("isobins")));
     }
     if(type=="idisobins")
     {
@@ -539,33 +542,35 @@ bool isdata;
         std::string s24="8vtx";
         std::string s25="9vtx";
         std::string s26="10vtx";
-        fit(s1, "idisobins", elec, isdata);
-        fit(s2, "idisobins", elec, isdata);
-        fit(s3, "idisobins", elec, isdata);
-        fit(s4, "idisobins", elec, isdata);
-        fit(s5, "idisobins", elec, isdata);
-        fit(s6, "idisobins", elec, isdata);
-        fit(s7, "idisobins", elec, isdata);
-        fit(s8, "idisobins", elec, isdata);
-        fit(s9, "idisobins", elec, isdata);
-        fit(s10, "idisobins", elec, isdata);
-        fit(s11, "idisobins", elec, isdata);
-        fit(s12, "idisobins", elec, isdata);
-        fit(s13, "idisobins", elec, isdata);
-        fit(s14, "idisobins", elec, isdata);
-        fit(s15, "idisobins", elec, isdata);
-        fit(s16, "idisobins", elec, isdata);
-        fit(s17, "idisobins", elec, isdata);
-        fit(s18, "idisobins", elec, isdata);
-        fit(s19, "idisobins", elec, isdata);
-        fit(s20, "idisobins", elec, isdata);
-        fit(s21, "idisobins", elec, isdata);
-        fit(s22, "idisobins", elec, isdata);
-        fit(s23, "idisobins", elec, isdata);
-        fit(s24, "idisobins", elec, isdata);
-        fit(s25, "idisobins", elec, isdata);
-        fit(s26, "idisobins", elec, isdata);
+        bins.push_back(std::make_pair(s1, std::string("idisobins")));
+        bins.push_back(std::make_pair(s2, std::string("idisobins")));
+        bins.push_back(std::make_pair(s3, std::string("idisobins")));
+        bins.push_back(std::make_pair(s4, std::string("idisobins")));
+        bins.push_back(std::make_pair(s5, std::string("idisobins")));
+        bins.push_back(std::make_pair(s6, std::string("idisobins")));
+        bins.push_back(std::make_pair(s7, std::string("idisobins")));
+        bins.push_back(std::make_pair(s8, std::string("idisobins")));
+        bins.push_back(std::make_pair(s9, std::string("idisobins")));
+        bins.push_back(std::make_pair(s10, std::string("idisobins")));
+        bins.push_back(std::make_pair(s11, std::string("idisobins")));
+        bins.push_back(std::make_pair(s12, std::string("idisobins")));
+        bins.push_back(std::make_pair(s13, std::string("idisobins")));
+        bins.push_back(std::make_pair(s14, std::string("idisobins")));
+        bins.push_back(std::make_pair(s15, std::string("idisobins")));
+        bins.push_back(std::make_pair(s16, std::string("idisobins")));
+        bins.push_back(std::make_pair(s17, std::string("idisobins")));
+        bins.push_back(std::make_pair(s18, std::string("idisobins")));
+        bins.push_back(std::make_pair(s19, std::string("idisobins")));
+        bins.push_back(std::make_pair(s20, std::string("idisobins")));
+        bins.push_back(std::make_pair(s21, std::string("idisobins")));
+        bins.push_back(std::make_pair(s22, std::string("idisobins")));
+        bins.push_back(std::make_pair(s23, std::string("idisobins")));
+        bins.push_back(std::make_pair(s24, std::string("idisobins")));
+        bins.push_back(std::make_pair(s25, std::string("idisobins")));
+        bins.push_back(std::make_pair(s26, std::string("idisobins")));
     }
 
+    fitbins(bins, elec, isdata, njobs);
+
     return 0;
 }
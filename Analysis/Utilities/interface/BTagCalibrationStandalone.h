@@ -141,12 +141,15 @@ protected:
  * BTagCalibrationReader
  *
  * Helper class to pull out a specific set of BTagEntry's out of a
- * BTagCalibration. TF1 functions are set up at initialization time.
+ * BTagCalibration. Formulas are compiled at initialization time, with a TF1
+ * only for expressions that the built-in evaluator does not handle, and
+ * entries are indexed by their eta, pt and discriminant bin edges.
  *
  ************************************************************/
 
 #include <memory>
 #include <string>
+#include <vector>
 
 
 
@@ -175,6 +178,16 @@ public:
                           float pt,
                           float discr=0.) const;
 
+  // The nominal value followed by each of the otherSysTypes, in the order
+  // given to the constructor (see sys_types()), with the same out-of-bounds
+  // treatment as eval_auto_bounds
+  std::vector<double> eval_auto_bounds_all(BTagEntry::JetFlavor jf,
+                                           float eta,
+                                           float pt,
+                                           float discr=0.) const;
+
+  const std::vector<std::string>& sys_types() const;
+
   std::pair<float, float> min_max_pt(BTagEntry::JetFlavor jf,
                                      float eta,
                                      float discr=0.) const;
@@ -0,0 +1,80 @@
+#ifndef ICHiggsTauTau_Utilities_CompiledBDT_h
+#define ICHiggsTauTau_Utilities_CompiledBDT_h
+#include <string>
+#include <vector>
+
+namespace ic {
+
+//! CompiledBDT
+/*!
+  Evaluates a TMVA boosted decision tree directly from its weight XML file.
+  All the trees of the forest are flattened into one array of nodes in which
+  the two children of a node are stored next to each other, so walking a
+  tree is a sequence of compare-and-index steps on contiguous memory.
+
+  Cut values and leaf values are kept in the precision TMVA stores them
+  in (float) and the trees are summed in the same order as
+  TMVA::MethodBDT::GetMvaValue, so Evaluate() matches
+  TMVA::Reader::EvaluateMVA exactly for the same float inputs. Forests with
+  input variable transformations or Fisher cuts are not supported: Load()
+  returns false for those, in which case the caller should fall back to
+  TMVA.
+
+  Inputs are given in the order of the variables in the weight file, see
+  variables().
+*/
+class CompiledBDT {
+ public:
+  struct Node {
+    int var;            // input index, or -1 for a leaf
+    float cut;
+    bool cut_type;      // go right if (x >= cut) == cut_type
+    unsigned child;     // index of the left child, the right one follows
+    double value;       // leaf value
+  };
+
+ private:
+  enum Output { kWeightedAverage, kGrad };
+
+  std::string name_;
+  std::vector<std::string> variables_;
+  std::vector<std::string> labels_;
+  std::vector<Node> nodes_;
+  std::vector<unsigned> roots_;
+  std::vector<double> tree_weights_;
+  double norm_;
+  Output output_;
+
+  inline double TreeResponse(unsigned itree, float const* x) const {
+    Node const* node = &(nodes_[roots_[itree]]);
+    while (node->var >= 0) {
+      node = &(nodes_[node->child + ((x[node->var] >= node->cut) == node->cut_type)]);
+    }
+    return node->value;
+  }
+  double Finalise(double sum) const;
+
+ public:
+  CompiledBDT();
+
+  // Parses the weight file, returns false (and prints the reason) if it
+  // cannot be evaluated by this class
+  bool Load(std::string const& filename);
+
+  inline bool loaded() const { return roots_.size() > 0; }
+  inline std::string const& name() const { return name_; }
+  inline unsigned n_trees() const { return roots_.size(); }
+  inline unsigned n_nodes() const { return nodes_.size(); }
+  // Variable expressions and labels, in input order
+  inline std::vector<std::string> const& variables() const { return variables_; }
+  inline std::vector<std::string> const& labels() const { return labels_; }
+
+  double Evaluate(float const* x) const;
+  // Evaluates n events whose inputs start every stride floats in x,
+  // writing one value per event to out. The loop runs tree by tree so each
+  // tree stays in cache while it is applied to all the events.
+  void EvaluateBatch(float const* x, unsigned n, unsigned stride, double * out) const;
+};
+}
+
+#endif
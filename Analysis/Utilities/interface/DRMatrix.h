@@ -0,0 +1,105 @@
+#ifndef ICHiggsTauTau_Utilities_DRMatrix_h
+#define ICHiggsTauTau_Utilities_DRMatrix_h
+#include <vector>
+#include <utility>
+#include <cmath>
+
+namespace ic {
+
+//! DRMatrix
+/*!
+  Computes \f$\Delta R^{2}\f$ between every element of a first and a second
+  collection in one pass and answers the usual overlap-removal and matching
+  questions from the result.
+
+  The eta and phi values of both collections are copied into contiguous
+  arrays once, and each row of the matrix is filled by a branch-free loop
+  over the second collection that the compiler can vectorise. This replaces
+  the pairwise ROOT::Math::VectorUtil::DeltaR calls through Candidate
+  pointers in MinDRToCollection and MatchByDR, which recompute the same
+  differences for every predicate call and cannot be vectorised.
+
+  The \f$\Delta\phi\f$ convention is the same as VectorUtil::DeltaPhi.
+  Comparisons are made on \f$\Delta R^{2}\f$ against the squared cut.
+
+  The collections can be anything with eta() and phi(), accessed through a
+  pointer: Candidate*, PFJet*, GenParticle*, ...
+*/
+class DRMatrix {
+ private:
+  std::vector<double> eta1_;
+  std::vector<double> phi1_;
+  std::vector<double> eta2_;
+  std::vector<double> phi2_;
+  std::vector<double> dr2_;
+  unsigned n1_;
+  unsigned n2_;
+
+  void Compute();
+
+ public:
+  DRMatrix();
+
+  template <class T, class U>
+  DRMatrix(std::vector<T> const& c1, std::vector<U> const& c2) {
+    Fill(c1, c2);
+  }
+
+  template <class T, class U>
+  void Fill(std::vector<T> const& c1, std::vector<U> const& c2) {
+    eta1_.resize(c1.size());
+    phi1_.resize(c1.size());
+    for (unsigned i = 0; i < c1.size(); ++i) {
+      eta1_[i] = c1[i]->eta();
+      phi1_[i] = c1[i]->phi();
+    }
+    eta2_.clear();
+    phi2_.clear();
+    Append(c2);
+  }
+
+  // Adds more elements to the second collection and recomputes the matrix,
+  // e.g. to overlap-remove against the legs of several composite candidates
+  template <class U>
+  void Append(std::vector<U> const& c2) {
+    for (unsigned j = 0; j < c2.size(); ++j) {
+      eta2_.push_back(c2[j]->eta());
+      phi2_.push_back(c2[j]->phi());
+    }
+    Compute();
+  }
+
+  inline unsigned n1() const { return n1_; }
+  inline unsigned n2() const { return n2_; }
+  inline double DR2(unsigned i, unsigned j) const { return dr2_[i * n2_ + j]; }
+  inline double DR(unsigned i, unsigned j) const { return std::sqrt(DR2(i, j)); }
+
+  // Veto: keep[i] is true if no element of the second collection is
+  // within min_dr of element i of the first (as MinDRToCollection)
+  void NotWithin(double min_dr, std::vector<bool> & keep) const;
+
+  // For each element of the first collection, the index of the closest
+  // element of the second with DR < max_dr, or -1 if there is none
+  std::vector<int> BestMatch(double max_dr) const;
+
+  // All pairs of indices with DR < max_dr, in order of increasing DR. With
+  // unique_first (unique_second) each element of the first (second)
+  // collection appears at most once, taking the closest pairs first
+  // (as MatchByDR)
+  std::vector<std::pair<unsigned, unsigned> > Match(double max_dr,
+                                                    bool unique_first,
+                                                    bool unique_second) const;
+};
+
+// Removes the elements of vec for which keep is false, keeping the order
+template <class T>
+void KeepSelected(std::vector<T> & vec, std::vector<bool> const& keep) {
+  unsigned n = 0;
+  for (unsigned i = 0; i < vec.size(); ++i) {
+    if (keep[i]) vec[n++] = vec[i];
+  }
+  vec.resize(n);
+}
+}
+
+#endif
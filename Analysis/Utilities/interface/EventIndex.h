@@ -0,0 +1,70 @@
+#ifndef ICHiggsTauTau_Utilities_EventIndex_h
+#define ICHiggsTauTau_Utilities_EventIndex_h
+
+#include <vector>
+#include <string>
+#include <tuple>
+#include <cstdint>
+
+namespace ic {
+
+/**
+ * The (file, entry) of every (run, lumi, event) in a list of input files,
+ * for picking out a few events without reading the rest
+ *
+ * Only the run_, lumi_block_ and event_ members of the eventInfo branch are
+ * read to build the index. It can be saved to a text file and loaded again
+ * by later jobs on the same files, so that each file is only scanned once.
+ * Lookups are a binary search over the sorted events. See
+ * AnalysisBase::SetPickedEntries.
+ */
+class EventIndex {
+ public:
+  typedef std::tuple<unsigned, unsigned, uint64_t> EventID;
+
+ private:
+  struct Entry {
+    EventID id;
+    unsigned file;
+    int64_t entry;
+    bool operator<(Entry const& other) const { return id < other.id; }
+  };
+  std::vector<std::string> files_;
+  std::vector<Entry> entries_;
+
+ public:
+  /**
+   * Scans the tree in each file, throwing if a file, the tree or the
+   * branch cannot be found
+   */
+  void Build(std::vector<std::string> const& files,
+             std::string const& tree_path,
+             std::string const& branch = "eventInfo");
+
+  /**
+   * Loads an index written by Save, returning false if there is no such
+   * file or it was built from a different list of files
+   */
+  bool Load(std::string const& filename,
+            std::vector<std::string> const& files);
+
+  void Save(std::string const& filename) const;
+
+  /**
+   * The entries of each input file that hold one of the events, sorted.
+   * Events that are not in the index are listed on stdout.
+   */
+  std::vector<std::vector<int64_t>> PickedEntries(
+      std::vector<EventID> const& events) const;
+
+  /**
+   * Reads events one per line in the form run:lumi:event, as used by
+   * edmPickEvents. Empty lines and lines starting with # are skipped.
+   */
+  static std::vector<EventID> ParseEventList(std::string const& filename);
+
+  inline unsigned n_entries() const { return entries_.size(); }
+};
+}
+
+#endif
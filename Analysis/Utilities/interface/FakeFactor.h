@@ -65,18 +65,31 @@ class FakeFactor : public TObject
             std::vector<double> vxs(xs, xs+size);
             return value(vxs, sys);
         }
-        double value(const std::vector<double>& xs, const std::string& sys="")
+        double value(const std::vector<double>& xs, const std::string& sys="");
+
+        // Retrieving the nominal and all the registered systematics at once.
+        // values[i] is the fake factor for systematics()[i]. Nodes shared by
+        // several systematic trees are only evaluated once.
+        void values(const std::vector<double>& xs, std::vector<double>& values);
+        std::vector<double> values(const std::vector<double>& xs)
+        {
+            std::vector<double> vals;
+            values(xs, vals);
+            return vals;
+        }
+        // Picking one systematic out of the result of values()
+        double systematicValue(const std::vector<double>& values, const std::string& sys)
         {
-            auto sys_nodes = m_nodes.find(sys);
-            if(sys_nodes==m_nodes.end())
+            int index = systematicIndex(sys);
+            if(index<0)
             {
                 std::cout<<"[FakeFactor] ERROR: Non registered systematic "<<sys<<"\n";
                 return 1.;
             }
-            auto sys_indices = m_indices.find(sys);
-            auto sys_inputs = m_nodeInputs.find(sys);
-            return value(xs, sys_nodes->second, sys_indices->second, sys_inputs->second, sys_nodes->second.size()-1); // evaluate the root
+            return values.at(index);
         }
+        // Position of sys in systematics(), or -1 if not registered
+        int systematicIndex(const std::string& sys);
 
         // Adding an input name
         void addInput(const std::string& input)
@@ -101,6 +114,7 @@ class FakeFactor : public TObject
 
         void registerSystematic(const std::string& name)
         {
+            m_compiled.reset();
             // Initialize empty tree
             m_nodes.insert( std::make_pair(name, std::vector<size_t>()) );
             m_indices.insert( std::make_pair(name, std::vector<std::vector<size_t>>()) );
@@ -109,11 +123,9 @@ class FakeFactor : public TObject
         }
 
     private:
-        double value(const std::vector<double>&,
-                std::vector<size_t>&,
-                std::vector<std::vector<size_t>>&,
-                std::vector<std::vector<size_t>>&,
-                size_t);
+        // Flattened form of the trees, built on first evaluation
+        struct Compiled;
+        Compiled& compiled();
 
         std::vector<std::string> m_inputs;
 
@@ -123,6 +135,8 @@ class FakeFactor : public TObject
         std::map<std::string, std::vector<std::vector<size_t>>> m_indices;
         std::map<std::string, std::vector<std::vector<size_t>>> m_nodeInputs;
 
+        std::shared_ptr<Compiled> m_compiled; //!
+
 
     private:
         ClassDef(FakeFactor,1)
@@ -10,6 +10,7 @@
 #include "UserCode/ICHiggsTauTau/interface/Objects.hh"
 #include "UserCode/ICHiggsTauTau/interface/CompositeCandidate.hh"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/DRMatrix.h"
 
 //#include "TRandom2.h"
 
@@ -51,54 +52,20 @@ namespace ic {
 
 
 
+  // Pairs (c1[i], c2[j]) with DR < maxDR in order of increasing DR, see
+  // DRMatrix::Match for the meaning of uniqueFirst and uniqueSecond
   template<class T, class U>
     std::vector< std::pair<T,U> > MatchByDR(std::vector<T> const& c1,
                                               std::vector<U> const& c2,
                                               double const& maxDR,
                                               bool const& uniqueFirst,
                                               bool const& uniqueSecond) {
-      std::vector< std::pair<T,U> > pairVec = MakePairs(c1,c2);
-      erase_if(pairVec, !boost::bind(DRLessThan<T,U>, _1, maxDR));
-      std::sort(pairVec.begin(), pairVec.end(), DRCompare<T,U>);
-      if (uniqueFirst && uniqueSecond) {
-        std::vector< std::pair<T,U> > uPairVec;
-        std::vector<T> fVec;
-        std::vector<U> sVec;
-        std::pair<T,U> aPair;
-        BOOST_FOREACH(aPair, pairVec) {
-          bool inFVec = std::count(fVec.begin(),fVec.end(),aPair.first);
-          bool inSVec = std::count(sVec.begin(),sVec.end(),aPair.second);
-          if (!inFVec && !inSVec) {
-            uPairVec.push_back(aPair);
-            fVec.push_back(aPair.first);
-            sVec.push_back(aPair.second);
-          }
-        }
-        return uPairVec;
-      } else if (uniqueFirst) {
-        std::vector< std::pair<T,U> > uPairVec;
-        std::vector<T> fVec;
-        std::pair<T,U> aPair;
-        BOOST_FOREACH(aPair, pairVec) {
-          bool inFVec = std::count(fVec.begin(),fVec.end(),aPair.first);
-          if (!inFVec) {
-            uPairVec.push_back(aPair);
-            fVec.push_back(aPair.first);
-          }
-        }
-        return uPairVec;
-      } else if (uniqueSecond) {
-        std::vector< std::pair<T,U> > uPairVec;
-        std::vector<U> sVec;
-        std::pair<T,U> aPair;
-        BOOST_FOREACH(aPair, pairVec) {
-          bool inSVec = std::count(sVec.begin(),sVec.end(),aPair.second);
-          if (!inSVec) {
-            uPairVec.push_back(aPair);
-            sVec.push_back(aPair.second);
-          }
-        }
-        return uPairVec;
+      DRMatrix dr_matrix(c1, c2);
+      std::vector<std::pair<unsigned, unsigned> > matches =
+          dr_matrix.Match(maxDR, uniqueFirst, uniqueSecond);
+      std::vector< std::pair<T,U> > pairVec(matches.size());
+      for (unsigned i = 0; i < matches.size(); ++i) {
+        pairVec[i] = std::pair<T,U>(c1[matches[i].first], c2[matches[i].second]);
       }
       return pairVec;
     }
@@ -0,0 +1,51 @@
+#ifndef ICHiggsTauTau_Utilities_FnParallel_h
+#define ICHiggsTauTau_Utilities_FnParallel_h
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include "TROOT.h"
+
+namespace ic {
+
+  // Calls fn(i) for every i in [0, n_tasks) using up to n_threads threads.
+  // Tasks are handed out in increasing order of i, but may complete in any
+  // order, so fn should only write to an output slot owned by task i and the
+  // caller should combine the slots afterwards in index order. With
+  // n_threads <= 1 the tasks simply run in sequence on the calling thread.
+  // If fn throws, no further tasks are started and, once every thread has
+  // finished, the exception from the lowest failing index is rethrown.
+  template <class F>
+  void ParallelFor(unsigned n_tasks, unsigned n_threads, F fn) {
+    n_threads = std::min(n_threads, n_tasks);
+    if (n_threads <= 1) {
+      for (unsigned i = 0; i < n_tasks; ++i) fn(i);
+      return;
+    }
+    ROOT::EnableThreadSafety();
+    std::atomic<unsigned> next(0);
+    std::vector<std::exception_ptr> errors(n_threads);
+    std::vector<unsigned> failed(n_threads, n_tasks);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < n_threads; ++t) {
+      workers.emplace_back([&, t]() {
+        for (unsigned i = next++; i < n_tasks; i = next++) {
+          try {
+            fn(i);
+          } catch (...) {
+            errors[t] = std::current_exception();
+            failed[t] = i;
+            next = n_tasks;
+            return;
+          }
+        }
+      });
+    }
+    for (auto & worker : workers) worker.join();
+    unsigned first = std::min_element(failed.begin(), failed.end()) - failed.begin();
+    if (errors[first]) std::rethrow_exception(errors[first]);
+  }
+}
+
+#endif
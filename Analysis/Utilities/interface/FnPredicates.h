@@ -413,6 +413,8 @@ namespace ic {
 
   std::vector<GenParticle *> ExtractDaughtersRecursive(GenParticle * part, std::vector<GenParticle *> const& input);
 
+  // For use in an event loop prefer GenGraph::Get(event).TauJets(...), which
+  // is built once per event and shared between modules
   std::vector<GenJet> BuildTauJets(std::vector<GenParticle *> const& parts, bool include_leptonic, bool use_prompt);
 
   ROOT::Math::PtEtaPhiEVector reconstructWboson(Candidate const*  lepton, Candidate const* met);
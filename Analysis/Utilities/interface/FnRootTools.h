@@ -7,6 +7,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TH1F.h"
+#include "Utilities/interface/json.h"
 
 namespace ic {
 
@@ -87,6 +88,36 @@ namespace ic {
 
   void VerticalMorph(TH1F *central, TH1F const*up, TH1F const*down, double shift);
 
+  // Horizontal morphing of the templates low and high, at the parameter
+  // values par_low and par_high, to each of pars with ic::HistMorph. The
+  // result for pars[i] is normalised to norms[i], or to the linear
+  // interpolation of the integrals of low and high if norms is empty. Both
+  // templates must have the same binning.
+  std::vector<TH1F> HorizontalMorph(TH1F const& low, TH1F const& high,
+                                    double par_low, double par_high,
+                                    std::vector<double> const& pars,
+                                    std::vector<double> const& norms);
+
+  // Writes the objects in dir and its subdirectories so that a file that is
+  // never closed can be recovered as it is now. Trees are saved with
+  // AutoSave and their own periodic autosaves are switched off, so that a
+  // recovered tree has exactly the entries it had at the last call. Other
+  // objects are written as new cycles and the old cycles are only purged
+  // once the key list pointing to the new ones is on disk, so a crash at
+  // any point leaves a readable version. If stamp is given it is written
+  // to dir in the same SaveSelf, e.g. to record which checkpoint the saved
+  // contents belong to.
+  void AutoSaveDirectory(TDirectory *dir, TObject const* stamp = nullptr);
+
+  // Merges the histograms and trees of the input files into output
+  bool MergeFiles(std::vector<std::string> const& inputs, std::string const& output);
+
+  // Applies the output settings in cfg to the trees in dir and its
+  // subdirectories, before anything is filled. cfg maps a tree name, or "*"
+  // for the other trees, to any of "compression_algorithm" (ZLIB, LZMA or
+  // LZ4), "compression_level", "basket_size" and "auto_flush".
+  void ConfigureOutputTrees(TDirectory *dir, Json::Value const& cfg);
+
 
 } // namepsace
 #endif
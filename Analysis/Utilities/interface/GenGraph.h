@@ -0,0 +1,111 @@
+#ifndef ICHiggsTauTau_Utilities_GenGraph_h
+#define ICHiggsTauTau_Utilities_GenGraph_h
+#include <vector>
+#include <string>
+#include <utility>
+#include "UserCode/ICHiggsTauTau/interface/GenParticle.hh"
+#include "UserCode/ICHiggsTauTau/interface/GenJet.hh"
+
+namespace ic {
+
+class TreeEvent;
+
+//! GenGraph
+/*!
+  The decay graph of a GenParticle collection, built once per event and
+  shared by every module that needs to navigate it.
+
+  GenParticle::mothers() and GenParticle::daughters() hold index() values,
+  so ExtractDaughters and friends have to scan the whole collection to
+  resolve them, and each module doing gen-level work repeats this (often on
+  a filtered copy of the collection). Here the links are resolved to
+  positions in the collection once and stored as compact adjacency arrays,
+  together with an index of the particles by |pdgid|. Recursive traversals
+  (stable daughters, tau jets) are cached on first use.
+
+  The usual way to get one is through Get(), which builds the graph for a
+  collection the first time it is requested in an event and stores it in
+  the event as "genGraph_<label>":
+
+      GenGraph const& graph = GenGraph::Get(event, "genParticles");
+      std::vector<GenJet> const& taus = graph.TauJets(false, true);
+
+  Particles are returned in the order of the input collection, as
+  ExtractDaughters does. The graph holds pointers into the collection and
+  must not outlive it.
+*/
+class GenGraph {
+ private:
+  std::vector<GenParticle *> parts_;
+  // GenParticle::index() -> position in parts_, or -1
+  std::vector<int> pos_of_index_;
+  std::vector<unsigned> abs_pdgid_;
+  // Daughters of particle i are d_pos_[d_begin_[i]] .. d_pos_[d_begin_[i+1]-1]
+  std::vector<unsigned> d_begin_;
+  std::vector<unsigned> d_pos_;
+  std::vector<unsigned> m_begin_;
+  std::vector<unsigned> m_pos_;
+  // (|pdgid|, position), sorted
+  std::vector<std::pair<unsigned, unsigned> > by_pdgid_;
+
+  mutable std::vector<std::vector<GenParticle *> > stable_;
+  mutable std::vector<bool> stable_done_;
+  mutable std::vector<std::vector<GenJet> > tau_jets_;
+  mutable std::vector<bool> tau_jets_done_;
+
+  void Link(std::vector<int> const& indices, std::vector<unsigned> & begin,
+            std::vector<unsigned> & pos);
+  std::vector<GenParticle *> ToParticles(unsigned const* first,
+                                         unsigned const* last) const;
+  unsigned PositionOrThrow(GenParticle const* part) const;
+
+ public:
+  GenGraph();
+  explicit GenGraph(std::vector<GenParticle *> const& parts);
+
+  void Build(std::vector<GenParticle *> const& parts);
+
+  // The graph of the collection label in this event, built on first use
+  static GenGraph const& Get(TreeEvent * event,
+                             std::string const& label = "genParticles");
+
+  inline unsigned size() const { return parts_.size(); }
+  inline std::vector<GenParticle *> const& particles() const { return parts_; }
+
+  // Position of part in the collection, or -1 if it is not part of it
+  int Position(GenParticle const* part) const;
+
+  std::vector<GenParticle *> Daughters(GenParticle const* part) const;
+  std::vector<GenParticle *> Mothers(GenParticle const* part) const;
+  inline unsigned NDaughters(GenParticle const* part) const {
+    unsigned i = PositionOrThrow(part);
+    return d_begin_[i + 1] - d_begin_[i];
+  }
+
+  // All descendants, ordered by position (as ExtractDaughtersRecursive)
+  std::vector<GenParticle *> DaughtersRecursive(GenParticle const* part) const;
+
+  // The status 1 descendants, not looking through status 1 particles (as
+  // ExtractStableDaughters), ordered by position. Cached per particle.
+  std::vector<GenParticle *> const& StableDaughters(GenParticle const* part) const;
+
+  // StableDaughters of a tau without the neutrinos
+  std::vector<GenParticle *> VisibleTauDecayProducts(GenParticle const* tau) const;
+
+  // All particles with |pdgid| equal to one of abs_pdgids, in input order
+  std::vector<GenParticle *> WithAbsPdgId(std::vector<unsigned> const& abs_pdgids) const;
+  inline std::vector<GenParticle *> WithAbsPdgId(unsigned abs_pdgid) const {
+    return WithAbsPdgId(std::vector<unsigned>(1, abs_pdgid));
+  }
+
+  // Follows the chain of copies of part (a single mother or daughter with
+  // the same pdgid) up to the first or down to the last one
+  GenParticle * FirstCopy(GenParticle const* part) const;
+  GenParticle * LastCopy(GenParticle const* part) const;
+
+  // The visible tau jets of BuildTauJets, cached for each set of options
+  std::vector<GenJet> const& TauJets(bool include_leptonic, bool use_prompt) const;
+};
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef ICHiggsTauTau_Utilities_HistMorph_h
+#define ICHiggsTauTau_Utilities_HistMorph_h
+#include <vector>
+
+namespace ic {
+
+//! HistMorph
+/*!
+  Horizontal morphing of binned templates as a function of a parameter,
+  e.g. the signal mass, with the algorithm of th1fmorph (A. L. Read,
+  "Linear Interpolation of Histograms", NIM A 425 (1999) 357-360).
+
+  th1fmorph works on one pair of TH1s per call, building the cumulative
+  distributions of both inputs and merging them again for every target.
+  Here the templates are given once as plain arrays of bin contents on a
+  common binning, and their cumulative distributions are built as they are
+  added. The quantiles of each pair of neighbouring templates do not depend
+  on the target, so they are merged once and cached; morphing to a target
+  is then a weighted sum of the cached quantiles and a projection onto the
+  bins.
+
+  Each template can hold several variants of the same distribution, e.g.
+  the nominal shape and its systematic shifts, morphed together:
+
+      ic::HistMorph morph(edges, 3);
+      morph.AddTemplate(120., contents_120);  // 3 * (edges.size()-1) values
+      morph.AddTemplate(130., contents_130);
+      std::vector<double> result;
+      morph.Morph({122., 124., 126., 128.}, {}, result);
+
+  For the same two templates and binning the result is that of th1fmorph.
+  Underflow and overflow are not part of the contents.
+*/
+class HistMorph {
+ private:
+  struct Quantiles {
+    // The positions in the lower and upper template of each cumulative
+    // probability y at which either has an edge
+    std::vector<double> x1;
+    std::vector<double> x2;
+    std::vector<double> y;
+    bool empty;
+  };
+
+  std::vector<double> edges_;
+  unsigned n_bins_;
+  unsigned n_variants_;
+  // Sorted by parameter value
+  std::vector<double> pars_;
+  // n_variants_ blocks of n_bins_ + 1 cumulative probabilities per template
+  std::vector<std::vector<double> > cdfs_;
+  std::vector<std::vector<double> > totals_;
+  // (pair, variant) -> quantiles of templates pair and pair + 1
+  std::vector<Quantiles> pairs_;
+  bool pairs_done_;
+
+  void MergePair(unsigned lo, unsigned variant, Quantiles & q) const;
+  void Project(Quantiles const& q, double wt1, double wt2, double norm,
+               std::vector<double> & xdis, std::vector<double> & sigdis,
+               double * out) const;
+
+ public:
+  HistMorph(std::vector<double> const& edges, unsigned n_variants = 1);
+
+  /**
+   * Adds the bin contents of every variant at the parameter value par, in
+   * variant order, n_variants * n_bins in total
+   */
+  void AddTemplate(double par, std::vector<double> const& contents);
+
+  /**
+   * Morphs every variant to each of the parameter values pars. The result
+   * for variant v at pars[t] is in result[(t * n_variants + v) * n_bins],
+   * normalised to norms[t * n_variants + v]. With no norms the integrals of
+   * the two templates either side are interpolated linearly, as the
+   * callers of th1fmorph usually do. Outside the range of the templates
+   * the two nearest are extrapolated, with a warning.
+   */
+  void Morph(std::vector<double> const& pars, std::vector<double> const& norms,
+             std::vector<double> & result);
+
+  /// The sum of the contents of a variant of the i-th template, in order
+  /// of the parameter value
+  inline double Integral(unsigned i, unsigned variant = 0) const {
+    return totals_[i][variant];
+  }
+  inline std::vector<double> const& edges() const { return edges_; }
+  inline unsigned n_bins() const { return n_bins_; }
+  inline unsigned n_variants() const { return n_variants_; }
+  inline unsigned n_templates() const { return pars_.size(); }
+};
+}
+
+#endif
@@ -74,5 +74,45 @@ Json::Value MergedJson(int argc, char* argv[]);
  * @param vec Vector of input strings
  */
 Json::Value MergedJson(std::vector<std::string> const& vec);
+
+/**
+ * Checks a Json::Value against a schema
+ *
+ * The schema has the same structure as the values it describes. Each key
+ * maps either to a nested schema object or to the name of the type the value
+ * must be convertible to: "bool", "int", "uint", "double", "string",
+ * "array", "object" or "any". In a schema object the key "*" gives the schema
+ * for any key not listed explicitly, and "_ignored" is a list of keys that
+ * are accepted but known to be unused. A null value always passes.
+ *
+ * @param val The Json::Value to check
+ * @param schema The schema
+ * @param path Prefix used for the location of each problem, e.g. the name
+ * of the input
+ * @param errors Unknown keys and values of the wrong type are appended here
+ * @param warnings Keys listed in "_ignored" are appended here
+ */
+void ValidateJson(Json::Value const& val, Json::Value const& schema,
+                  std::string const& path, std::vector<std::string>& errors,
+                  std::vector<std::string>& warnings);
+
+/**
+ * Writes a Json::Value to a compact binary file
+ *
+ * Every object key and string is stored once in a table and referred to by
+ * index, so large configurations with many repeated keys are small and can
+ * be read back without any text parsing.
+ *
+ * @param val The Json::Value to write
+ * @param file The full path to the output file
+ */
+void WriteJsonToBinaryFile(Json::Value const& val, std::string const& file);
+
+/**
+ * Extracts a Json::Value from a file written by WriteJsonToBinaryFile
+ *
+ * @param file The full path to the input file
+ */
+Json::Value ExtractJsonFromBinaryFile(std::string const& file);
 }
 #endif
@@ -0,0 +1,67 @@
+#ifndef ICHiggsTauTau_Utilities_LumiRanges_h
+#define ICHiggsTauTau_Utilities_LumiRanges_h
+
+#include <vector>
+#include <utility>
+#include "Utilities/interface/json.h"
+
+namespace ic {
+
+/**
+ * A set of good lumisections stored as sorted, merged [first, last] lumi
+ * ranges for each run
+ *
+ * This is the form the ranges take in the standard CMS luminosity json,
+ * so a whole certification file needs one pair of integers per range
+ * rather than one set node per lumisection. Lookups are a binary search
+ * over the runs and then over the ranges of the run. The result of the
+ * last lookup is cached, so consecutive events from the same lumisection
+ * cost a single comparison.
+ */
+class LumiRanges {
+ private:
+  typedef std::pair<unsigned, unsigned> Range;
+  // (run, range) as added, merged into the tables below by Compile()
+  std::vector<std::pair<unsigned, Range>> added_;
+  std::vector<unsigned> runs_;
+  // The ranges of runs_[i] are ranges_[begin_[i]] .. ranges_[begin_[i+1]-1]
+  std::vector<unsigned> begin_;
+  std::vector<Range> ranges_;
+
+  mutable unsigned last_run_;
+  mutable unsigned last_lumi_;
+  mutable bool last_result_;
+  mutable bool last_valid_;
+
+  void Compile();
+
+ public:
+  LumiRanges();
+
+  /**
+   * Adds the lumisections [first, last] of run
+   */
+  void Add(unsigned run, unsigned first, unsigned last);
+
+  /**
+   * Adds all the ranges of a CMS luminosity json, throwing if a range is
+   * not in the form [X,Y] with X <= Y
+   */
+  void AddJson(Json::Value const& js);
+
+  /**
+   * True if the lumisection is in one of the ranges
+   */
+  bool Contains(unsigned run, unsigned lumi) const;
+
+  /**
+   * True if any lumisection of the run is in one of the ranges
+   */
+  bool ContainsRun(unsigned run) const;
+
+  inline unsigned n_runs() const { return runs_.size(); }
+  inline unsigned n_ranges() const { return ranges_.size(); }
+};
+}
+
+#endif
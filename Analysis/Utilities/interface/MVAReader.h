@@ -0,0 +1,76 @@
+#ifndef ICHiggsTauTau_Utilities_MVAReader_h
+#define ICHiggsTauTau_Utilities_MVAReader_h
+#include <string>
+#include <vector>
+#include <map>
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/CompiledBDT.h"
+
+namespace TMVA {
+  class Reader;
+}
+
+namespace ic {
+
+//! MVAReader
+/*!
+  Drop-in replacement for the parts of TMVA::Reader used by the analysis
+  modules. Methods whose weight file can be handled by CompiledBDT are
+  evaluated natively, anything else is passed on to a TMVA::Reader that is
+  only created when it is needed.
+
+  Variables and spectators are declared exactly as for TMVA::Reader. The
+  variable expressions must match those in the weight file, in the same
+  order, for a method to be compiled.
+
+  With set_validate(n) the first n evaluations of each compiled method are
+  repeated with TMVA and the largest difference is printed.
+*/
+class MVAReader {
+ private:
+  struct Method {
+    std::string file;
+    CompiledBDT bdt;
+    bool compiled;
+    unsigned n_validated;
+    double max_diff;
+  };
+
+  std::string options_;
+  std::vector<std::string> var_names_;
+  std::vector<float*> var_ptrs_;
+  std::vector<std::string> spec_names_;
+  std::vector<float*> spec_ptrs_;
+  std::map<std::string, Method> methods_;
+  std::vector<float> inputs_;
+  TMVA::Reader *tmva_;
+  unsigned validate_;
+
+  TMVA::Reader * TMVAReader();
+  Method * FindMethod(std::string const& method);
+  void Validate(std::string const& method, Method & m, std::vector<float> const& x, double value);
+
+ public:
+  explicit MVAReader(std::string const& options = "");
+  ~MVAReader();
+
+  void AddVariable(std::string const& expression, float * var);
+  void AddSpectator(std::string const& expression, float * var);
+
+  // Returns true if the method will be evaluated natively
+  bool BookMVA(std::string const& method, std::string const& weight_file);
+
+  // Evaluates using the current values of the bound variables
+  double EvaluateMVA(std::string const& method);
+  // Evaluates n events whose inputs (in variable order) start every stride
+  // floats in x, writing one value per event to out
+  void EvaluateBatch(std::string const& method, float const* x, unsigned n, unsigned stride, double * out);
+
+  // The compiled forest for a method, or nullptr if it uses TMVA
+  CompiledBDT const* GetCompiled(std::string const& method) const;
+
+  inline void set_validate(unsigned n) { validate_ = n; }
+  inline unsigned validate() const { return validate_; }
+};
+}
+
+#endif
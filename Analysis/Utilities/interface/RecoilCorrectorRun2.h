@@ -5,6 +5,7 @@
 #include <TRandom.h>
 #include <TMath.h>
 #include <assert.h>
+#include <vector>
 
 class RecoilCorrectorRun2 {
   
@@ -32,9 +33,28 @@ class RecoilCorrectorRun2 {
 			       float & MetCorrPx,
 			       float & MetCorrPy);
 
+  // Correct() uses the tabulated CDFs by default, the TF1 integrals and
+  // quantiles can be switched back on for comparison
+  void SetUseTables(bool useTables) { _useTables = useTables; }
+
+  // Compares the tabulated and TF1 quantile mapping for nPoints values of
+  // U1 and U2 in every (Z pt, njets) bin and prints the largest and mean
+  // absolute difference
+  void PrintTableAccuracy(int nPoints = 200);
+
   
  private:
 
+  // Cumulative integral of a response function on a uniform grid. The
+  // function itself is kept at the same points so that the CDF can be
+  // interpolated with cubic Hermite polynomials.
+  struct CDFTable {
+    double xmin;
+    double step;
+    std::vector<double> cdf;
+    std::vector<double> pdf;
+  };
+
   int binNumber(float x, const std::vector<float> bins) const
   {
     for (size_t iB=0; iB<bins.size(); ++iB)
@@ -102,6 +122,16 @@ class RecoilCorrectorRun2 {
 
   float CorrectionsBySampling(float x, TF1 * funcMC, TF1 * funcData);
 
+  void BuildTable(TF1 * func, float xmin, float xmax, CDFTable & table);
+
+  double TableCDF(CDFTable const& table, double x) const;
+
+  double TableQuantile(CDFTable const& table, double prob) const;
+
+  float QuantileMap(float x, int ZptBin, int njets, bool paral);
+
+  float QuantileMapTF1(float x, int ZptBin, int njets, bool paral);
+
   float rescale(float x,
 		float meanData, 
 		float meanMC,
@@ -120,11 +150,19 @@ class RecoilCorrectorRun2 {
   int _nZPtBins;
   int _nJetsBins;
 
+  bool _useTables;
+  static const int _nTablePoints = 2048;
+
   TF1 * _metZParalData[5][3];
   TF1 * _metZPerpData[5][3];
   TF1 * _metZParalMC[5][3];
   TF1 * _metZPerpMC[5][3];
 
+  CDFTable _cdfZParalData[5][3];
+  CDFTable _cdfZPerpData[5][3];
+  CDFTable _cdfZParalMC[5][3];
+  CDFTable _cdfZPerpMC[5][3];
+
   TH1F * _metZParalDataHist[5][3];
   TH1F * _metZPerpDataHist[5][3];
   TH1F * _metZParalMCHist[5][3];
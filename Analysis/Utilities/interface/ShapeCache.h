@@ -0,0 +1,77 @@
+#ifndef ICHiggsTauTau_Utilities_ShapeCache_h
+#define ICHiggsTauTau_Utilities_ShapeCache_h
+#include <string>
+#include <map>
+#include <set>
+#include "TH1F.h"
+
+namespace ic {
+
+//! ShapeCache
+/*!
+  A persistent, on-disk cache of histograms filled from flat TTrees. Each
+  entry is addressed by a key built from a stamp of the input file (path,
+  size and modification time) and the exact variable/binning and selection
+  strings passed to TTree::Draw, so an entry can never be returned for a
+  query it was not made for. Changing an input file changes its stamp and
+  the old entries are simply no longer found.
+
+  The entries for each sample are kept in a single ROOT file
+  <dir>/<sample>.root, in which the histograms are named by a hash of the
+  key, h<hash>, and keep their own title. The full key is stored next to
+  each histogram as a TNamed h<hash>_key and compared on every lookup, so
+  a hash collision is a miss rather than a wrong shape. A sample file is
+  read the first time the sample is queried, and new entries are written
+  back in Flush() (also called by the destructor). Invalidate(sample)
+  removes all the entries of a sample.
+
+  The cache is not thread-safe: queries and insertions should be made from
+  a single thread.
+*/
+class ShapeCache {
+ private:
+  struct Entry {
+    std::string key;
+    TH1F hist;
+  };
+  typedef std::map<std::string, Entry> Entries;
+
+  std::string dir_;
+  std::map<std::string, Entries> entries_;
+  std::map<std::string, std::set<std::string>> pending_;
+  unsigned hits_;
+  unsigned misses_;
+
+  std::string SampleFile(std::string const& sample) const;
+  Entries & LoadSample(std::string const& sample);
+
+ public:
+  explicit ShapeCache(std::string const& dir);
+  ~ShapeCache();
+
+  // Returns "path:size:mtime" for a local file, or an empty string if the
+  // file cannot be inspected (e.g. remote paths), in which case queries on
+  // it should not be cached
+  static std::string FileStamp(std::string const& filename);
+  static std::string MakeKey(std::string const& stamp,
+                             std::string const& variable,
+                             std::string const& selection);
+
+  // If key is present for sample, copies the histogram into hist and
+  // returns true
+  bool Get(std::string const& sample, std::string const& key, TH1F & hist);
+  void Put(std::string const& sample, std::string const& key, TH1F const& hist);
+
+  // Drops all entries of sample, in memory and on disk
+  void Invalidate(std::string const& sample);
+  // Writes any new entries to disk, returns the number of samples that
+  // could not be written
+  int Flush();
+
+  inline std::string const& dir() const { return dir_; }
+  inline unsigned hits() const { return hits_; }
+  inline unsigned misses() const { return misses_; }
+};
+}
+
+#endif
@@ -32,6 +32,8 @@ class WrapperTGraph : public IFunctionWrapper
             return value(xs.size(), xs.data());
         }
 
+        const TGraph& graph() const {return m_graph;}
+
     private:
         TGraph m_graph;
         double m_min, m_max;
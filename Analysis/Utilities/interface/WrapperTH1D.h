@@ -28,6 +28,8 @@ class WrapperTH1D : public IFunctionWrapper
             return value(xs.size(), xs.data());
         }
 
+        const TH1D& histo() const {return m_histo;}
+
     private:
         TH1D m_histo;
 
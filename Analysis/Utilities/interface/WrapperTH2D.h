@@ -31,6 +31,8 @@ class WrapperTH2D : public IFunctionWrapper
             return value(xs.size(), xs.data());
         }
 
+        const TH2D& histo() const {return m_histo;}
+
     private:
         TH2D m_histo;
 
@@ -31,6 +31,8 @@ class WrapperTH2F : public IFunctionWrapper
             return value(xs.size(), xs.data());
         }
 
+        const TH2F& histo() const {return m_histo;}
+
     private:
         TH2F m_histo;
 
@@ -34,6 +34,8 @@ class WrapperTH3D : public IFunctionWrapper
             return value(xs.size(), xs.data());
         }
 
+        const TH3D& histo() const {return m_histo;}
+
     private:
         TH3D m_histo;
 
@@ -3,6 +3,9 @@
 #include <exception>
 #include <algorithm>
 #include <sstream>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
 
 
 BTagEntry::Parameters::Parameters(
@@ -366,6 +369,205 @@ std::string BTagCalibration::token(const BTagEntry::Parameters &par)
 
 
 
+namespace {
+
+// Compiles the arithmetic in BTV formula strings (numbers, x, + - * /,
+// brackets, log, exp, sqrt) into a short stack program. Anything else is
+// left to TF1.
+class BTagFormula
+{
+public:
+  BTagFormula(): depth_(0) {}
+
+  bool compile(const std::string & expr)
+  {
+    ops_.clear();
+    depth_ = 0;
+    str_ = expr;
+    pos_ = 0;
+    bool ok = parseExpr() && (skipSpace(), pos_ == str_.size());
+    if (ok) {
+      int depth = 0;
+      for (const auto & op : ops_) {
+        if (op.code == PUSH_CONST || op.code == PUSH_X) ++depth;
+        else if (op.code != NEG && op.code != LOG && op.code != EXP && op.code != SQRT) --depth;
+        if (depth > int(depth_)) depth_ = depth;
+      }
+      ok = depth_ <= maxDepth;
+    }
+    str_.clear();
+    if (!ok) ops_.clear();
+    return ok;
+  }
+
+  double eval(double x) const
+  {
+    double stack[maxDepth];
+    int top = -1;
+    for (const auto & op : ops_) {
+      switch (op.code) {
+        case PUSH_CONST: stack[++top] = op.value; break;
+        case PUSH_X:     stack[++top] = x; break;
+        case ADD:  --top; stack[top] = stack[top] + stack[top+1]; break;
+        case SUB:  --top; stack[top] = stack[top] - stack[top+1]; break;
+        case MUL:  --top; stack[top] = stack[top] * stack[top+1]; break;
+        case DIV:  --top; stack[top] = stack[top] / stack[top+1]; break;
+        case NEG:  stack[top] = -stack[top]; break;
+        case LOG:  stack[top] = std::log(stack[top]); break;
+        case EXP:  stack[top] = std::exp(stack[top]); break;
+        case SQRT: stack[top] = std::sqrt(stack[top]); break;
+      }
+    }
+    return stack[0];
+  }
+
+private:
+  enum OpCode { PUSH_CONST, PUSH_X, ADD, SUB, MUL, DIV, NEG, LOG, EXP, SQRT };
+  struct Op {
+    OpCode code;
+    double value;
+  };
+  static const unsigned maxDepth = 32;
+
+  void skipSpace()
+  {
+    while (pos_ < str_.size() && std::isspace(str_[pos_])) ++pos_;
+  }
+
+  void push(OpCode code, double value=0.)
+  {
+    Op op;
+    op.code = code;
+    op.value = value;
+    ops_.push_back(op);
+  }
+
+  bool parseExpr()
+  {
+    if (!parseTerm()) return false;
+    while (true) {
+      skipSpace();
+      if (pos_ >= str_.size() || (str_[pos_] != '+' && str_[pos_] != '-')) return true;
+      OpCode code = str_[pos_] == '+' ? ADD : SUB;
+      ++pos_;
+      if (!parseTerm()) return false;
+      push(code);
+    }
+  }
+
+  bool parseTerm()
+  {
+    if (!parseUnary()) return false;
+    while (true) {
+      skipSpace();
+      if (pos_ >= str_.size() || (str_[pos_] != '*' && str_[pos_] != '/')) return true;
+      OpCode code = str_[pos_] == '*' ? MUL : DIV;
+      ++pos_;
+      if (!parseUnary()) return false;
+      push(code);
+    }
+  }
+
+  bool parseUnary()
+  {
+    skipSpace();
+    if (pos_ < str_.size() && str_[pos_] == '-') {
+      ++pos_;
+      if (!parseUnary()) return false;
+      push(NEG);
+      return true;
+    }
+    if (pos_ < str_.size() && str_[pos_] == '+') {
+      ++pos_;
+      return parseUnary();
+    }
+    return parsePrimary();
+  }
+
+  bool parsePrimary()
+  {
+    skipSpace();
+    if (pos_ >= str_.size()) return false;
+    char c = str_[pos_];
+    if (c == '(') {
+      ++pos_;
+      if (!parseExpr()) return false;
+      skipSpace();
+      if (pos_ >= str_.size() || str_[pos_] != ')') return false;
+      ++pos_;
+      return true;
+    }
+    if (std::isdigit(c) || c == '.') {
+      const char * begin = str_.c_str() + pos_;
+      char * end = 0;
+      double value = std::strtod(begin, &end);
+      if (end == begin) return false;
+      pos_ += end - begin;
+      push(PUSH_CONST, value);
+      return true;
+    }
+    if (std::isalpha(c)) {
+      size_t start = pos_;
+      while (pos_ < str_.size() && (std::isalnum(str_[pos_]) || str_[pos_] == '_')) ++pos_;
+      std::string name = str_.substr(start, pos_ - start);
+      if (name == "x") {
+        push(PUSH_X);
+        return true;
+      }
+      OpCode code;
+      if (name == "log") code = LOG;
+      else if (name == "exp") code = EXP;
+      else if (name == "sqrt") code = SQRT;
+      else return false;
+      skipSpace();
+      if (pos_ >= str_.size() || str_[pos_] != '(') return false;
+      ++pos_;
+      if (!parseExpr()) return false;
+      skipSpace();
+      if (pos_ >= str_.size() || str_[pos_] != ')') return false;
+      ++pos_;
+      push(code);
+      return true;
+    }
+    return false;
+  }
+
+  std::vector<Op> ops_;
+  unsigned depth_;
+  std::string str_;
+  size_t pos_;
+};
+
+// Cell k of a set of sorted edges is [edges[k], edges[k+1]), or
+// (edges[k], edges[k+1]] for upper-inclusive ranges; -1 if outside
+int findCell(const std::vector<float> & edges, float v, bool upperInclusive)
+{
+  std::vector<float>::const_iterator it = upperInclusive ?
+    std::lower_bound(edges.begin(), edges.end(), v) :
+    std::upper_bound(edges.begin(), edges.end(), v);
+  int k = int(it - edges.begin()) - 1;
+  if (k < 0 || k >= int(edges.size()) - 1) return -1;
+  return k;
+}
+
+// The range of cells [first, last) covered by [lo, hi], both of which are
+// edges
+std::pair<int, int> cellRange(const std::vector<float> & edges, float lo, float hi)
+{
+  int first = std::lower_bound(edges.begin(), edges.end(), lo) - edges.begin();
+  int last = std::lower_bound(edges.begin(), edges.end(), hi) - edges.begin();
+  return std::make_pair(first, last > first ? last : first);
+}
+
+void sortedUnique(std::vector<float> & v)
+{
+  std::sort(v.begin(), v.end());
+  v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+}
+
+
 class BTagCalibrationReader::BTagCalibrationReaderImpl
 {
   friend class BTagCalibrationReader;
@@ -378,7 +580,27 @@ public:
     float ptMax;
     float discrMin;
     float discrMax;
-    TF1 func;
+    BTagFormula formula;
+    std::shared_ptr<TF1> func;   // only for formulas BTagFormula can't compile
+
+    double eval(double x) const {
+      return func ? func->Eval(x) : formula.eval(x);
+    }
+  };
+
+  // Lookup tables for one jet flavour. The eta, pt and discriminant edges
+  // of all entries split the phase space into cells, each of which stores
+  // the first entry (in file order) that covers it, i.e. the one the
+  // linear search used to return.
+  struct Index {
+    std::vector<float> etaEdges;
+    std::vector<float> ptEdges;
+    std::vector<float> discrEdges;
+    std::vector<int> cells;                           // [eta][pt][discr]
+    std::vector<std::pair<float, float> > ptBounds;   // [eta][discr or none]
+    int nDiscrCells() const {
+      return discrEdges.size() > 1 ? discrEdges.size() - 1 : 1;
+    }
   };
 
 private:
@@ -390,6 +612,8 @@ private:
             BTagEntry::JetFlavor jf,
             std::string measurementType);
 
+  void buildIndex(BTagEntry::JetFlavor jf);
+
   double eval(BTagEntry::JetFlavor jf,
               float eta,
               float pt,
@@ -401,6 +625,11 @@ private:
                           float pt,
                           float discr) const;
 
+  std::vector<double> eval_auto_bounds_all(BTagEntry::JetFlavor jf,
+                                           float eta,
+                                           float pt,
+                                           float discr) const;
+
   std::pair<float, float> min_max_pt(BTagEntry::JetFlavor jf,
                                      float eta,
                                      float discr) const;
@@ -408,7 +637,9 @@ private:
   BTagEntry::OperatingPoint op_;
   std::string sysType_;
   std::vector<std::vector<TmpEntry> > tmpData_;  // first index: jetFlavor
+  std::vector<Index> index_;                     // first index: jetFlavor
   std::vector<bool> useAbsEta_;                  // first index: jetFlavor
+  std::vector<std::string> sysTypes_;            // sysType, then otherSysTypes
   std::map<std::string, std::shared_ptr<BTagCalibrationReaderImpl>> otherSysTypeReaders_;
 };
 
@@ -420,7 +651,9 @@ BTagCalibrationReader::BTagCalibrationReaderImpl::BTagCalibrationReaderImpl(
   op_(op),
   sysType_(sysType),
   tmpData_(3),
-  useAbsEta_(3, true)
+  index_(3),
+  useAbsEta_(3, true),
+  sysTypes_(1, sysType)
 {
   for (const std::string & ost : otherSysTypes) {
     if (otherSysTypeReaders_.count(ost)) {
@@ -432,6 +665,7 @@ throw std::exception();
     otherSysTypeReaders_[ost] = std::shared_ptr<BTagCalibrationReaderImpl>(
         new BTagCalibrationReaderImpl(op, ost)
     );
+    sysTypes_.push_back(ost);
   }
 }
 
@@ -463,12 +697,14 @@ throw std::exception();
     te.discrMin = be.params.discrMin;
     te.discrMax = be.params.discrMax;
 
-    if (op_ == BTagEntry::OP_RESHAPING) {
-      te.func = TF1("", be.formula.c_str(),
-                    be.params.discrMin, be.params.discrMax);
-    } else {
-      te.func = TF1("", be.formula.c_str(),
-                    be.params.ptMin, be.params.ptMax);
+    if (!te.formula.compile(be.formula)) {
+      if (op_ == BTagEntry::OP_RESHAPING) {
+        te.func = std::make_shared<TF1>("", be.formula.c_str(),
+                      be.params.discrMin, be.params.discrMax);
+      } else {
+        te.func = std::make_shared<TF1>("", be.formula.c_str(),
+                      be.params.ptMin, be.params.ptMax);
+      }
     }
 
     tmpData_[be.params.jetFlavor].push_back(te);
@@ -476,12 +712,85 @@ throw std::exception();
       useAbsEta_[be.params.jetFlavor] = false;
     }
   }
+  buildIndex(jf);
 
   for (auto & p : otherSysTypeReaders_) {
     p.second->load(c, jf, measurementType);
   }
 }
 
+void BTagCalibrationReader::BTagCalibrationReaderImpl::buildIndex(
+                                             BTagEntry::JetFlavor jf)
+{
+  bool use_discr = (op_ == BTagEntry::OP_RESHAPING);
+  const auto &entries = tmpData_.at(jf);
+  Index &idx = index_.at(jf);
+
+  for (const auto &e : entries) {
+    idx.etaEdges.push_back(e.etaMin);
+    idx.etaEdges.push_back(e.etaMax);
+    idx.ptEdges.push_back(e.ptMin);
+    idx.ptEdges.push_back(e.ptMax);
+    if (use_discr) {
+      idx.discrEdges.push_back(e.discrMin);
+      idx.discrEdges.push_back(e.discrMax);
+    }
+  }
+  sortedUnique(idx.etaEdges);
+  sortedUnique(idx.ptEdges);
+  sortedUnique(idx.discrEdges);
+
+  int nEta = idx.etaEdges.size() > 1 ? idx.etaEdges.size() - 1 : 0;
+  int nPt = idx.ptEdges.size() > 1 ? idx.ptEdges.size() - 1 : 0;
+  int nDiscr = idx.nDiscrCells();
+
+  // entries are visited in file order and never overwrite a cell
+  idx.cells.assign(nEta * nPt * nDiscr, -1);
+  std::vector<std::pair<int, int> > etaCells(entries.size());
+  std::vector<std::pair<int, int> > discrCells(entries.size(), std::make_pair(0, 1));
+  for (unsigned i=0; i<entries.size(); ++i) {
+    const auto &e = entries[i];
+    etaCells[i] = cellRange(idx.etaEdges, e.etaMin, e.etaMax);
+    if (use_discr) {
+      discrCells[i] = cellRange(idx.discrEdges, e.discrMin, e.discrMax);
+    }
+    std::pair<int, int> ptCells = cellRange(idx.ptEdges, e.ptMin, e.ptMax);
+    for (int ie=etaCells[i].first; ie<etaCells[i].second; ++ie) {
+      for (int ip=ptCells.first; ip<ptCells.second; ++ip) {
+        for (int id=discrCells[i].first; id<discrCells[i].second; ++id) {
+          int &cell = idx.cells[(ie*nPt + ip)*nDiscr + id];
+          if (cell < 0) cell = i;
+        }
+      }
+    }
+  }
+
+  // min_max_pt for every eta cell and discriminant cell, plus a last
+  // column for a discriminant outside all of them
+  idx.ptBounds.assign(nEta * (nDiscr+1), std::make_pair(-1.f, -1.f));
+  for (int ie=0; ie<nEta; ++ie) {
+    for (int id=0; id<=nDiscr; ++id) {
+      float min_pt = -1., max_pt = -1.;
+      for (unsigned i=0; i<entries.size(); ++i) {
+        const auto &e = entries[i];
+        if (ie < etaCells[i].first || ie >= etaCells[i].second) {
+          continue;
+        }
+        if (min_pt < 0.) {                                  // init
+          min_pt = e.ptMin;
+          max_pt = e.ptMax;
+          continue;
+        }
+        if (!use_discr || (id < nDiscr && id >= discrCells[i].first && id < discrCells[i].second)) {
+          min_pt = min_pt < e.ptMin ? min_pt : e.ptMin;
+          max_pt = max_pt > e.ptMax ? max_pt : e.ptMax;
+        }
+      }
+      idx.ptBounds[ie*(nDiscr+1) + id] = std::make_pair(min_pt, max_pt);
+    }
+  }
+}
+
 double BTagCalibrationReader::BTagCalibrationReaderImpl::eval(
                                              BTagEntry::JetFlavor jf,
                                              float eta,
@@ -493,26 +802,19 @@ double BTagCalibrationReader::BTagCalibrationReaderImpl::eval(
     eta = -eta;
   }
 
-  // search linearly through eta, pt and discr ranges and eval
-  // future: find some clever data structure based on intervals
-  const auto &entries = tmpData_.at(jf);
-  for (unsigned i=0; i<entries.size(); ++i) {
-    const auto &e = entries.at(i);
-    if (
-      e.etaMin <= eta && eta < e.etaMax                   // find eta
-      && e.ptMin < pt && pt <= e.ptMax                    // check pt
-    ){
-      if (use_discr) {                                    // discr. reshaping?
-        if (e.discrMin <= discr && discr < e.discrMax) {  // check discr
-          return e.func.Eval(discr);
-        }
-      } else {
-        return e.func.Eval(pt);
-      }
-    }
+  const Index &idx = index_.at(jf);
+  int ie = findCell(idx.etaEdges, eta, false);
+  int ip = findCell(idx.ptEdges, pt, true);
+  int id = use_discr ? findCell(idx.discrEdges, discr, false) : 0;
+  if (ie < 0 || ip < 0 || id < 0) {
+    return 0.;  // default value
   }
-
-  return 0.;  // default value
+  int nPt = idx.ptEdges.size() - 1;
+  int entry = idx.cells[(ie*nPt + ip)*idx.nDiscrCells() + id];
+  if (entry < 0) {
+    return 0.;  // default value
+  }
+  return tmpData_[jf][entry].eval(use_discr ? discr : pt);
 }
 
 double BTagCalibrationReader::BTagCalibrationReaderImpl::eval_auto_bounds(
@@ -557,6 +859,34 @@ throw std::exception();
   return sf_err;
 }
 
+std::vector<double> BTagCalibrationReader::BTagCalibrationReaderImpl::eval_auto_bounds_all(
+                                             BTagEntry::JetFlavor jf,
+                                             float eta,
+                                             float pt,
+                                             float discr) const
+{
+  auto sf_bounds = min_max_pt(jf, eta, discr);
+  float pt_for_eval = pt;
+  bool is_out_of_bounds = false;
+
+  if (pt < sf_bounds.first) {
+    pt_for_eval = sf_bounds.first + .0001;
+    is_out_of_bounds = true;
+  } else if (pt > sf_bounds.second) {
+    pt_for_eval = sf_bounds.second - .0001;
+    is_out_of_bounds = true;
+  }
+
+  std::vector<double> result(sysTypes_.size());
+  double sf = eval(jf, eta, pt_for_eval, discr);
+  result[0] = sf;
+  for (unsigned i=1; i<sysTypes_.size(); ++i) {
+    double sf_err = otherSysTypeReaders_.at(sysTypes_[i])->eval(jf, eta, pt_for_eval, discr);
+    result[i] = is_out_of_bounds ? sf + 2*(sf_err - sf) : sf_err;
+  }
+  return result;
+}
+
 std::pair<float, float> BTagCalibrationReader::BTagCalibrationReaderImpl::min_max_pt(
                                                BTagEntry::JetFlavor jf,
                                                float eta,
@@ -567,31 +897,18 @@ std::pair<float, float> BTagCalibrationReader::BTagCalibrationReaderImpl::min_ma
     eta = -eta;
   }
 
-  const auto &entries = tmpData_.at(jf);
-  float min_pt = -1., max_pt = -1.;
-  for (const auto & e: entries) {
-    if (
-      e.etaMin <= eta && eta < e.etaMax                   // find eta
-    ){
-      if (min_pt < 0.) {                                  // init
-        min_pt = e.ptMin;
-        max_pt = e.ptMax;
-        continue;
-      }
-
-      if (use_discr) {                                    // discr. reshaping?
-        if (e.discrMin <= discr && discr < e.discrMax) {  // check discr
-          min_pt = min_pt < e.ptMin ? min_pt : e.ptMin;
-          max_pt = max_pt > e.ptMax ? max_pt : e.ptMax;
-        }
-      } else {
-        min_pt = min_pt < e.ptMin ? min_pt : e.ptMin;
-        max_pt = max_pt > e.ptMax ? max_pt : e.ptMax;
-      }
-    }
+  const Index &idx = index_.at(jf);
+  int ie = findCell(idx.etaEdges, eta, false);
+  if (ie < 0) {
+    return std::make_pair(-1.f, -1.f);
   }
-
-  return std::make_pair(min_pt, max_pt);
+  int nDiscr = idx.nDiscrCells();
+  int id = 0;
+  if (use_discr) {
+    id = findCell(idx.discrEdges, discr, false);
+    if (id < 0) id = nDiscr;
+  }
+  return idx.ptBounds[ie*(nDiscr+1) + id];
 }
 
 
@@ -624,6 +941,19 @@ double BTagCalibrationReader::eval_auto_bounds(const std::string & sys,
   return pimpl->eval_auto_bounds(sys, jf, eta, pt, discr);
 }
 
+std::vector<double> BTagCalibrationReader::eval_auto_bounds_all(BTagEntry::JetFlavor jf,
+                                                             float eta,
+                                                             float pt,
+                                                             float discr) const
+{
+  return pimpl->eval_auto_bounds_all(jf, eta, pt, discr);
+}
+
+const std::vector<std::string>& BTagCalibrationReader::sys_types() const
+{
+  return pimpl->sysTypes_;
+}
+
 std::pair<float, float> BTagCalibrationReader::min_max_pt(BTagEntry::JetFlavor jf,
                                                           float eta,
                                                           float discr) const
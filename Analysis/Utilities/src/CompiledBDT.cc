@@ -0,0 +1,288 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/CompiledBDT.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+namespace ic {
+
+  namespace {
+    // Just enough XML to read TMVA weight files: a stream of tags with
+    // their attributes, plus the text that follows an opening tag.
+    struct XMLTag {
+      std::string name;
+      std::map<std::string, std::string> attrs;
+      bool closing;
+      bool empty;
+      std::string text;
+    };
+
+    std::string Unescape(std::string const& in) {
+      static const std::pair<const char*, const char*> entities[] = {
+        {"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""}, {"&apos;", "'"}, {"&amp;", "&"}};
+      std::string out = in;
+      for (auto const& e : entities) {
+        std::string from(e.first);
+        for (std::size_t pos = out.find(from); pos != out.npos; pos = out.find(from, pos + 1)) {
+          out.replace(pos, from.size(), e.second);
+        }
+      }
+      return out;
+    }
+
+    // Reads the next tag at or after pos, returns false at the end of the
+    // input or on a malformed tag
+    bool NextTag(std::string const& xml, std::size_t & pos, XMLTag & tag) {
+      while (true) {
+        pos = xml.find('<', pos);
+        if (pos == xml.npos || pos + 1 >= xml.size()) return false;
+        if (xml.compare(pos, 4, "<!--") == 0) {
+          pos = xml.find("-->", pos);
+          if (pos == xml.npos) return false;
+          continue;
+        }
+        if (xml[pos + 1] == '?' || xml[pos + 1] == '!') {
+          pos = xml.find('>', pos);
+          if (pos == xml.npos) return false;
+          continue;
+        }
+        break;
+      }
+      tag.attrs.clear();
+      tag.text.clear();
+      tag.closing = xml[pos + 1] == '/';
+      tag.empty = false;
+      std::size_t i = pos + (tag.closing ? 2 : 1);
+      std::size_t name_end = xml.find_first_of(" \t\r\n/>", i);
+      if (name_end == xml.npos) return false;
+      tag.name = xml.substr(i, name_end - i);
+      i = name_end;
+      while (true) {
+        i = xml.find_first_not_of(" \t\r\n", i);
+        if (i == xml.npos) return false;
+        if (xml[i] == '>') break;
+        if (xml[i] == '/') {
+          tag.empty = true;
+          i = xml.find('>', i);
+          if (i == xml.npos) return false;
+          break;
+        }
+        std::size_t eq = xml.find('=', i);
+        if (eq == xml.npos) return false;
+        std::size_t key_end = xml.find_last_not_of(" \t\r\n", eq - 1) + 1;
+        std::size_t q1 = xml.find_first_of("\"'", eq);
+        if (q1 == xml.npos) return false;
+        std::size_t q2 = xml.find(xml[q1], q1 + 1);
+        if (q2 == xml.npos) return false;
+        tag.attrs[xml.substr(i, key_end - i)] = Unescape(xml.substr(q1 + 1, q2 - q1 - 1));
+        i = q2 + 1;
+      }
+      pos = i + 1;
+      if (!tag.closing && !tag.empty) {
+        std::size_t next = xml.find('<', pos);
+        if (next != xml.npos) tag.text = Unescape(xml.substr(pos, next - pos));
+      }
+      return true;
+    }
+
+    std::string Trim(std::string const& in) {
+      std::size_t b = in.find_first_not_of(" \t\r\n");
+      if (b == in.npos) return "";
+      std::size_t e = in.find_last_not_of(" \t\r\n");
+      return in.substr(b, e - b + 1);
+    }
+
+    struct RawNode {
+      int ivar;
+      float cut;
+      bool cut_type;
+      float response;
+      float purity;
+      int type;
+      int left;
+      int right;
+    };
+  }
+
+  CompiledBDT::CompiledBDT() : norm_(0.), output_(kWeightedAverage) {
+  }
+
+  bool CompiledBDT::Load(std::string const& filename) {
+    name_ = filename;
+    variables_.clear();
+    labels_.clear();
+    nodes_.clear();
+    roots_.clear();
+    tree_weights_.clear();
+    norm_ = 0.;
+
+    std::ifstream file(filename.c_str());
+    if (!file.is_open()) {
+      std::cerr << "[CompiledBDT] Unable to open " << filename << std::endl;
+      return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string const xml = buffer.str();
+
+    std::map<std::string, std::string> options;
+    bool is_bdt = false;
+    bool regression_trees = false;
+    std::vector<RawNode> raw;
+    std::vector<int> stack;
+    std::vector<std::vector<RawNode> > trees;
+    std::size_t pos = 0;
+    XMLTag tag;
+    std::string error;
+    while (error == "" && NextTag(xml, pos, tag)) {
+      if (tag.closing) {
+        if (tag.name == "Node") {
+          if (stack.empty()) error = "unbalanced Node tags";
+          else stack.pop_back();
+        } else if (tag.name == "BinaryTree") {
+          trees.push_back(raw);
+          raw.clear();
+        }
+        continue;
+      }
+      if (tag.name == "MethodSetup") {
+        is_bdt = tag.attrs["Method"].compare(0, 5, "BDT::") == 0;
+        if (!is_bdt) error = "method " + tag.attrs["Method"] + " is not a BDT";
+      } else if (tag.name == "Option") {
+        options[tag.attrs["name"]] = Trim(tag.text);
+      } else if (tag.name == "Variable") {
+        unsigned index = std::atoi(tag.attrs["VarIndex"].c_str());
+        if (index != variables_.size()) error = "variables are not listed in order";
+        variables_.push_back(tag.attrs["Expression"]);
+        labels_.push_back(tag.attrs["Label"]);
+      } else if (tag.name == "Transformations") {
+        if (std::atoi(tag.attrs["NTransformations"].c_str()) != 0) error = "input transformations are not supported";
+      } else if (tag.name == "Weights") {
+        std::string type = tag.attrs.count("TreeType") ? tag.attrs["TreeType"] : tag.attrs["AnalysisType"];
+        regression_trees = std::atoi(type.c_str()) == 1;
+        if (std::atoi(type.c_str()) > 1) error = "multiclass forests are not supported";
+      } else if (tag.name == "BinaryTree") {
+        tree_weights_.push_back(std::atof(tag.attrs["boostWeight"].c_str()));
+        raw.clear();
+        stack.clear();
+      } else if (tag.name == "Node") {
+        if (std::atoi(tag.attrs["NCoef"].c_str()) != 0) {
+          error = "Fisher cuts are not supported";
+          break;
+        }
+        RawNode node;
+        node.ivar = std::atoi(tag.attrs["IVar"].c_str());
+        node.cut = float(std::atof(tag.attrs["Cut"].c_str()));
+        node.cut_type = std::atoi(tag.attrs["cType"].c_str()) != 0;
+        node.response = float(std::atof(tag.attrs["res"].c_str()));
+        node.purity = float(std::atof(tag.attrs["purity"].c_str()));
+        node.type = std::atoi(tag.attrs["nType"].c_str());
+        node.left = -1;
+        node.right = -1;
+        int index = raw.size();
+        raw.push_back(node);
+        if (!stack.empty()) {
+          std::string const& side = tag.attrs["pos"];
+          if (side == "l") raw[stack.back()].left = index;
+          else if (side == "r") raw[stack.back()].right = index;
+          else error = "node without a position";
+        }
+        if (!tag.empty) stack.push_back(index);
+      }
+    }
+    if (error == "" && !is_bdt) error = "not a TMVA weight file";
+    if (error == "" && (trees.size() == 0 || trees.size() != tree_weights_.size())) error = "no trees found";
+    if (error != "") {
+      std::cerr << "[CompiledBDT] Cannot compile " << filename << ": " << error << std::endl;
+      variables_.clear();
+      labels_.clear();
+      tree_weights_.clear();
+      return false;
+    }
+
+    // How MethodBDT::GetMvaValue combines the trees, and what
+    // DecisionTree::CheckEvent returns from a leaf
+    output_ = options["BoostType"] == "Grad" ? kGrad : kWeightedAverage;
+    bool use_yes_no_leaf = options.count("UseYesNoLeaf") == 0 || options["UseYesNoLeaf"] == "True";
+    bool use_weighted_trees = options.count("UseWeightedTrees") == 0 || options["UseWeightedTrees"] == "True";
+    if (!use_weighted_trees) {
+      for (auto & w : tree_weights_) w = 1.;
+    }
+    norm_ = 0.;
+    for (auto const& w : tree_weights_) norm_ += w;
+
+    // Flatten each tree breadth-first so that siblings are adjacent
+    for (auto const& tree : trees) {
+      roots_.push_back(nodes_.size());
+      std::vector<std::pair<int, unsigned> > queue;
+      nodes_.push_back(Node());
+      queue.push_back(std::make_pair(0, roots_.back()));
+      for (unsigned q = 0; q < queue.size(); ++q) {
+        RawNode const& in = tree[queue[q].first];
+        Node & out = nodes_[queue[q].second];
+        // CheckEvent descends while the node type is 0
+        if (in.type != 0) {
+          out.var = -1;
+          out.cut = 0.;
+          out.cut_type = false;
+          out.child = 0;
+          if (regression_trees) out.value = double(in.response);
+          else out.value = use_yes_no_leaf ? double(in.type) : double(in.purity);
+          continue;
+        }
+        if (in.left < 0 || in.right < 0 || in.ivar < 0 || unsigned(in.ivar) >= variables_.size()) {
+          std::cerr << "[CompiledBDT] Cannot compile " << filename << ": malformed tree" << std::endl;
+          variables_.clear();
+          labels_.clear();
+          nodes_.clear();
+          roots_.clear();
+          tree_weights_.clear();
+          return false;
+        }
+        unsigned child = nodes_.size();
+        out.var = in.ivar;
+        out.cut = in.cut;
+        out.cut_type = in.cut_type;
+        out.child = child;
+        out.value = 0.;
+        nodes_.push_back(Node());
+        nodes_.push_back(Node());
+        queue.push_back(std::make_pair(in.left, child));
+        queue.push_back(std::make_pair(in.right, child + 1));
+      }
+    }
+    return true;
+  }
+
+  double CompiledBDT::Finalise(double sum) const {
+    if (output_ == kGrad) return 2.0 / (1.0 + std::exp(-2.0 * sum)) - 1.0;
+    return (norm_ > std::numeric_limits<double>::epsilon()) ? sum / norm_ : 0.;
+  }
+
+  double CompiledBDT::Evaluate(float const* x) const {
+    double sum = 0.;
+    if (output_ == kGrad) {
+      for (unsigned t = 0; t < roots_.size(); ++t) sum += TreeResponse(t, x);
+    } else {
+      for (unsigned t = 0; t < roots_.size(); ++t) sum += tree_weights_[t] * TreeResponse(t, x);
+    }
+    return Finalise(sum);
+  }
+
+  void CompiledBDT::EvaluateBatch(float const* x, unsigned n, unsigned stride, double * out) const {
+    for (unsigned i = 0; i < n; ++i) out[i] = 0.;
+    for (unsigned t = 0; t < roots_.size(); ++t) {
+      if (output_ == kGrad) {
+        for (unsigned i = 0; i < n; ++i) out[i] += TreeResponse(t, x + std::size_t(i) * stride);
+      } else {
+        double w = tree_weights_[t];
+        for (unsigned i = 0; i < n; ++i) out[i] += w * TreeResponse(t, x + std::size_t(i) * stride);
+      }
+    }
+    for (unsigned i = 0; i < n; ++i) out[i] = Finalise(out[i]);
+  }
+}
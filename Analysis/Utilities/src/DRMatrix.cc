@@ -0,0 +1,88 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/DRMatrix.h"
+#include <algorithm>
+
+namespace ic {
+
+  DRMatrix::DRMatrix() : n1_(0), n2_(0) {
+  }
+
+  void DRMatrix::Compute() {
+    n1_ = eta1_.size();
+    n2_ = eta2_.size();
+    dr2_.resize(std::size_t(n1_) * n2_);
+    double const pi = M_PI;
+    double const two_pi = 2.0 * M_PI;
+    double const* eta2 = eta2_.data();
+    double const* phi2 = phi2_.data();
+    for (unsigned i = 0; i < n1_; ++i) {
+      double const eta = eta1_[i];
+      double const phi = phi1_[i];
+      double * row = dr2_.data() + std::size_t(i) * n2_;
+      for (unsigned j = 0; j < n2_; ++j) {
+        double deta = eta2[j] - eta;
+        double dphi = phi2[j] - phi;
+        // Both phi values are in [-pi, pi] so one shift is enough
+        dphi -= two_pi * double(dphi > pi);
+        dphi += two_pi * double(dphi <= -pi);
+        row[j] = deta * deta + dphi * dphi;
+      }
+    }
+  }
+
+  void DRMatrix::NotWithin(double min_dr, std::vector<bool> & keep) const {
+    double const cut = min_dr * min_dr;
+    keep.assign(n1_, true);
+    for (unsigned i = 0; i < n1_; ++i) {
+      double const* row = dr2_.data() + std::size_t(i) * n2_;
+      bool close = false;
+      for (unsigned j = 0; j < n2_; ++j) close |= (row[j] < cut);
+      keep[i] = !close;
+    }
+  }
+
+  std::vector<int> DRMatrix::BestMatch(double max_dr) const {
+    double const cut = max_dr * max_dr;
+    std::vector<int> best(n1_, -1);
+    for (unsigned i = 0; i < n1_; ++i) {
+      double const* row = dr2_.data() + std::size_t(i) * n2_;
+      double min = cut;
+      for (unsigned j = 0; j < n2_; ++j) {
+        if (row[j] < min) {
+          min = row[j];
+          best[i] = j;
+        }
+      }
+    }
+    return best;
+  }
+
+  std::vector<std::pair<unsigned, unsigned> > DRMatrix::Match(
+      double max_dr, bool unique_first, bool unique_second) const {
+    double const cut = max_dr * max_dr;
+    std::vector<std::pair<unsigned, unsigned> > pairs;
+    for (unsigned i = 0; i < n1_; ++i) {
+      double const* row = dr2_.data() + std::size_t(i) * n2_;
+      for (unsigned j = 0; j < n2_; ++j) {
+        if (row[j] < cut) pairs.push_back(std::make_pair(i, j));
+      }
+    }
+    std::stable_sort(pairs.begin(), pairs.end(),
+        [&](std::pair<unsigned, unsigned> const& a, std::pair<unsigned, unsigned> const& b) {
+          return DR2(a.first, a.second) < DR2(b.first, b.second);
+        });
+    if (!unique_first && !unique_second) return pairs;
+    std::vector<bool> used1(n1_, false);
+    std::vector<bool> used2(n2_, false);
+    unsigned n = 0;
+    for (unsigned k = 0; k < pairs.size(); ++k) {
+      unsigned i = pairs[k].first;
+      unsigned j = pairs[k].second;
+      if ((unique_first && used1[i]) || (unique_second && used2[j])) continue;
+      used1[i] = true;
+      used2[j] = true;
+      pairs[n++] = pairs[k];
+    }
+    pairs.resize(n);
+    return pairs;
+  }
+}
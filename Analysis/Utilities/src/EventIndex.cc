@@ -0,0 +1,144 @@
+#include "Utilities/interface/EventIndex.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "UserCode/ICHiggsTauTau/interface/EventInfo.hh"
+
+namespace ic {
+
+void EventIndex::Build(std::vector<std::string> const& files,
+                       std::string const& tree_path,
+                       std::string const& branch) {
+  files_ = files;
+  entries_.clear();
+  for (unsigned f = 0; f < files_.size(); ++f) {
+    TFile* file_ptr = TFile::Open(files_[f].c_str());
+    if (!file_ptr) {
+      throw std::runtime_error("[EventIndex] Unable to open file " + files_[f]);
+    }
+    TTree* tree = dynamic_cast<TTree*>(file_ptr->Get(tree_path.c_str()));
+    if (!tree) {
+      throw std::runtime_error("[EventIndex] Unable to find TTree " +
+                               tree_path + " in file " + files_[f]);
+    }
+    TBranch* info_br = tree->GetBranch(branch.c_str());
+    TBranch* run_br = info_br ? info_br->FindBranch("run_") : nullptr;
+    TBranch* ls_br = info_br ? info_br->FindBranch("lumi_block_") : nullptr;
+    TBranch* evt_br = info_br ? info_br->FindBranch("event_") : nullptr;
+    if (!run_br || !ls_br || !evt_br) {
+      throw std::runtime_error(
+          "[EventIndex] Unable to find the run, lumi_block and event of branch " +
+          branch);
+    }
+    EventInfo* info = nullptr;
+    tree->SetBranchAddress(branch.c_str(), &info);
+    int64_t n = tree->GetEntries();
+    for (int64_t i = 0; i < n; ++i) {
+      run_br->GetEntry(i);
+      ls_br->GetEntry(i);
+      evt_br->GetEntry(i);
+      entries_.push_back({EventID(info->run(), info->lumi_block(), info->event()), f, i});
+    }
+    tree->ResetBranchAddress(info_br);
+    delete info;
+    file_ptr->Close();
+    delete file_ptr;
+    std::cout << ">> Indexed " << n << " entries of " << files_[f] << "\n";
+  }
+  std::stable_sort(entries_.begin(), entries_.end());
+}
+
+bool EventIndex::Load(std::string const& filename,
+                      std::vector<std::string> const& files) {
+  std::ifstream in(filename.c_str());
+  if (!in.is_open()) return false;
+  std::string key;
+  unsigned n_files = 0;
+  int64_t n_entries = 0;
+  in >> key >> n_files;
+  std::vector<std::string> index_files(n_files);
+  std::getline(in, key);
+  for (auto & f : index_files) std::getline(in, f);
+  if (!in || index_files != files) {
+    std::cout << ">> Event index " << filename
+              << " is for a different list of files\n";
+    return false;
+  }
+  in >> key >> n_entries;
+  std::vector<Entry> entries(n_entries);
+  for (auto & e : entries) {
+    in >> std::get<0>(e.id) >> std::get<1>(e.id) >> std::get<2>(e.id) >>
+        e.file >> e.entry;
+  }
+  if (!in) {
+    throw std::runtime_error("[EventIndex] Unable to read index " + filename);
+  }
+  files_ = index_files;
+  entries_.swap(entries);
+  return true;
+}
+
+void EventIndex::Save(std::string const& filename) const {
+  std::ofstream out(filename.c_str());
+  out << "files " << files_.size() << "\n";
+  for (auto const& f : files_) out << f << "\n";
+  out << "entries " << entries_.size() << "\n";
+  for (auto const& e : entries_) {
+    out << std::get<0>(e.id) << " " << std::get<1>(e.id) << " "
+        << std::get<2>(e.id) << " " << e.file << " " << e.entry << "\n";
+  }
+  if (!out) {
+    throw std::runtime_error("[EventIndex] Unable to write index " + filename);
+  }
+}
+
+std::vector<std::vector<int64_t>> EventIndex::PickedEntries(
+    std::vector<EventID> const& events) const {
+  std::vector<std::vector<int64_t>> result(files_.size());
+  for (auto const& id : events) {
+    Entry key{id, 0, 0};
+    auto range = std::equal_range(entries_.begin(), entries_.end(), key);
+    if (range.first == range.second) {
+      std::cout << ">> Event " << std::get<0>(id) << ":" << std::get<1>(id)
+                << ":" << std::get<2>(id) << " not found\n";
+    }
+    // An event can appear more than once, e.g. in overlapping datasets
+    for (auto it = range.first; it != range.second; ++it) {
+      result[it->file].push_back(it->entry);
+    }
+  }
+  for (auto & entries : result) {
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+  }
+  return result;
+}
+
+std::vector<EventIndex::EventID> EventIndex::ParseEventList(
+    std::string const& filename) {
+  std::ifstream in(filename.c_str());
+  if (!in.is_open()) {
+    throw std::runtime_error("[EventIndex] Unable to open event list " +
+                             filename);
+  }
+  std::vector<EventID> events;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::replace(line.begin(), line.end(), ':', ' ');
+    std::istringstream ss(line);
+    EventID id;
+    if (!(ss >> std::get<0>(id) >> std::get<1>(id) >> std::get<2>(id))) {
+      throw std::runtime_error("[EventIndex] Event not in the form run:lumi:event: " +
+                               line);
+    }
+    events.push_back(id);
+  }
+  return events;
+}
+}
@@ -1,7 +1,10 @@
 
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FakeFactor.h"
 
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <tuple>
 
 ClassImp(FakeFactor)
 
@@ -17,34 +20,241 @@ FakeFactor::~FakeFactor()
 
 
 /*****************************************************************/
-double FakeFactor::value(const std::vector<double>& xs,
-        std::vector<size_t>& nodesVec,
-        std::vector<std::vector<size_t>>& indicesVec,
-        std::vector<std::vector<size_t>>& inputsVec,
-        size_t index)
+// The trees of all the systematics merged into one list of unique nodes.
+// Two nodes are the same if they apply the same function to the same
+// inputs (leaves) or to the same son nodes, so the parts of the trees
+// that a systematic does not modify are shared with the nominal one.
+// Sons always come before their parents in the list.
+// Histograms and graphs are copied into flat arrays, and formulas are
+// called through the wrapper without copying the arguments.
 /*****************************************************************/
+struct FakeFactor::Compiled
 {
-    if( xs.size() != m_inputs.size() ){
-        throw std::length_error( "[FakeFactor::value()] Number of inputs does not match length of required inputs." );
+    struct Axis
+    {
+        int n = 0;
+        double min = 0.;
+        double max = 0.;
+        std::vector<double> edges; // only for variable bin widths
+
+        void set(const TAxis& axis)
+        {
+            n = axis.GetNbins();
+            min = axis.GetXmin();
+            max = axis.GetXmax();
+            const TArrayD* bins = axis.GetXbins();
+            if(bins && bins->GetSize()>0) edges.assign(bins->GetArray(), bins->GetArray()+bins->GetSize());
+        }
+        // Same as TAxis::FindBin, then moved away from the under/overflow bins
+        int bin(double x) const
+        {
+            int b = 0;
+            if(x<min) b = 0;
+            else if(!(x<max)) b = n+1;
+            else if(edges.empty()) b = 1 + int(n*(x-min)/(max-min));
+            else b = std::upper_bound(edges.begin(), edges.end(), x) - edges.begin();
+            if(b>n) b = n;
+            else if(b==0) b = 1;
+            return b;
+        }
+    };
+
+    struct Function
+    {
+        enum Type {Wrapped, Histogram, Graph};
+        Type type = Wrapped;
+        IFunctionWrapper* wrapper = nullptr;
+        // Histogram: bin (bx,by,bz) is contents[(bx-1) + nx*((by-1) + ny*(bz-1))]
+        unsigned dim = 0;
+        Axis axes[3];
+        std::vector<double> contents;
+        // Graph: points with strictly increasing x
+        std::vector<double> x;
+        std::vector<double> y;
+
+        void setHisto(const TH1& h, unsigned d)
+        {
+            type = Histogram;
+            dim = d;
+            axes[0].set(*h.GetXaxis());
+            if(dim>1) axes[1].set(*h.GetYaxis());
+            if(dim>2) axes[2].set(*h.GetZaxis());
+            int nx = axes[0].n;
+            int ny = (dim>1 ? axes[1].n : 1);
+            int nz = (dim>2 ? axes[2].n : 1);
+            contents.reserve(nx*ny*nz);
+            for(int bz=1; bz<=nz; bz++)
+                for(int by=1; by<=ny; by++)
+                    for(int bx=1; bx<=nx; bx++)
+                        contents.push_back(dim==1 ? h.GetBinContent(bx) : (dim==2 ? h.GetBinContent(bx,by) : h.GetBinContent(bx,by,bz)));
+        }
+        // Only graphs sorted in x are flattened, as TGraph::Eval then
+        // reduces to an interpolation between the two neighbouring points
+        void setGraph(const TGraph& g)
+        {
+            int n = g.GetN();
+            if(n<2) return;
+            for(int i=1; i<n; i++) if(!(g.GetX()[i-1]<g.GetX()[i])) return;
+            type = Graph;
+            x.assign(g.GetX(), g.GetX()+n);
+            y.assign(g.GetY(), g.GetY()+n);
+        }
+
+        double value(size_t size, const double* xs) const
+        {
+            if(type==Wrapped) return wrapper->value(size, xs);
+            if(type==Histogram)
+            {
+                if(size<dim) return 0.;
+                size_t b = axes[0].bin(xs[0]) - 1;
+                if(dim>1) b += axes[0].n * (axes[1].bin(xs[1]) - 1);
+                if(dim>2) b += size_t(axes[0].n) * axes[1].n * (axes[2].bin(xs[2]) - 1);
+                return contents[b];
+            }
+            // Graph, evaluated as TGraph::Eval(xs[0]) in WrapperTGraph
+            if(size==0) return 0.;
+            double v = xs[0];
+            if(v!=v) return y[0];
+            size_t up = std::lower_bound(x.begin(), x.end(), v) - x.begin();
+            if(up<x.size() && x[up]==v) return y[up];
+            // Outside the range, extrapolate from the first or last two points
+            if(up==0) up = 1;
+            else if(up==x.size()) up = x.size()-1;
+            size_t low = up-1;
+            return y[up] + (v-x[up])*(y[low]-y[up])/(x[low]-x[up]);
+        }
+    };
+
+    struct Node
+    {
+        unsigned function;
+        bool leaf;
+        std::vector<size_t> args; // input variables of a leaf, son nodes otherwise
+    };
+
+    std::vector<Function> functions; // same order as m_wrappers
+    std::vector<Node> nodes;
+    std::vector<std::string> names; // systematics(), sorted
+    std::vector<int> roots; // root node of each systematic, -1 for an empty tree
+    std::vector<std::vector<unsigned>> needed; // nodes below each root, in order
+
+    // Work space
+    std::vector<double> nodeValues;
+    std::vector<double> args;
+
+    void evaluate(const double* xs, unsigned index)
+    {
+        const Node& node = nodes[index];
+        args.clear();
+        if(node.leaf) for(size_t i : node.args) args.push_back(xs[i]);
+        else for(size_t i : node.args) args.push_back(nodeValues[i]);
+        nodeValues[index] = functions[node.function].value(args.size(), args.data());
+    }
+};
+
+
+/*****************************************************************/
+FakeFactor::Compiled& FakeFactor::compiled()
+/*****************************************************************/
+{
+    if(m_compiled) return *m_compiled;
+    m_compiled = std::make_shared<Compiled>();
+    Compiled& c = *m_compiled;
+
+    c.functions.resize(m_wrappers.size());
+    for(size_t i=0; i<m_wrappers.size(); i++)
+    {
+        Compiled::Function& fct = c.functions[i];
+        fct.wrapper = m_wrappers[i];
+        if(auto w = dynamic_cast<WrapperTH1D*>(m_wrappers[i])) fct.setHisto(w->histo(), 1);
+        else if(auto w = dynamic_cast<WrapperTH2D*>(m_wrappers[i])) fct.setHisto(w->histo(), 2);
+        else if(auto w = dynamic_cast<WrapperTH2F*>(m_wrappers[i])) fct.setHisto(w->histo(), 2);
+        else if(auto w = dynamic_cast<WrapperTH3D*>(m_wrappers[i])) fct.setHisto(w->histo(), 3);
+        else if(auto w = dynamic_cast<WrapperTGraph*>(m_wrappers[i])) fct.setGraph(w->graph());
     }
-    const auto& indices = indicesVec[index];
-    if(indices.size()>1) // Node
+
+    std::map<std::tuple<size_t,bool,std::vector<size_t>>, unsigned> ids;
+    for(const auto& sys_nodes : m_nodes)
     {
-        std::vector<double> values;
-        values.reserve(indices.size());
-        for(size_t i : indices) values.push_back( value(xs, nodesVec, indicesVec, inputsVec, i) );
-        auto& node = m_wrappers.at(nodesVec[index]);
-        return node->value(values);
+        const auto& indices = m_indices[sys_nodes.first];
+        const auto& inputs = m_nodeInputs[sys_nodes.first];
+        std::vector<unsigned> local; // tree index -> node
+        for(size_t k=0; k<sys_nodes.second.size(); k++)
+        {
+            Compiled::Node node;
+            node.function = sys_nodes.second[k];
+            node.leaf = (indices[k].size()<=1);
+            if(node.leaf) node.args = inputs[k];
+            else for(size_t i : indices[k]) node.args.push_back(local[i]);
+            auto key = std::make_tuple(size_t(node.function), node.leaf, node.args);
+            auto itr = ids.find(key);
+            if(itr==ids.end())
+            {
+                itr = ids.insert(std::make_pair(key, unsigned(c.nodes.size()))).first;
+                c.nodes.push_back(node);
+            }
+            local.push_back(itr->second);
+        }
+        c.names.push_back(sys_nodes.first);
+        c.roots.push_back(local.empty() ? -1 : int(local.back()));
+        c.needed.push_back(std::vector<unsigned>());
+        if(local.empty()) continue;
+        std::vector<bool> used(c.nodes.size(), false);
+        used[local.back()] = true;
+        for(int i=local.back(); i>=0; i--)
+        {
+            if(!used[i] || c.nodes[i].leaf) continue;
+            for(size_t son : c.nodes[i].args) used[son] = true;
+        }
+        for(size_t i=0; i<used.size(); i++) if(used[i]) c.needed.back().push_back(i);
     }
-    else // Leaf
+    c.nodeValues.resize(c.nodes.size());
+    return c;
+}
+
+
+/*****************************************************************/
+int FakeFactor::systematicIndex(const std::string& sys)
+/*****************************************************************/
+{
+    const auto& names = compiled().names;
+    auto itr = std::lower_bound(names.begin(), names.end(), sys);
+    if(itr==names.end() || *itr!=sys) return -1;
+    return itr - names.begin();
+}
+
+
+/*****************************************************************/
+double FakeFactor::value(const std::vector<double>& xs, const std::string& sys)
+/*****************************************************************/
+{
+    int index = systematicIndex(sys);
+    if(index<0)
     {
-        auto& leaf = m_wrappers.at(nodesVec[index]);
-        const auto& inputs = inputsVec[index];
-        std::vector<double> xssubset;
-        xssubset.reserve(inputs.size());
-        for(size_t i : inputs) xssubset.push_back( xs[i] );
-        return leaf->value(xssubset);
+        std::cout<<"[FakeFactor] ERROR: Non registered systematic "<<sys<<"\n";
+        return 1.;
+    }
+    if( xs.size() != m_inputs.size() ){
+        throw std::length_error( "[FakeFactor::value()] Number of inputs does not match length of required inputs." );
+    }
+    Compiled& c = *m_compiled;
+    if(c.roots[index]<0) return 1.;
+    for(unsigned i : c.needed[index]) c.evaluate(xs.data(), i);
+    return c.nodeValues[c.roots[index]];
+}
+
+
+/*****************************************************************/
+void FakeFactor::values(const std::vector<double>& xs, std::vector<double>& values)
+/*****************************************************************/
+{
+    if( xs.size() != m_inputs.size() ){
+        throw std::length_error( "[FakeFactor::values()] Number of inputs does not match length of required inputs." );
     }
+    Compiled& c = compiled();
+    for(unsigned i=0; i<c.nodes.size(); i++) c.evaluate(xs.data(), i);
+    values.resize(c.roots.size());
+    for(size_t i=0; i<c.roots.size(); i++) values[i] = (c.roots[i]<0 ? 1. : c.nodeValues[c.roots[i]]);
 }
 
 
@@ -55,6 +265,7 @@ bool FakeFactor::addNode(WrapperPtr fct,
         const std::string& sys)
 /*****************************************************************/
 {
+    m_compiled.reset();
     if(!fct)
     {
         std::cout<<"[FakeFactor] ERROR: Trying to add a nullptr\n";
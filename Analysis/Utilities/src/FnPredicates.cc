@@ -1,5 +1,6 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPredicates.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnPairs.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
 #include "UserCode/ICHiggsTauTau//interface/city.h"
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/ElectronEffectiveArea.h"
 
@@ -413,57 +414,15 @@ namespace ic {
   }
 
 
+  // Both use the cached pair kinematics of the CompositeCandidate
   double PZeta(CompositeCandidate const* cand, Candidate const* met, double const& alpha) {
-    if (cand->AsVector().size() < 2) return 0.0;
-    Candidate const* leg1 = cand->At(0);
-    Candidate const* leg2 = cand->At(1);
-    double leg1x = cos(leg1->phi());
-    double leg1y = sin(leg1->phi());
-    double leg2x = cos(leg2->phi());
-    double leg2y = sin(leg2->phi());
-    double zetaX = leg1x + leg2x;
-    double zetaY = leg1y + leg2y;
-    double zetaR = TMath::Sqrt(zetaX*zetaX + zetaY*zetaY);
-    if ( zetaR > 0. ) {
-     zetaX /= zetaR;
-     zetaY /= zetaR;
-   }
-
-   double visPx = leg1->vector().px() + leg2->vector().px();
-   double visPy = leg1->vector().py() + leg2->vector().py();
-   double pZetaVis = visPx*zetaX + visPy*zetaY;
-
-   double px = /*visPx + */met->vector().px();
-   double py = /*visPy + */met->vector().py();
-   double pZetaMiss = px*zetaX + py*zetaY;
-
-   return (pZetaMiss - alpha * pZetaVis);
+    return cand->PZeta(met, alpha);
   }
 
   double PZetaVis(CompositeCandidate const* cand) {
-     if (cand->AsVector().size() < 2) return 0.0;
-     Candidate const* leg1 = cand->At(0);
-     Candidate const* leg2 = cand->At(1); //MUG
-     double leg1x = cos(leg1->phi());
-     double leg1y = sin(leg1->phi());
-     double leg2x = cos(leg2->phi());
-     double leg2y = sin(leg2->phi());
-     double zetaX = leg1x + leg2x;
-     double zetaY = leg1y + leg2y;
-     double zetaR = TMath::Sqrt(zetaX*zetaX + zetaY*zetaY);
-     if ( zetaR > 0. ) {
-      zetaX /= zetaR;
-      zetaY /= zetaR;
-    }
-
-    double visPx = leg1->vector().px() + leg2->vector().px();
-    double visPy = leg1->vector().py() + leg2->vector().py();
-    double pZetaVis = visPx*zetaX + visPy*zetaY;
-    return pZetaVis;
+    return cand->PZetaVis();
   }
 
-
-
   double MT(Candidate const* cand1, Candidate const* cand2) {
     double mt = 2. * cand1->pt() * cand2->pt() * (1. - cos(ROOT::Math::VectorUtil::DeltaPhi(cand1->vector(), cand2->vector())));
     if (mt > 0) {
@@ -1796,41 +1755,7 @@ namespace ic {
   }
 
   std::vector<GenJet> BuildTauJets(std::vector<GenParticle *> const& parts, bool include_leptonic, bool use_prompt) {
-    std::vector<GenJet> taus;
-    for (unsigned i = 0; i < parts.size(); ++i) {
-        std::vector<bool> status_flags;
-        bool is_prompt=true; 
-        if(use_prompt){
-          status_flags = parts[i]->statusFlags();
-          is_prompt=status_flags[IsPrompt];
-        }
-      if (abs(parts[i]->pdgid()) == 15 && is_prompt) {
-        std::vector<GenParticle *> daughters = ExtractDaughters(parts[i], parts);
-        bool has_tau_daughter = false;
-        bool has_lepton_daughter = false;
-        for (unsigned j = 0; j < daughters.size(); ++j) {
-          if (abs(daughters[j]->pdgid()) == 15) has_tau_daughter = true;
-          if (abs(daughters[j]->pdgid()) == 11 || abs(daughters[j]->pdgid()) == 13) has_lepton_daughter = true;
-        }
-        if (has_tau_daughter) continue;
-        if (has_lepton_daughter && !include_leptonic) continue;
-        std::vector<GenParticle *> jet_parts = ExtractStableDaughters(parts[i], parts);
-        taus.push_back(GenJet());
-        ROOT::Math::PtEtaPhiEVector vec;
-        std::vector<std::size_t> id_vec;
-        for (unsigned k = 0; k < jet_parts.size(); ++k) {
-          if (  abs(jet_parts[k]->pdgid()) == 12 || 
-                abs(jet_parts[k]->pdgid()) == 14 ||
-                abs(jet_parts[k]->pdgid()) == 16 ) continue;
-          vec += jet_parts[k]->vector();
-          taus.back().set_charge(taus.back().charge() + jet_parts[k]->charge());
-          id_vec.push_back(jet_parts[k]->id());
-        }
-        taus.back().set_vector(vec);
-        taus.back().set_constituents(id_vec);
-      }
-    }
-    return taus;
+    return GenGraph(parts).TauJets(include_leptonic, use_prompt);
   }
 
   ROOT::Math::PtEtaPhiEVector reconstructWboson(Candidate const*  lepton, Candidate const* met){
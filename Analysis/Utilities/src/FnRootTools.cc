@@ -1,6 +1,11 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/FnRootTools.h"
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/HistMorph.h"
 #include <fstream>
 #include <cmath>
+#include "TDirectory.h"
+#include "TFileMerger.h"
+#include "TBranch.h"
+#include "Compression.h"
 
 namespace ic {
 
@@ -76,4 +81,109 @@ namespace ic {
     }
   }
 
+  std::vector<TH1F> HorizontalMorph(TH1F const& low, TH1F const& high,
+                                    double par_low, double par_high,
+                                    std::vector<double> const& pars,
+                                    std::vector<double> const& norms) {
+    int nbins = low.GetNbinsX();
+    std::vector<double> edges(nbins + 1);
+    for (int i = 1; i <= nbins + 1; ++i) {
+      edges[i - 1] = low.GetXaxis()->GetBinLowEdge(i);
+    }
+    bool same_binning = high.GetNbinsX() == nbins;
+    for (int i = 1; same_binning && i <= nbins + 1; ++i) {
+      same_binning = high.GetXaxis()->GetBinLowEdge(i) == edges[i - 1];
+    }
+    if (!same_binning) {
+      throw std::runtime_error("[HorizontalMorph] Templates do not have the same binning");
+    }
+    std::vector<double> contents(nbins);
+    HistMorph morph(edges);
+    for (int i = 1; i <= nbins; ++i) contents[i - 1] = low.GetBinContent(i);
+    morph.AddTemplate(par_low, contents);
+    for (int i = 1; i <= nbins; ++i) contents[i - 1] = high.GetBinContent(i);
+    morph.AddTemplate(par_high, contents);
+    std::vector<double> morphed;
+    morph.Morph(pars, norms, morphed);
+    std::vector<TH1F> result;
+    result.reserve(pars.size());
+    for (unsigned k = 0; k < pars.size(); ++k) {
+      TH1F hist("morphed", "morphed", nbins, edges.data());
+      hist.SetDirectory(0);
+      for (int i = 1; i <= nbins; ++i) hist.SetBinContent(i, morphed[k * nbins + i - 1]);
+      result.push_back(hist);
+    }
+    return result;
+  }
+
+  void AutoSaveDirectory(TDirectory *dir, TObject const* stamp) {
+    TIter next(dir->GetList());
+    while (TObject *obj = next()) {
+      if (TDirectory *subdir = dynamic_cast<TDirectory*>(obj)) {
+        AutoSaveDirectory(subdir);
+      } else if (TTree *tree = dynamic_cast<TTree*>(obj)) {
+        tree->SetAutoSave(0);
+        tree->AutoSave("SaveSelf");
+      } else {
+        dir->WriteTObject(obj);
+      }
+    }
+    if (stamp) dir->WriteTObject(stamp, stamp->GetName());
+    // Commit the key list with the new cycles before the old ones are
+    // deleted, then commit it again without them
+    dir->SaveSelf(kTRUE);
+    dir->Purge();
+    dir->SaveSelf(kTRUE);
+  }
+
+  bool MergeFiles(std::vector<std::string> const& inputs, std::string const& output) {
+    TFileMerger merger(false);
+    merger.SetPrintLevel(0);
+    if (!merger.OutputFile(output.c_str(), "RECREATE")) return false;
+    for (auto const& input : inputs) {
+      if (!merger.AddFile(input.c_str(), false)) return false;
+    }
+    return merger.Merge();
+  }
+
+  void ConfigureOutputTrees(TDirectory *dir, Json::Value const& cfg) {
+    TIter next(dir->GetList());
+    while (TObject *obj = next()) {
+      if (TDirectory *subdir = dynamic_cast<TDirectory*>(obj)) {
+        ConfigureOutputTrees(subdir, cfg);
+        continue;
+      }
+      TTree *tree = dynamic_cast<TTree*>(obj);
+      if (!tree) continue;
+      Json::Value const& tree_cfg =
+          cfg.isMember(tree->GetName()) ? cfg[tree->GetName()] : cfg["*"];
+      if (tree_cfg.isNull()) continue;
+      if (tree_cfg.isMember("compression_algorithm") ||
+          tree_cfg.isMember("compression_level")) {
+        std::string algo = tree_cfg.get("compression_algorithm", "ZLIB").asString();
+        int level = tree_cfg.get("compression_level", 1).asInt();
+        ROOT::ECompressionAlgorithm algo_enum = ROOT::kZLIB;
+        if (algo == "LZMA") {
+          algo_enum = ROOT::kLZMA;
+        } else if (algo == "LZ4") {
+          algo_enum = ROOT::kLZ4;
+        } else if (algo != "ZLIB") {
+          throw std::runtime_error("Unknown compression_algorithm " + algo +
+                                   " for tree " + tree->GetName());
+        }
+        int settings = ROOT::CompressionSettings(algo_enum, level);
+        TObjArray *branches = tree->GetListOfBranches();
+        for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+          static_cast<TBranch*>(branches->At(i))->SetCompressionSettings(settings);
+        }
+      }
+      if (tree_cfg.isMember("basket_size")) {
+        tree->SetBasketSize("*", tree_cfg["basket_size"].asInt());
+      }
+      if (tree_cfg.isMember("auto_flush")) {
+        tree->SetAutoFlush(tree_cfg["auto_flush"].asInt64());
+      }
+    }
+  }
+
 } //namespace
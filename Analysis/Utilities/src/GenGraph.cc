@@ -0,0 +1,240 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/GenGraph.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include "UserCode/ICHiggsTauTau/Analysis/Core/interface/TreeEvent.h"
+
+namespace ic {
+
+  GenGraph::GenGraph() {
+  }
+
+  GenGraph::GenGraph(std::vector<GenParticle *> const& parts) {
+    Build(parts);
+  }
+
+  void GenGraph::Build(std::vector<GenParticle *> const& parts) {
+    parts_ = parts;
+    unsigned n = parts_.size();
+    int max_index = -1;
+    for (unsigned i = 0; i < n; ++i) max_index = std::max(max_index, parts_[i]->index());
+    pos_of_index_.assign(max_index + 1, -1);
+    abs_pdgid_.resize(n);
+    by_pdgid_.resize(n);
+    for (unsigned i = 0; i < n; ++i) {
+      if (parts_[i]->index() >= 0) pos_of_index_[parts_[i]->index()] = i;
+      abs_pdgid_[i] = std::abs(parts_[i]->pdgid());
+      by_pdgid_[i] = std::make_pair(abs_pdgid_[i], i);
+    }
+    std::sort(by_pdgid_.begin(), by_pdgid_.end());
+
+    d_begin_.assign(1, 0);
+    d_pos_.clear();
+    m_begin_.assign(1, 0);
+    m_pos_.clear();
+    for (unsigned i = 0; i < n; ++i) {
+      Link(parts_[i]->daughters(), d_begin_, d_pos_);
+      Link(parts_[i]->mothers(), m_begin_, m_pos_);
+    }
+
+    stable_.assign(n, std::vector<GenParticle *>());
+    stable_done_.assign(n, false);
+    tau_jets_.assign(4, std::vector<GenJet>());
+    tau_jets_done_.assign(4, false);
+  }
+
+  void GenGraph::Link(std::vector<int> const& indices,
+                      std::vector<unsigned> & begin,
+                      std::vector<unsigned> & pos) {
+    std::size_t first = pos.size();
+    for (unsigned k = 0; k < indices.size(); ++k) {
+      int idx = indices[k];
+      if (idx < 0 || idx >= int(pos_of_index_.size()) || pos_of_index_[idx] < 0) continue;
+      pos.push_back(pos_of_index_[idx]);
+    }
+    // Input order, without duplicates
+    std::sort(pos.begin() + first, pos.end());
+    pos.erase(std::unique(pos.begin() + first, pos.end()), pos.end());
+    begin.push_back(pos.size());
+  }
+
+  GenGraph const& GenGraph::Get(TreeEvent * event, std::string const& label) {
+    std::string name = "genGraph_" + label;
+    if (!event->Exists(name)) {
+      event->Add(name, GenGraph());
+      event->Get<GenGraph>(name).Build(event->GetConstPtrVec<GenParticle>(label));
+    }
+    return event->Get<GenGraph>(name);
+  }
+
+  int GenGraph::Position(GenParticle const* part) const {
+    int idx = part->index();
+    if (idx < 0 || idx >= int(pos_of_index_.size())) return -1;
+    int i = pos_of_index_[idx];
+    return (i >= 0 && parts_[i] == part) ? i : -1;
+  }
+
+  unsigned GenGraph::PositionOrThrow(GenParticle const* part) const {
+    int i = Position(part);
+    if (i < 0) {
+      throw std::runtime_error(
+          "[GenGraph] Particle is not part of the collection the graph was built from");
+    }
+    return i;
+  }
+
+  std::vector<GenParticle *> GenGraph::ToParticles(unsigned const* first,
+                                                   unsigned const* last) const {
+    std::vector<GenParticle *> result;
+    result.reserve(last - first);
+    for (; first != last; ++first) result.push_back(parts_[*first]);
+    return result;
+  }
+
+  std::vector<GenParticle *> GenGraph::Daughters(GenParticle const* part) const {
+    unsigned i = PositionOrThrow(part);
+    return ToParticles(d_pos_.data() + d_begin_[i], d_pos_.data() + d_begin_[i + 1]);
+  }
+
+  std::vector<GenParticle *> GenGraph::Mothers(GenParticle const* part) const {
+    unsigned i = PositionOrThrow(part);
+    return ToParticles(m_pos_.data() + m_begin_[i], m_pos_.data() + m_begin_[i + 1]);
+  }
+
+  std::vector<GenParticle *> GenGraph::DaughtersRecursive(GenParticle const* part) const {
+    std::vector<bool> seen(parts_.size(), false);
+    std::vector<unsigned> stack(1, PositionOrThrow(part));
+    while (!stack.empty()) {
+      unsigned i = stack.back();
+      stack.pop_back();
+      for (unsigned k = d_begin_[i]; k < d_begin_[i + 1]; ++k) {
+        if (seen[d_pos_[k]]) continue;
+        seen[d_pos_[k]] = true;
+        stack.push_back(d_pos_[k]);
+      }
+    }
+    std::vector<GenParticle *> result;
+    for (unsigned i = 0; i < parts_.size(); ++i) {
+      if (seen[i]) result.push_back(parts_[i]);
+    }
+    return result;
+  }
+
+  std::vector<GenParticle *> const& GenGraph::StableDaughters(GenParticle const* part) const {
+    unsigned pos = PositionOrThrow(part);
+    if (stable_done_[pos]) return stable_[pos];
+    std::vector<bool> seen(parts_.size(), false);
+    std::vector<bool> stable(parts_.size(), false);
+    std::vector<unsigned> stack(d_pos_.begin() + d_begin_[pos], d_pos_.begin() + d_begin_[pos + 1]);
+    while (!stack.empty()) {
+      unsigned i = stack.back();
+      stack.pop_back();
+      if (seen[i]) continue;
+      seen[i] = true;
+      if (parts_[i]->status() == 1) {
+        stable[i] = true;
+        continue;
+      }
+      for (unsigned k = d_begin_[i]; k < d_begin_[i + 1]; ++k) stack.push_back(d_pos_[k]);
+    }
+    for (unsigned i = 0; i < parts_.size(); ++i) {
+      if (stable[i]) stable_[pos].push_back(parts_[i]);
+    }
+    stable_done_[pos] = true;
+    return stable_[pos];
+  }
+
+  std::vector<GenParticle *> GenGraph::VisibleTauDecayProducts(GenParticle const* tau) const {
+    std::vector<GenParticle *> result = StableDaughters(tau);
+    result.erase(std::remove_if(result.begin(), result.end(), [](GenParticle const* p) {
+      int id = std::abs(p->pdgid());
+      return id == 12 || id == 14 || id == 16;
+    }), result.end());
+    return result;
+  }
+
+  std::vector<GenParticle *> GenGraph::WithAbsPdgId(std::vector<unsigned> const& abs_pdgids) const {
+    std::vector<unsigned> pos;
+    for (unsigned k = 0; k < abs_pdgids.size(); ++k) {
+      auto range = std::equal_range(by_pdgid_.begin(), by_pdgid_.end(),
+          std::make_pair(abs_pdgids[k], 0u),
+          [](std::pair<unsigned, unsigned> const& a, std::pair<unsigned, unsigned> const& b) {
+            return a.first < b.first;
+          });
+      for (auto it = range.first; it != range.second; ++it) pos.push_back(it->second);
+    }
+    std::sort(pos.begin(), pos.end());
+    pos.erase(std::unique(pos.begin(), pos.end()), pos.end());
+    return ToParticles(pos.data(), pos.data() + pos.size());
+  }
+
+  GenParticle * GenGraph::FirstCopy(GenParticle const* part) const {
+    unsigned i = PositionOrThrow(part);
+    // The step limit protects against loops in malformed histories
+    for (unsigned step = 0; step < parts_.size(); ++step) {
+      unsigned next = i;
+      for (unsigned k = m_begin_[i]; k < m_begin_[i + 1]; ++k) {
+        if (parts_[m_pos_[k]]->pdgid() == parts_[i]->pdgid()) {
+          next = m_pos_[k];
+          break;
+        }
+      }
+      if (next == i) break;
+      i = next;
+    }
+    return parts_[i];
+  }
+
+  GenParticle * GenGraph::LastCopy(GenParticle const* part) const {
+    unsigned i = PositionOrThrow(part);
+    for (unsigned step = 0; step < parts_.size(); ++step) {
+      unsigned next = i;
+      for (unsigned k = d_begin_[i]; k < d_begin_[i + 1]; ++k) {
+        if (parts_[d_pos_[k]]->pdgid() == parts_[i]->pdgid()) {
+          next = d_pos_[k];
+          break;
+        }
+      }
+      if (next == i) break;
+      i = next;
+    }
+    return parts_[i];
+  }
+
+  std::vector<GenJet> const& GenGraph::TauJets(bool include_leptonic, bool use_prompt) const {
+    unsigned slot = 2 * include_leptonic + use_prompt;
+    if (tau_jets_done_[slot]) return tau_jets_[slot];
+    std::vector<GenJet> & taus = tau_jets_[slot];
+    auto range = std::equal_range(by_pdgid_.begin(), by_pdgid_.end(),
+        std::make_pair(15u, 0u),
+        [](std::pair<unsigned, unsigned> const& a, std::pair<unsigned, unsigned> const& b) {
+          return a.first < b.first;
+        });
+    for (auto it = range.first; it != range.second; ++it) {
+      unsigned i = it->second;
+      if (use_prompt && !parts_[i]->statusFlags()[IsPrompt]) continue;
+      bool has_tau_daughter = false;
+      bool has_lepton_daughter = false;
+      for (unsigned k = d_begin_[i]; k < d_begin_[i + 1]; ++k) {
+        unsigned id = abs_pdgid_[d_pos_[k]];
+        if (id == 15) has_tau_daughter = true;
+        if (id == 11 || id == 13) has_lepton_daughter = true;
+      }
+      if (has_tau_daughter) continue;
+      if (has_lepton_daughter && !include_leptonic) continue;
+      std::vector<GenParticle *> jet_parts = VisibleTauDecayProducts(parts_[i]);
+      taus.push_back(GenJet());
+      ROOT::Math::PtEtaPhiEVector vec;
+      std::vector<std::size_t> id_vec;
+      for (unsigned k = 0; k < jet_parts.size(); ++k) {
+        vec += jet_parts[k]->vector();
+        taus.back().set_charge(taus.back().charge() + jet_parts[k]->charge());
+        id_vec.push_back(jet_parts[k]->id());
+      }
+      taus.back().set_vector(vec);
+      taus.back().set_constituents(id_vec);
+    }
+    tau_jets_done_[slot] = true;
+    return taus;
+  }
+}
@@ -0,0 +1,197 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/HistMorph.h"
+#include <algorithm>
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+
+namespace ic {
+
+  HistMorph::HistMorph(std::vector<double> const& edges, unsigned n_variants)
+      : edges_(edges),
+        n_bins_(edges.size() > 0 ? edges.size() - 1 : 0),
+        n_variants_(n_variants),
+        pairs_done_(false) {
+    if (n_bins_ == 0 || n_variants_ == 0) {
+      throw std::runtime_error("[HistMorph] Need at least one bin and one variant");
+    }
+  }
+
+  void HistMorph::AddTemplate(double par, std::vector<double> const& contents) {
+    if (contents.size() != n_variants_ * n_bins_) {
+      throw std::runtime_error("[HistMorph] Template has the wrong number of bins");
+    }
+    unsigned pos = std::upper_bound(pars_.begin(), pars_.end(), par) - pars_.begin();
+    if (pos > 0 && pars_[pos - 1] == par) {
+      throw std::runtime_error("[HistMorph] There is already a template at this parameter value");
+    }
+    std::vector<double> cdf(n_variants_ * (n_bins_ + 1));
+    std::vector<double> totals(n_variants_);
+    for (unsigned v = 0; v < n_variants_; ++v) {
+      double const* c = contents.data() + v * n_bins_;
+      double * s = cdf.data() + v * (n_bins_ + 1);
+      double total = 0.;
+      for (unsigned i = 0; i < n_bins_; ++i) total += c[i];
+      totals[v] = total;
+      // Left empty if there is nothing to normalise, see Morph
+      if (total <= 0.) continue;
+      for (unsigned i = 1; i <= n_bins_; ++i) s[i] = c[i - 1] / total + s[i - 1];
+    }
+    pars_.insert(pars_.begin() + pos, par);
+    cdfs_.insert(cdfs_.begin() + pos, cdf);
+    totals_.insert(totals_.begin() + pos, totals);
+    pairs_done_ = false;
+  }
+
+  void HistMorph::MergePair(unsigned lo, unsigned variant, Quantiles & q) const {
+    q.x1.clear();
+    q.x2.clear();
+    q.y.clear();
+    q.empty = totals_[lo][variant] <= 0. || totals_[lo + 1][variant] <= 0.;
+    if (q.empty) return;
+    double const* s1 = cdfs_[lo].data() + variant * (n_bins_ + 1);
+    double const* s2 = cdfs_[lo + 1].data() + variant * (n_bins_ + 1);
+    double const* e = edges_.data();
+    int nb = n_bins_;
+
+    // The last edges before each cdf becomes flat, and the first before it
+    // starts to rise
+    int ix1l = nb;
+    int ix2l = nb;
+    while (s1[ix1l - 1] >= s1[ix1l]) --ix1l;
+    while (s2[ix2l - 1] >= s2[ix2l]) --ix2l;
+    int ix1 = -1;
+    do { ++ix1; } while (s1[ix1 + 1] <= s1[0]);
+    int ix2 = -1;
+    do { ++ix2; } while (s2[ix2 + 1] <= s2[0]);
+
+    q.x1.push_back(e[ix1]);
+    q.x2.push_back(e[ix2]);
+    q.y.push_back(0.);
+
+    // Step through the edges of both cdfs in order of increasing
+    // probability, finding where the other cdf reaches the same value
+    double yprev = -1.;
+    while (ix1 < ix1l || ix2 < ix2l) {
+      double x1 = 0., x2 = 0., y = 0.;
+      if (ix1 < ix1l && (ix2 == ix2l || s1[ix1 + 1] <= s2[ix2 + 1])) {
+        ++ix1;
+        while (ix1 < ix1l && s1[ix1 + 1] <= s1[ix1]) ++ix1;
+        x1 = e[ix1];
+        y = s1[ix1];
+        // Past the last edge the other cdf is flat
+        double y20 = s2[ix2];
+        double y21 = ix2 < ix2l ? s2[ix2 + 1] : y20;
+        x2 = (y21 > y20) ? e[ix2] + (e[ix2 + 1] - e[ix2]) * (y - y20) / (y21 - y20)
+                         : e[ix2];
+      } else {
+        ++ix2;
+        while (ix2 < ix2l && s2[ix2 + 1] <= s2[ix2]) ++ix2;
+        x2 = e[ix2];
+        y = s2[ix2];
+        double y10 = s1[ix1];
+        double y11 = ix1 < ix1l ? s1[ix1 + 1] : y10;
+        x1 = (y11 > y10) ? e[ix1] + (e[ix1 + 1] - e[ix1]) * (y - y10) / (y11 - y10)
+                         : e[ix1];
+      }
+      if (y > yprev) {
+        yprev = y;
+        q.x1.push_back(x1);
+        q.x2.push_back(x2);
+        q.y.push_back(y);
+      }
+    }
+  }
+
+  void HistMorph::Project(Quantiles const& q, double wt1, double wt2, double norm,
+                          std::vector<double> & xdis, std::vector<double> & sigdis,
+                          double * out) const {
+    if (q.empty) {
+      std::fill(out, out + n_bins_, 0.);
+      return;
+    }
+    int n = q.y.size();
+    int nb = n_bins_;
+    double const* e = edges_.data();
+    xdis.resize(n);
+    double const* x1 = q.x1.data();
+    double const* x2 = q.x2.data();
+    double * xd = xdis.data();
+    for (int k = 0; k < n; ++k) xd[k] = wt1 * x1[k] + wt2 * x2[k];
+    double const* yd = q.y.data();
+    sigdis.resize(nb + 1);
+    double * f = sigdis.data();
+
+    // The edges beyond the last point of the morphed cdf, then those before
+    // the first
+    int ix = nb;
+    while (ix >= 0 && e[ix] >= xd[n - 1]) {
+      f[ix] = yd[n - 1];
+      --ix;
+    }
+    int ixl = ix + 1;
+    ix = 0;
+    while (ix < nb && e[ix + 1] <= xd[0]) {
+      f[ix] = yd[0];
+      ++ix;
+    }
+    int ixf = ix;
+
+    int ix3 = 0;
+    for (ix = ixf; ix < ixl; ++ix) {
+      double x = e[ix];
+      double y = 0.;
+      if (x >= xd[0]) {
+        while (ix3 + 1 < n - 1 && xd[ix3 + 1] <= x) ++ix3;
+        if (xd[ix3 + 1] - x > 1.1 * (e[ix + 1] - e[ix])) {
+          // Empty bins
+          y = yd[ix3 + 1];
+        } else if (xd[ix3 + 1] > xd[ix3]) {
+          y = yd[ix3] + (yd[ix3 + 1] - yd[ix3]) * (x - xd[ix3]) / (xd[ix3 + 1] - xd[ix3]);
+        }
+      }
+      f[ix] = y;
+    }
+    for (ix = 0; ix < nb; ++ix) out[ix] = (f[ix + 1] - f[ix]) * norm;
+  }
+
+  void HistMorph::Morph(std::vector<double> const& pars,
+                        std::vector<double> const& norms,
+                        std::vector<double> & result) {
+    if (pars_.size() < 2) {
+      throw std::runtime_error("[HistMorph] Need at least two templates");
+    }
+    if (!norms.empty() && norms.size() != pars.size() * n_variants_) {
+      throw std::runtime_error("[HistMorph] Need one norm per target and variant");
+    }
+    if (!pairs_done_) {
+      pairs_.resize((pars_.size() - 1) * n_variants_);
+      for (unsigned j = 0; j + 1 < pars_.size(); ++j) {
+        for (unsigned v = 0; v < n_variants_; ++v) {
+          MergePair(j, v, pairs_[j * n_variants_ + v]);
+        }
+      }
+      pairs_done_ = true;
+    }
+    result.resize(pars.size() * n_variants_ * n_bins_);
+    std::vector<double> xdis, sigdis;
+    for (unsigned t = 0; t < pars.size(); ++t) {
+      double par = pars[t];
+      unsigned lo = std::upper_bound(pars_.begin(), pars_.end(), par) - pars_.begin();
+      lo = std::min<unsigned>(std::max<unsigned>(lo, 1), pars_.size() - 1) - 1;
+      double par1 = pars_[lo];
+      double par2 = pars_[lo + 1];
+      double wt1 = 1. - (par - par1) / (par2 - par1);
+      double wt2 = 1. + (par - par2) / (par2 - par1);
+      if (wt1 < 0. || wt1 > 1. || wt2 < 0. || wt2 > 1.) {
+        std::cout << "Warning! HistMorph: " << par << " is an extrapolation from "
+                  << par1 << " and " << par2 << std::endl;
+      }
+      for (unsigned v = 0; v < n_variants_; ++v) {
+        double norm = norms.empty() ? wt1 * totals_[lo][v] + wt2 * totals_[lo + 1][v]
+                                    : norms[t * n_variants_ + v];
+        Project(pairs_[lo * n_variants_ + v], wt1, wt2, norm, xdis, sigdis,
+                result.data() + (t * n_variants_ + v) * n_bins_);
+      }
+    }
+  }
+}
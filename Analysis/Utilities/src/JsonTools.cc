@@ -3,6 +3,10 @@
 #include <fstream>
 #include <string>
 #include <ctype.h>
+#include <map>
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h>
 #include "boost/algorithm/string.hpp"
 #include "boost/lexical_cast.hpp"
 
@@ -154,4 +158,248 @@ Json::Value MergedJson(std::vector<std::string> const& vec) {
   }
   return res;
 }
+
+void ValidateJson(Json::Value const& val, Json::Value const& schema,
+                  std::string const& path, std::vector<std::string>& errors,
+                  std::vector<std::string>& warnings) {
+  if (val.isNull()) return;
+  if (schema.isObject()) {
+    if (!val.isObject()) {
+      errors.push_back(path + ": expected an object");
+      return;
+    }
+    for (auto const& key : val.getMemberNames()) {
+      std::string key_path = path + "/" + key;
+      if (schema.isMember(key)) {
+        ValidateJson(val[key], schema[key], key_path, errors, warnings);
+        continue;
+      }
+      bool ignored = false;
+      for (auto const& k : schema["_ignored"]) ignored = ignored || k.asString() == key;
+      if (ignored) {
+        warnings.push_back(key_path + ": not used");
+      } else if (schema.isMember("*")) {
+        ValidateJson(val[key], schema["*"], key_path, errors, warnings);
+      } else {
+        errors.push_back(key_path + ": unknown key");
+      }
+    }
+    return;
+  }
+  static const std::map<std::string, Json::ValueType> types = {
+    {"bool", Json::booleanValue}, {"int", Json::intValue},
+    {"uint", Json::uintValue},    {"double", Json::realValue},
+    {"string", Json::stringValue}, {"array", Json::arrayValue},
+    {"object", Json::objectValue}};
+  std::string type = schema.asString();
+  if (type == "any") return;
+  auto it = types.find(type);
+  if (it == types.end()) {
+    errors.push_back(path + ": schema has unknown type \"" + type + "\"");
+  } else if (!val.isConvertibleTo(it->second)) {
+    std::string found = boost::algorithm::trim_copy(val.toStyledString());
+    errors.push_back(path + ": expected " + type + ", found " + found.substr(0, 40));
+  }
+}
+
+namespace {
+  // Layout of the binary format: the magic string, the string table
+  // (count, then length and bytes of each) and then the value tree, each
+  // value being a one byte tag followed by its content
+  const char json_binary_magic[8] = {'I', 'C', 'J', 'S', 'O', 'N', 'B', '1'};
+  enum JsonBinaryTag : uint8_t {
+    kNull, kFalse, kTrue, kInt, kUInt, kReal, kString, kArray, kObject
+  };
+
+  class JsonBinaryWriter {
+   public:
+    std::vector<std::string> strings;
+    std::string data;
+
+    void Write(Json::Value const& val) {
+      switch (val.type()) {
+        case Json::nullValue:
+          Put<uint8_t>(kNull);
+          break;
+        case Json::booleanValue:
+          Put<uint8_t>(val.asBool() ? kTrue : kFalse);
+          break;
+        case Json::intValue:
+          Put<uint8_t>(kInt);
+          Put<int64_t>(val.asLargestInt());
+          break;
+        case Json::uintValue:
+          Put<uint8_t>(kUInt);
+          Put<uint64_t>(val.asLargestUInt());
+          break;
+        case Json::realValue:
+          Put<uint8_t>(kReal);
+          Put<double>(val.asDouble());
+          break;
+        case Json::stringValue:
+          Put<uint8_t>(kString);
+          Put<uint32_t>(Intern(val.asString()));
+          break;
+        case Json::arrayValue:
+          Put<uint8_t>(kArray);
+          Put<uint32_t>(val.size());
+          for (unsigned i = 0; i < val.size(); ++i) Write(val[i]);
+          break;
+        case Json::objectValue: {
+          Put<uint8_t>(kObject);
+          std::vector<std::string> keys = val.getMemberNames();
+          Put<uint32_t>(keys.size());
+          for (auto const& key : keys) {
+            Put<uint32_t>(Intern(key));
+            Write(val[key]);
+          }
+          break;
+        }
+      }
+    }
+
+   private:
+    std::map<std::string, uint32_t> index_;
+
+    template <class T>
+    void Put(T x) {
+      data.append(reinterpret_cast<char const*>(&x), sizeof(T));
+    }
+
+    uint32_t Intern(std::string const& str) {
+      auto it = index_.find(str);
+      if (it != index_.end()) return it->second;
+      index_[str] = strings.size();
+      strings.push_back(str);
+      return strings.size() - 1;
+    }
+  };
+
+  class JsonBinaryReader {
+   public:
+    JsonBinaryReader(std::string const& data, std::string const& file)
+        : data_(data), file_(file), pos_(0) {}
+
+    Json::Value ReadFile() {
+      if (data_.size() < sizeof(json_binary_magic) ||
+          std::memcmp(data_.data(), json_binary_magic, sizeof(json_binary_magic)) != 0) {
+        Fail("not a binary json file");
+      }
+      pos_ = sizeof(json_binary_magic);
+      uint32_t n_strings = Get<uint32_t>();
+      strings_.reserve(n_strings);
+      for (uint32_t i = 0; i < n_strings; ++i) {
+        uint32_t len = Get<uint32_t>();
+        Need(len);
+        strings_.push_back(data_.substr(pos_, len));
+        pos_ += len;
+      }
+      Json::Value res;
+      Read(res);
+      return res;
+    }
+
+   private:
+    std::string const& data_;
+    std::string const& file_;
+    std::size_t pos_;
+    std::vector<std::string> strings_;
+
+    void Fail(std::string const& what) const {
+      throw std::runtime_error("[ExtractJsonFromBinaryFile] " + file_ + ": " + what);
+    }
+
+    void Need(std::size_t n) const {
+      if (pos_ + n > data_.size()) Fail("unexpected end of file");
+    }
+
+    template <class T>
+    T Get() {
+      Need(sizeof(T));
+      T x;
+      std::memcpy(&x, data_.data() + pos_, sizeof(T));
+      pos_ += sizeof(T);
+      return x;
+    }
+
+    std::string const& String() {
+      uint32_t i = Get<uint32_t>();
+      if (i >= strings_.size()) Fail("bad string index");
+      return strings_[i];
+    }
+
+    // Fills val in place, so nested values are never copied
+    void Read(Json::Value& val) {
+      switch (Get<uint8_t>()) {
+        case kNull:
+          val = Json::Value();
+          break;
+        case kFalse:
+          val = false;
+          break;
+        case kTrue:
+          val = true;
+          break;
+        case kInt:
+          val = Json::Value(Json::Value::LargestInt(Get<int64_t>()));
+          break;
+        case kUInt:
+          val = Json::Value(Json::Value::LargestUInt(Get<uint64_t>()));
+          break;
+        case kReal:
+          val = Get<double>();
+          break;
+        case kString:
+          val = String();
+          break;
+        case kArray: {
+          uint32_t n = Get<uint32_t>();
+          val = Json::Value(Json::arrayValue);
+          if (n > 0) val.resize(n);
+          for (uint32_t i = 0; i < n; ++i) Read(val[i]);
+          break;
+        }
+        case kObject: {
+          uint32_t n = Get<uint32_t>();
+          val = Json::Value(Json::objectValue);
+          for (uint32_t i = 0; i < n; ++i) Read(val[String()]);
+          break;
+        }
+        default:
+          Fail("bad value tag");
+      }
+    }
+  };
+}
+
+void WriteJsonToBinaryFile(Json::Value const& val, std::string const& file) {
+  JsonBinaryWriter writer;
+  writer.Write(val);
+  std::ofstream output(file, std::ios::binary);
+  if (!output.is_open()) {
+    throw std::runtime_error("[WriteJsonToBinaryFile] Unable to open file " + file);
+  }
+  output.write(json_binary_magic, sizeof(json_binary_magic));
+  uint32_t n_strings = writer.strings.size();
+  output.write(reinterpret_cast<char const*>(&n_strings), sizeof(n_strings));
+  for (auto const& str : writer.strings) {
+    uint32_t len = str.size();
+    output.write(reinterpret_cast<char const*>(&len), sizeof(len));
+    output.write(str.data(), len);
+  }
+  output.write(writer.data.data(), writer.data.size());
+  if (!output.good()) {
+    throw std::runtime_error("[WriteJsonToBinaryFile] Error writing file " + file);
+  }
+}
+
+Json::Value ExtractJsonFromBinaryFile(std::string const& file) {
+  std::ifstream input(file, std::ios::binary);
+  if (!input.is_open()) {
+    throw std::runtime_error("[ExtractJsonFromBinaryFile] Unable to open file " + file);
+  }
+  std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  JsonBinaryReader reader(data, file);
+  return reader.ReadFile();
+}
 }
@@ -0,0 +1,83 @@
+#include "Utilities/interface/LumiRanges.h"
+#include <algorithm>
+#include <stdexcept>
+#include "boost/lexical_cast.hpp"
+
+namespace ic {
+
+LumiRanges::LumiRanges()
+    : last_run_(0), last_lumi_(0), last_result_(false), last_valid_(false) {
+  begin_.push_back(0);
+}
+
+void LumiRanges::Add(unsigned run, unsigned first, unsigned last) {
+  added_.push_back(std::make_pair(run, Range(first, last)));
+  Compile();
+}
+
+void LumiRanges::AddJson(Json::Value const& js) {
+  for (auto const& key : js.getMemberNames()) {
+    Json::Value const& run_js = js[key];
+    unsigned run = boost::lexical_cast<unsigned>(key);
+    for (unsigned i = 0; i < run_js.size(); ++i) {
+      if (run_js[i].size() != 2) {
+        throw std::runtime_error(
+            "[LumiRanges] Lumi range not in the form [X,Y]");
+      }
+      unsigned range_min = run_js[i][0].asUInt();
+      unsigned range_max = run_js[i][1].asUInt();
+      if (range_max < range_min) {
+        throw std::runtime_error(
+            "[LumiRanges] Have lumi range [X,Y] where Y < X");
+      }
+      added_.push_back(std::make_pair(run, Range(range_min, range_max)));
+    }
+  }
+  Compile();
+}
+
+void LumiRanges::Compile() {
+  std::sort(added_.begin(), added_.end());
+  runs_.clear();
+  begin_.clear();
+  ranges_.clear();
+  for (auto const& r : added_) {
+    if (runs_.empty() || runs_.back() != r.first) {
+      runs_.push_back(r.first);
+      begin_.push_back(ranges_.size());
+      ranges_.push_back(r.second);
+    } else if (r.second.first <= ranges_.back().second + 1) {
+      // Overlapping or adjacent to the previous range of this run
+      ranges_.back().second = std::max(ranges_.back().second, r.second.second);
+    } else {
+      ranges_.push_back(r.second);
+    }
+  }
+  begin_.push_back(ranges_.size());
+  last_valid_ = false;
+}
+
+bool LumiRanges::Contains(unsigned run, unsigned lumi) const {
+  if (last_valid_ && run == last_run_ && lumi == last_lumi_) return last_result_;
+  bool result = false;
+  auto run_it = std::lower_bound(runs_.begin(), runs_.end(), run);
+  if (run_it != runs_.end() && *run_it == run) {
+    unsigned i = run_it - runs_.begin();
+    auto first = ranges_.begin() + begin_[i];
+    auto last = ranges_.begin() + begin_[i + 1];
+    // The first range that ends at or after lumi
+    auto it = std::lower_bound(first, last, lumi,
+        [](Range const& r, unsigned l) { return r.second < l; });
+    result = it != last && it->first <= lumi;
+  }
+  last_run_ = run;
+  last_lumi_ = lumi;
+  last_result_ = result;
+  last_valid_ = true;
+  return result;
+}
+
+bool LumiRanges::ContainsRun(unsigned run) const {
+  return std::binary_search(runs_.begin(), runs_.end(), run);
+}
+}
@@ -0,0 +1,140 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/MVAReader.h"
+#include <iostream>
+#include <cmath>
+#include "TMVA/Reader.h"
+
+namespace ic {
+
+  namespace {
+    // The expression TMVA compares against the weight file: the part after
+    // ":=" if a label is given, without whitespace
+    std::string Expression(std::string const& in) {
+      std::string expr = in;
+      std::size_t def = expr.find(":=");
+      if (def != expr.npos) expr = expr.substr(def + 2);
+      std::string out;
+      for (char c : expr) {
+        if (c != ' ' && c != '\t') out += c;
+      }
+      return out;
+    }
+  }
+
+  MVAReader::MVAReader(std::string const& options)
+      : options_(options), tmva_(nullptr), validate_(0) {
+  }
+
+  MVAReader::~MVAReader() {
+    if (tmva_) delete tmva_;
+  }
+
+  void MVAReader::AddVariable(std::string const& expression, float * var) {
+    var_names_.push_back(expression);
+    var_ptrs_.push_back(var);
+  }
+
+  void MVAReader::AddSpectator(std::string const& expression, float * var) {
+    spec_names_.push_back(expression);
+    spec_ptrs_.push_back(var);
+  }
+
+  TMVA::Reader * MVAReader::TMVAReader() {
+    if (!tmva_) {
+      tmva_ = new TMVA::Reader(options_.c_str());
+      for (unsigned i = 0; i < var_names_.size(); ++i) {
+        tmva_->AddVariable(var_names_[i].c_str(), var_ptrs_[i]);
+      }
+      for (unsigned i = 0; i < spec_names_.size(); ++i) {
+        tmva_->AddSpectator(spec_names_[i].c_str(), spec_ptrs_[i]);
+      }
+    }
+    return tmva_;
+  }
+
+  bool MVAReader::BookMVA(std::string const& method, std::string const& weight_file) {
+    Method & m = methods_[method];
+    m.file = weight_file;
+    m.n_validated = 0;
+    m.max_diff = 0.;
+    m.compiled = m.bdt.Load(weight_file);
+    if (m.compiled) {
+      std::vector<std::string> const& expected = m.bdt.variables();
+      bool match = expected.size() == var_names_.size();
+      for (unsigned i = 0; match && i < expected.size(); ++i) {
+        match = Expression(expected[i]) == Expression(var_names_[i]);
+      }
+      if (!match) {
+        std::cerr << "[MVAReader] Variables declared for " << method
+                  << " do not match " << weight_file << ", using TMVA" << std::endl;
+        m.compiled = false;
+      }
+    }
+    if (!m.compiled || validate_ > 0) {
+      TMVAReader()->BookMVA(method.c_str(), weight_file.c_str());
+    }
+    std::cout << "[MVAReader] " << method << " from " << weight_file << ": ";
+    if (m.compiled) {
+      std::cout << "compiled, " << m.bdt.n_trees() << " trees, " << m.bdt.n_nodes() << " nodes" << std::endl;
+    } else {
+      std::cout << "evaluated with TMVA" << std::endl;
+    }
+    inputs_.resize(var_ptrs_.size());
+    return m.compiled;
+  }
+
+  MVAReader::Method * MVAReader::FindMethod(std::string const& method) {
+    auto it = methods_.find(method);
+    if (it == methods_.end()) {
+      std::cerr << "[MVAReader] Method " << method << " has not been booked" << std::endl;
+      return nullptr;
+    }
+    return &(it->second);
+  }
+
+  void MVAReader::Validate(std::string const& method, Method & m, std::vector<float> const& x, double value) {
+    double diff = std::fabs(TMVAReader()->EvaluateMVA(x, method.c_str()) - value);
+    if (diff > m.max_diff) m.max_diff = diff;
+    ++m.n_validated;
+    if (m.n_validated == validate_) {
+      std::cout << "[MVAReader] " << method << ": largest difference to TMVA in "
+                << validate_ << " evaluations is " << m.max_diff << std::endl;
+    }
+  }
+
+  double MVAReader::EvaluateMVA(std::string const& method) {
+    Method * m = FindMethod(method);
+    if (!m) return 0.;
+    if (!m->compiled) return TMVAReader()->EvaluateMVA(method.c_str());
+    for (unsigned i = 0; i < var_ptrs_.size(); ++i) inputs_[i] = *(var_ptrs_[i]);
+    double value = m->bdt.Evaluate(inputs_.data());
+    if (m->n_validated < validate_) Validate(method, *m, inputs_, value);
+    return value;
+  }
+
+  void MVAReader::EvaluateBatch(std::string const& method, float const* x, unsigned n, unsigned stride, double * out) {
+    Method * m = FindMethod(method);
+    if (!m) {
+      for (unsigned i = 0; i < n; ++i) out[i] = 0.;
+      return;
+    }
+    if (m->compiled) {
+      m->bdt.EvaluateBatch(x, n, stride, out);
+    }
+    for (unsigned i = 0; i < n; ++i) {
+      if (m->compiled && m->n_validated >= validate_) break;
+      float const* ev = x + std::size_t(i) * stride;
+      std::vector<float> inputs(ev, ev + var_ptrs_.size());
+      if (m->compiled) {
+        Validate(method, *m, inputs, out[i]);
+      } else {
+        out[i] = TMVAReader()->EvaluateMVA(inputs, method.c_str());
+      }
+    }
+  }
+
+  CompiledBDT const* MVAReader::GetCompiled(std::string const& method) const {
+    auto it = methods_.find(method);
+    if (it == methods_.end() || !it->second.compiled) return nullptr;
+    return &(it->second.bdt);
+  }
+}
@@ -1,4 +1,5 @@
 #include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/RecoilCorrectorRun2.h"
+#include <algorithm>
 
 RecoilCorrectorRun2::RecoilCorrectorRun2(TString fileName) {
 
@@ -69,6 +70,7 @@ RecoilCorrectorRun2::RecoilCorrectorRun2(TString fileName) {
   _epsrel = 5e-4;
   _epsabs = 5e-4;
   _range = 0.95;
+  _useTables = true;
 
 }
 
@@ -207,6 +209,11 @@ void RecoilCorrectorRun2::InitMEtWeights(TFile * _fileMet,
       _meanMetZPerpMC[ZPtBin][jetBin] = 0;
       _rmsMetZPerpMC[ZPtBin][jetBin] = TMath::Sqrt(_metZPerpMC[ZPtBin][jetBin]->CentralMoment(2,_xminMetZPerpMC[ZPtBin][jetBin],_xmaxMetZPerpMC[ZPtBin][jetBin]));
 
+      BuildTable(_metZParalData[ZPtBin][jetBin],_xminMetZParalData[ZPtBin][jetBin],_xmaxMetZParalData[ZPtBin][jetBin],_cdfZParalData[ZPtBin][jetBin]);
+      BuildTable(_metZPerpData[ZPtBin][jetBin],_xminMetZPerpData[ZPtBin][jetBin],_xmaxMetZPerpData[ZPtBin][jetBin],_cdfZPerpData[ZPtBin][jetBin]);
+      BuildTable(_metZParalMC[ZPtBin][jetBin],_xminMetZParalMC[ZPtBin][jetBin],_xmaxMetZParalMC[ZPtBin][jetBin],_cdfZParalMC[ZPtBin][jetBin]);
+      BuildTable(_metZPerpMC[ZPtBin][jetBin],_xminMetZPerpMC[ZPtBin][jetBin],_xmaxMetZPerpMC[ZPtBin][jetBin],_cdfZPerpMC[ZPtBin][jetBin]);
+
 
     }
   }
@@ -255,42 +262,9 @@ void RecoilCorrectorRun2::Correct(float MetPx,
 
   int ZptBin = binNumber(Zpt, _ZPtBins);
 
-  
-  TF1 * metZParalData = _metZParalData[ZptBin][njets];
-  TF1 * metZPerpData  = _metZPerpData[ZptBin][njets];
-  
-  #if ROOT_VERSION_CODE > ROOT_VERSION(6,0,0)
-  TF1 * metZParalMC   = _metZParalMC[ZptBin][njets];
-  TF1 * metZPerpMC     = _metZPerpMC[ZptBin][njets];
-  #endif
-  
-  if (U1>_range*_xminMetZParal[ZptBin][njets]&&U1<_range*_xmaxMetZParal[ZptBin][njets]) {
-    
-    int nSumProb = 1;
-    double q[1];
-    double sumProb[1];
-   
-    #if ROOT_VERSION_CODE > ROOT_VERSION(6,0,0) 
-    sumProb[0] = metZParalMC->IntegralOneDim(_xminMetZParalMC[ZptBin][njets],U1,_epsrel,_epsabs,_error);
-    #else
-    sumProb[0] = 0;
-    #endif
-    
-    if (sumProb[0]<0) {
-      //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
-      sumProb[0] = 1e-5;
-    }
-    if (sumProb[0]>1) {
-      //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
-      sumProb[0] = 1.0 - 1e-5;
-    }
-    
-      
-    metZParalData->GetQuantiles(nSumProb,q,sumProb);
 
-    float U1reco = float(q[0]);
-    U1 = U1reco;
-    
+  if (U1>_range*_xminMetZParal[ZptBin][njets]&&U1<_range*_xmaxMetZParal[ZptBin][njets]) {
+    U1 = QuantileMap(U1,ZptBin,njets,true);
   }
   else {
     float U1reco = rescale(U1,
@@ -302,31 +276,7 @@ void RecoilCorrectorRun2::Correct(float MetPx,
   }
 
   if (U2>_range*_xminMetZPerp[ZptBin][njets]&&U2<_range*_xmaxMetZPerp[ZptBin][njets]) {
-    
-    int nSumProb = 1;
-    double q[1];
-    double sumProb[1];
-    
-    #if ROOT_VERSION_CODE > ROOT_VERSION(6,0,0)
-    sumProb[0] = metZPerpMC->IntegralOneDim(_xminMetZPerpMC[ZptBin][njets],U2,_epsrel,_epsabs,_error);
-    #else
-    sumProb[0] = 0;
-    #endif
-    
-    if (sumProb[0]<0) {
-      //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
-      sumProb[0] = 1e-5;
-    }
-    if (sumProb[0]>1) {
-      //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
-      sumProb[0] = 1.0 - 1e-5;
-    }
-    
-    metZPerpData->GetQuantiles(nSumProb,q,sumProb);
-
-    float U2reco = float(q[0]);
-    U2 = U2reco;
-      
+    U2 = QuantileMap(U2,ZptBin,njets,false);
   }
   else {
     float U2reco = rescale(U2,
@@ -421,6 +371,147 @@ float RecoilCorrectorRun2::CorrectionsBySampling(float x, TF1 * funcMC, TF1 * fu
 
 }
 
+float RecoilCorrectorRun2::QuantileMap(float x, int ZptBin, int njets, bool paral) {
+
+  if (!_useTables)
+    return QuantileMapTF1(x,ZptBin,njets,paral);
+
+  CDFTable const& tableMC   = paral ? _cdfZParalMC[ZptBin][njets]   : _cdfZPerpMC[ZptBin][njets];
+  CDFTable const& tableData = paral ? _cdfZParalData[ZptBin][njets] : _cdfZPerpData[ZptBin][njets];
+
+  double sumProb = TableCDF(tableMC,x);
+  if (sumProb<0) sumProb = 1e-5;
+  if (sumProb>1) sumProb = 1.0 - 1e-5;
+
+  return float(TableQuantile(tableData,sumProb));
+
+}
+
+float RecoilCorrectorRun2::QuantileMapTF1(float x, int ZptBin, int njets, bool paral) {
+
+  TF1 * funcData = paral ? _metZParalData[ZptBin][njets] : _metZPerpData[ZptBin][njets];
+
+  int nSumProb = 1;
+  double q[1];
+  double sumProb[1];
+
+  #if ROOT_VERSION_CODE > ROOT_VERSION(6,0,0)
+  TF1 * funcMC = paral ? _metZParalMC[ZptBin][njets] : _metZPerpMC[ZptBin][njets];
+  float xminMC = paral ? _xminMetZParalMC[ZptBin][njets] : _xminMetZPerpMC[ZptBin][njets];
+  sumProb[0] = funcMC->IntegralOneDim(xminMC,x,_epsrel,_epsabs,_error);
+  #else
+  (void)x;
+  sumProb[0] = 0;
+  #endif
+
+  if (sumProb[0]<0) {
+    //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
+    sumProb[0] = 1e-5;
+  }
+  if (sumProb[0]>1) {
+    //	std::cout << "Warning ! ProbSum[0] = " << sumProb[0] << std::endl;
+    sumProb[0] = 1.0 - 1e-5;
+  }
+
+  funcData->GetQuantiles(nSumProb,q,sumProb);
+
+  return float(q[0]);
+
+}
+
+void RecoilCorrectorRun2::BuildTable(TF1 * func, float xmin, float xmax, CDFTable & table) {
+
+  // Simpson's rule in each cell. Negative values of the fitted functions
+  // are treated as zero so that the CDF can be inverted.
+  int n = _nTablePoints;
+  table.xmin = xmin;
+  table.step = (double(xmax) - double(xmin))/n;
+  table.cdf.assign(n+1,0.);
+  table.pdf.assign(n+1,0.);
+  for (int i=0; i<=n; ++i)
+    table.pdf[i] = TMath::Max(0.,func->Eval(table.xmin + i*table.step));
+  for (int i=1; i<=n; ++i) {
+    double mid = TMath::Max(0.,func->Eval(table.xmin + (i-0.5)*table.step));
+    table.cdf[i] = table.cdf[i-1] + table.step*(table.pdf[i-1] + 4*mid + table.pdf[i])/6.;
+  }
+
+}
+
+double RecoilCorrectorRun2::TableCDF(CDFTable const& table, double x) const {
+
+  double t = (x - table.xmin)/table.step;
+  if (t<=0) return 0.;
+  int i = int(t);
+  int n = table.cdf.size() - 1;
+  if (i>=n) return table.cdf[n];
+  double u  = t - i;
+  double u2 = u*u;
+  double u3 = u2*u;
+  return (2*u3 - 3*u2 + 1)*table.cdf[i] + (u3 - 2*u2 + u)*table.step*table.pdf[i]
+       + (-2*u3 + 3*u2)*table.cdf[i+1] + (u3 - u2)*table.step*table.pdf[i+1];
+
+}
+
+double RecoilCorrectorRun2::TableQuantile(CDFTable const& table, double prob) const {
+
+  // Same normalisation as TF1::GetQuantiles: prob is a fraction of the
+  // integral over the full range
+  int n = table.cdf.size() - 1;
+  double target = prob*table.cdf[n];
+  if (table.cdf[n]<=0 || target<=0) return table.xmin;
+  if (target>=table.cdf[n]) return table.xmin + n*table.step;
+
+  int i = int(std::upper_bound(table.cdf.begin(),table.cdf.end(),target) - table.cdf.begin()) - 1;
+  double c0 = table.cdf[i];
+  double c1 = table.cdf[i+1];
+  double m0 = table.step*table.pdf[i];
+  double m1 = table.step*table.pdf[i+1];
+
+  // Linear guess refined with Newton steps on the Hermite cubic
+  double u = (c1>c0) ? (target - c0)/(c1 - c0) : 0.;
+  for (int iter=0; iter<4; ++iter) {
+    double u2 = u*u;
+    double u3 = u2*u;
+    double f  = (2*u3 - 3*u2 + 1)*c0 + (u3 - 2*u2 + u)*m0 + (-2*u3 + 3*u2)*c1 + (u3 - u2)*m1;
+    double df = (6*u2 - 6*u)*c0 + (3*u2 - 4*u + 1)*m0 + (-6*u2 + 6*u)*c1 + (3*u2 - 2*u)*m1;
+    if (df<=0) break;
+    u = TMath::Min(1.,TMath::Max(0.,u - (f - target)/df));
+  }
+  return table.xmin + (i + u)*table.step;
+
+}
+
+void RecoilCorrectorRun2::PrintTableAccuracy(int nPoints) {
+
+  bool useTables = _useTables;
+  std::cout << "Recoil quantile mapping, tables vs TF1 (" << nPoints << " points per bin)" << std::endl;
+  for (int ZptBin=0; ZptBin<_nZPtBins; ++ZptBin) {
+    for (int jetBin=0; jetBin<_nJetsBins; ++jetBin) {
+      std::cout << "  ZPt bin " << ZptBin << ", njets bin " << jetBin << " :";
+      for (int paral=1; paral>=0; --paral) {
+        float xmin = _range*(paral ? _xminMetZParal[ZptBin][jetBin] : _xminMetZPerp[ZptBin][jetBin]);
+        float xmax = _range*(paral ? _xmaxMetZParal[ZptBin][jetBin] : _xmaxMetZPerp[ZptBin][jetBin]);
+        double maxDiff = 0;
+        double sumDiff = 0;
+        for (int i=0; i<nPoints; ++i) {
+          float x = xmin + (i+0.5)*(xmax-xmin)/nPoints;
+          _useTables = true;
+          float table = QuantileMap(x,ZptBin,jetBin,paral);
+          float tf1 = QuantileMapTF1(x,ZptBin,jetBin,paral);
+          double diff = TMath::Abs(table-tf1);
+          maxDiff = TMath::Max(maxDiff,diff);
+          sumDiff += diff;
+        }
+        std::cout << (paral ? "  U1" : "  U2") << " max |dU| = " << maxDiff
+                  << " mean |dU| = " << (nPoints>0 ? sumDiff/nPoints : 0.);
+      }
+      std::cout << std::endl;
+    }
+  }
+  _useTables = useTables;
+
+}
+
 void RecoilCorrectorRun2::U1U2CorrectionsByWidth(float & U1, 
 					     float & U2,
 					     int ZptBin,
@@ -0,0 +1,159 @@
+#include "UserCode/ICHiggsTauTau/Analysis/Utilities/interface/ShapeCache.h"
+#include <iostream>
+#include <cstdio>
+#include "boost/filesystem.hpp"
+#include "boost/lexical_cast.hpp"
+#include "TFile.h"
+#include "TKey.h"
+#include "TList.h"
+#include "TNamed.h"
+
+namespace ic {
+
+  namespace {
+    // 64-bit FNV-1a, used only to give the stored histograms short names.
+    // The full key is stored alongside and checked on every lookup.
+    std::string HashName(std::string const& key) {
+      unsigned long long h = 14695981039346656037ULL;
+      for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ULL;
+      }
+      char buf[20];
+      std::snprintf(buf, sizeof(buf), "h%016llx", h);
+      return std::string(buf);
+    }
+
+    std::string const key_suffix = "_key";
+  }
+
+  ShapeCache::ShapeCache(std::string const& dir) : dir_(dir), hits_(0), misses_(0) {
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(dir_, ec);
+    if (ec) {
+      std::cerr << "[ShapeCache] Warning: unable to create directory " << dir_
+                << ", new shapes will not be stored" << std::endl;
+    }
+  }
+
+  ShapeCache::~ShapeCache() {
+    Flush();
+  }
+
+  std::string ShapeCache::FileStamp(std::string const& filename) {
+    boost::system::error_code ec;
+    boost::filesystem::path path(filename);
+    if (!boost::filesystem::is_regular_file(path, ec)) return "";
+    boost::uintmax_t size = boost::filesystem::file_size(path, ec);
+    if (ec) return "";
+    std::time_t mtime = boost::filesystem::last_write_time(path, ec);
+    if (ec) return "";
+    return boost::filesystem::absolute(path).string() + ":" +
+           boost::lexical_cast<std::string>(size) + ":" +
+           boost::lexical_cast<std::string>(mtime);
+  }
+
+  std::string ShapeCache::MakeKey(std::string const& stamp,
+                                  std::string const& variable,
+                                  std::string const& selection) {
+    return stamp + "\n" + variable + "\n" + selection;
+  }
+
+  std::string ShapeCache::SampleFile(std::string const& sample) const {
+    std::string name = sample;
+    for (char & c : name) {
+      if (c == '/' || c == ':' || c == ' ' || c == '*') c = '_';
+    }
+    return dir_ + "/" + name + ".root";
+  }
+
+  ShapeCache::Entries & ShapeCache::LoadSample(std::string const& sample) {
+    auto it = entries_.find(sample);
+    if (it != entries_.end()) return it->second;
+    Entries & entries = entries_[sample];
+    std::string filename = SampleFile(sample);
+    if (!boost::filesystem::exists(filename)) return entries;
+    bool add_dir = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(false);
+    TFile *file = TFile::Open(filename.c_str());
+    if (!file || file->IsZombie()) {
+      std::cerr << "[ShapeCache] Warning: unable to read " << filename << std::endl;
+    } else {
+      TIter next(file->GetListOfKeys());
+      while (TKey *key = dynamic_cast<TKey*>(next())) {
+        TObject *obj = key->ReadObj();
+        std::string name = key->GetName();
+        if (TH1F *hist = dynamic_cast<TH1F*>(obj)) {
+          TH1F & entry = entries[name].hist;
+          entry = *hist;
+          entry.SetDirectory(0);
+        } else if (TNamed *named = dynamic_cast<TNamed*>(obj)) {
+          if (name.size() > key_suffix.size() &&
+              name.compare(name.size() - key_suffix.size(), key_suffix.size(), key_suffix) == 0) {
+            entries[name.substr(0, name.size() - key_suffix.size())].key = named->GetTitle();
+          }
+        }
+        delete obj;
+      }
+      file->Close();
+    }
+    delete file;
+    TH1::AddDirectory(add_dir);
+    return entries;
+  }
+
+  bool ShapeCache::Get(std::string const& sample, std::string const& key, TH1F & hist) {
+    Entries & entries = LoadSample(sample);
+    auto it = entries.find(HashName(key));
+    if (it == entries.end() || key != it->second.key) {
+      ++misses_;
+      return false;
+    }
+    ++hits_;
+    hist = it->second.hist;
+    hist.SetDirectory(0);
+    return true;
+  }
+
+  void ShapeCache::Put(std::string const& sample, std::string const& key, TH1F const& hist) {
+    Entries & entries = LoadSample(sample);
+    std::string name = HashName(key);
+    Entry & entry = entries[name];
+    entry.key = key;
+    entry.hist = hist;
+    entry.hist.SetDirectory(0);
+    pending_[sample].insert(name);
+  }
+
+  void ShapeCache::Invalidate(std::string const& sample) {
+    entries_[sample].clear();
+    pending_.erase(sample);
+    boost::system::error_code ec;
+    boost::filesystem::remove(SampleFile(sample), ec);
+  }
+
+  int ShapeCache::Flush() {
+    int n_failed = 0;
+    for (auto const& pending : pending_) {
+      std::string filename = SampleFile(pending.first);
+      TFile *file = TFile::Open(filename.c_str(), "UPDATE");
+      if (!file || file->IsZombie()) {
+        std::cerr << "[ShapeCache] Warning: unable to write " << filename << std::endl;
+        delete file;
+        ++n_failed;
+        continue;
+      }
+      Entries & entries = entries_[pending.first];
+      for (auto const& name : pending.second) {
+        Entry & entry = entries[name];
+        TNamed key((name + key_suffix).c_str(), entry.key.c_str());
+        file->WriteTObject(&entry.hist, name.c_str(), "Overwrite");
+        file->WriteTObject(&key, key.GetName(), "Overwrite");
+      }
+      file->Close();
+      delete file;
+    }
+    pending_.clear();
+    return n_failed;
+  }
+}
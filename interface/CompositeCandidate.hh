@@ -2,6 +2,7 @@
 #define ICHiggsTauTau_CompositeCandidate_hh
 #include <map>
 #include <string>
+#include <vector>
 #include <numeric>
 #include <functional>
 #include "Math/Vector4D.h"
@@ -24,6 +25,12 @@ namespace ic {
  * @warning The internal four-momentum is updated as soon as a Candidate is
  *added. If the four-momentum of this Candidate changes later, it will not be
  *reflected in the four-momentum of the CompositeCandidate.
+ *
+ * For two-body candidates the commonly used pair variables (\f$\Delta R\f$,
+ *transverse masses, \f$p_{\zeta}\f$, ...) are available through cached
+ *accessors. These are computed on first use and recomputed automatically if
+ *the four-momentum of either leg, of the CompositeCandidate itself or of the
+ *MET candidate has changed since.
  */
 class CompositeCandidate : public Candidate {
  public:
@@ -100,11 +107,77 @@ class CompositeCandidate : public Candidate {
    */
   double DeltaPhi(std::string name1, std::string name2) const;
 
+  /**
+   * @name Cached pair kinematics
+   * These use the first two constituents, at(0) and at(1), and return 0 if
+   * there are fewer than two. The MET-dependent values are kept separately
+   * for each MET candidate they are requested with. The definitions are the
+   * same as the MT, PZeta and PZetaVis functions in FnPredicates.h.
+   */
+  /**@{*/
+  /// \f$\Delta R\f$ between the two legs
+  double LegsDeltaR() const;
+
+  /// \f$\Delta\phi\f$ between the two legs
+  double LegsDeltaPhi() const;
+
+  /// Transverse mass of the two legs
+  double LegsMT() const;
+
+  /// Visible \f$p_{\zeta}\f$
+  double PZetaVis() const;
+
+  /// \f$p_{\zeta}^{miss} - \alpha\,p_{\zeta}^{vis}\f$
+  double PZeta(Candidate const* met, double const& alpha) const;
+
+  /// Transverse mass of leg at(index) with the MET, index must be 0 or 1
+  double MT(std::size_t const& index, Candidate const* met) const;
+
+  /// Transverse mass of the CompositeCandidate with the MET
+  double MT(Candidate const* met) const;
+
+  /// Transverse momentum of the CompositeCandidate plus the MET
+  double PtWithMET(Candidate const* met) const;
+
+  /// Drop all cached values
+  void ResetKinematicsCache() const;
+  /**@}*/
+
  private:
+  typedef ROOT::Math::PtEtaPhiEVector LorentzVector;
+
+  // The pair variables, valid while the stored four-momenta still match
+  struct PairKinematics {
+    bool valid;
+    LorentzVector pair;
+    LorentzVector leg1;
+    LorentzVector leg2;
+    double zeta_x;
+    double zeta_y;
+    double pzeta_vis;
+    double delta_r;
+    double delta_phi;
+    double mt_legs;
+  };
+  // The variables that also depend on one MET candidate
+  struct METKinematics {
+    Candidate const* met;
+    LorentzVector met_vector;
+    double pzeta_miss;
+    double mt_1;
+    double mt_2;
+    double mt_pair;
+    double pt_with_met;
+  };
+
   std::map<std::string, Candidate*> cand_map_;
   std::vector<Candidate*> cand_vec_;
+  mutable PairKinematics pair_cache_;
+  mutable std::vector<METKinematics> met_cache_;
 
   bool Verify(std::string const& name) const;
+  PairKinematics const* Pair() const;
+  METKinematics const* WithMET(Candidate const* met) const;
 };
 }
 #endif
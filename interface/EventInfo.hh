@@ -8,6 +8,8 @@ typedef char int8_t;
 
 #include <string>
 #include <map>
+#include <vector>
+#include <utility>
 #include <iostream>
 #include "UserCode/ICHiggsTauTau/interface/city.h"
 #include "Rtypes.h"
@@ -23,9 +25,14 @@ class EventInfo {
   typedef std::map<std::string, double> SDMap;
   typedef std::map<std::string, bool> SBMap;
   typedef std::map<std::size_t, float> TBMap;
+  // Pointers to the value and status of a weight in weights_ and
+  // weight_status_, which stay valid until the maps are read again
+  typedef std::pair<double*, bool*> WeightSlot;
 
  public:
   EventInfo();
+  EventInfo(EventInfo const& other);
+  EventInfo& operator=(EventInfo const& other);
   virtual ~EventInfo();
   virtual void Print() const;
 
@@ -148,11 +155,10 @@ class EventInfo {
     if (weight != weight) {
       std::cerr << " -- weight " << label << " has NAN value, setting to 1..."
                 << std::endl;
-      weights_[label] = 1.;
+      store_weight(label, 1., enabled);
     } else {
-      weights_[label] = weight;
+      store_weight(label, weight, enabled);
     }
-    weight_status_[label] = enabled;
   }
 
   /**
@@ -173,25 +179,25 @@ class EventInfo {
     if (weight != weight) {
       std::cerr << " -- weight " << label << " has NAN value, setting to 1..."
                 << std::endl;
-      weights_[label] = 1.0;
+      store_weight(label, 1.0, enabled);
     } else {
-      weights_[label] = weight;
+      store_weight(label, weight, enabled);
     }
-    weight_status_[label] = enabled;
   }
 
-  /// Calculate the product of all stored and enabled weights
+  /**
+   * @brief The product of all stored and enabled weights
+   * @details The product is kept up to date as weights are set, enabled
+   * and disabled, so calling this is cheap. Replacing or disabling a
+   * weight divides it out of the product, so the result can differ from
+   * a fresh product in the last digits.
+   */
   inline double total_weight() const {
-    SDMap::const_iterator it;
-    double weight = 1.0;
-    for (it = weights_.begin(); it != weights_.end(); ++it) {
-      SBMap::const_iterator st_it = weight_status_.find(it->first);
-      if (st_it != weight_status_.end()) {
-        if (!st_it->second) continue;
-      }
-      weight = it->second * weight;
+    if (!total_valid_) {
+      total_weight_ = compute_total_weight();
+      total_valid_ = true;
     }
-    return weight;
+    return total_weight_;
   }
   
   // Print the full set of enabled weights 
@@ -223,19 +229,71 @@ class EventInfo {
 
   /// Enable the weight with `label` in the total_weight() calculation
   inline void enable_weight(std::string label) {
-    if (weight_defined(label)) {
-      weight_status_[label] = true;
+    SDMap::iterator it = weights_.find(label);
+    if (it != weights_.end()) {
+      SBMap::iterator st_it = weight_status_.insert(std::make_pair(label, true)).first;
+      update_status(it->second, &st_it->second, true);
     }
   }
 
   /// Disable the weight with `label` in the total_weight() calculation
   inline void disable_weight(std::string label) {
-    if (weight_defined(label)) {
-      weight_status_[label] = false;
+    SDMap::iterator it = weights_.find(label);
+    if (it != weights_.end()) {
+      SBMap::iterator st_it = weight_status_.insert(std::make_pair(label, true)).first;
+      update_status(it->second, &st_it->second, false);
     }
   }
   /**@}*/
 
+  /// @name Event weights by handle
+  /// A handle is a small integer standing for a weight label. It is the same
+  /// in every event and every EventInfo of the job, so modules can get the
+  /// handles they need once in PreAnalysis() and skip the string lookups in
+  /// Execute(). The first access to a handle in an event looks up the label,
+  /// later accesses go straight to the stored value.
+  /**@{*/
+  /// The handle for `label`, allocated on first use
+  static unsigned weight_handle(std::string const& label);
+
+  /// The handles of the numbered labels "first", ..., "last", as used for
+  /// the families of generator weights (e.g. 2001 to 2100 for the PDF
+  /// variations)
+  static std::vector<unsigned> weight_handles(unsigned first, unsigned last);
+
+  /// The label of `handle`
+  static std::string const& weight_label(unsigned handle);
+
+  /// @copydoc weight(std::string) const
+  double weight(unsigned handle) const;
+
+  /// @copydoc weight_defined(std::string) const
+  inline bool weight_defined(unsigned handle) const {
+    return find_weight(handle).first != NULL;
+  }
+
+  /// Add a new weight, overriding any existing value with the same label
+  void set_weight(unsigned handle, double const& weight,
+                  bool const& enabled = true);
+
+  /// Return `true` if the weight is defined and enabled, `false` otherwise
+  inline bool weight_is_enabled(unsigned handle) const {
+    WeightSlot slot = find_weight(handle);
+    return slot.first && (!slot.second || *slot.second);
+  }
+
+  /// Enable the weight in the total_weight() calculation
+  void enable_weight(unsigned handle);
+
+  /// Disable the weight in the total_weight() calculation
+  void disable_weight(unsigned handle);
+
+  /// Fill `values[i]` with the weight of `handles[i]`, or with `fallback` if
+  /// it is not defined
+  void weights(std::vector<unsigned> const& handles, double * values,
+               double fallback = 1.0) const;
+  /**@}*/
+
   /// @name Event filters
   /**@{*/
   /// Get the map containing all filter results. The map key is the hash of
@@ -293,6 +351,20 @@ class EventInfo {
   unsigned good_vertices_;
   TBMap filters_;
 
+  // Transient: slots_[handle] once the handle has been looked up (cleared
+  // by the read rule in LinkDef.h when the maps are read from a file) and
+  // the running product for total_weight()
+  mutable std::vector<WeightSlot> slots_; //!
+  mutable double total_weight_; //!
+  mutable bool total_valid_; //!
+
+  WeightSlot find_weight(unsigned handle) const;
+  void store_weight(std::string const& label, double weight, bool enabled);
+  void update_status(double value, bool * status, bool enabled);
+  void update_total(bool removed, double old_value, bool added,
+                    double new_value);
+  double compute_total_weight() const;
+
  #ifndef SKIP_CINT_DICT
  public:
   ClassDef(EventInfo, 7);
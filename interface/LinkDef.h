@@ -84,6 +84,8 @@
 #pragma link C++ class std::vector<ic::L1TObject>+;
 
 #pragma link C++ class ic::EventInfo+;
+// The weight slots point into the maps being read, start again from scratch
+#pragma read sourceClass="ic::EventInfo" version="[1-]" targetClass="ic::EventInfo" source="" target="slots_,total_valid_" code="{ slots_.clear(); total_valid_ = false; }"
 
 #pragma link C++ class mithep::TH2DAsymErr+;
 
@@ -1,4 +1,5 @@
 import os
+import re
 import json
 import stat
 import copy
@@ -51,6 +52,135 @@ def run_command(dry_run, command):
         print '[DRY-RUN]: ' + command
 
 
+def read_tree_entries(files, tree='icEventProducer/EventTree', cache=None):
+    """Number of entries in the tree of each file. Only the file header and
+    the tree metadata are read, not the baskets. With a cache file the counts
+    are kept between calls, so each file is only opened once."""
+    import ROOT
+    known = {}
+    if cache is not None and os.path.isfile(cache):
+        with open(cache) as f:
+            known = json.load(f)
+    result = []
+    for fname in files:
+        key = '%s:%s' % (fname, tree)
+        if key not in known:
+            fin = ROOT.TFile.Open(fname)
+            if not fin or fin.IsZombie():
+                raise RuntimeError('Unable to open file %s' % fname)
+            t = fin.Get(tree)
+            if not t:
+                raise RuntimeError('Unable to find tree %s in file %s' % (tree, fname))
+            known[key] = int(t.GetEntries())
+            fin.Close()
+        result.append(known[key])
+    if cache is not None:
+        with open(cache, 'w') as f:
+            json.dump(known, f, indent=1)
+    return result
+
+
+def read_cost_per_event(logs):
+    """Average time per event in seconds from the logs of earlier jobs run
+    with timings enabled, or None if there are none. Uses the event loop
+    summary if a log has it, otherwise the sum of the module times."""
+    loop_re = re.compile(r'>> Event loop: (\d+) events in ([0-9.]+) s')
+    done_re = re.compile(r'>> Processing Complete: (\d+) events processed')
+    events = 0
+    seconds = 0.
+    for log in logs:
+        log_events = 0
+        loop_seconds = None
+        module_seconds = 0.
+        with open(log) as f:
+            for line in f:
+                m = loop_re.search(line)
+                if m:
+                    log_events = int(m.group(1))
+                    loop_seconds = float(m.group(2))
+                    continue
+                m = done_re.search(line)
+                if m:
+                    log_events = int(m.group(1))
+                    continue
+                # Module rows of the Post-analysis table: name, passed, [s], [ms]
+                cols = line.split()
+                if log_events > 0 and len(cols) >= 4 and cols[-3].isdigit():
+                    try:
+                        module_seconds += float(cols[-2])
+                        float(cols[-1])
+                    except ValueError:
+                        pass
+        if log_events == 0 or (loop_seconds is None and module_seconds == 0.):
+            continue
+        events += log_events
+        seconds += loop_seconds if loop_seconds is not None else module_seconds
+    if events == 0:
+        return None
+    return seconds / events
+
+
+def plan_entry_split_jobs(entries, cost_per_event, job_seconds, file_seconds=0.):
+    """Splits the entries of a list of files, given the number in each, into
+    jobs of about job_seconds. A job is modelled as costing cost_per_event
+    per entry plus file_seconds for each file it opens. The number of jobs is
+    fixed by the total cost, and the entries are then shared out so that each
+    job has the same cost. Returns the [first, last) global entry range of
+    each job, with entries numbered across the files in order."""
+    total = sum(entries)
+    if total == 0:
+        return []
+    total_cost = total * cost_per_event + file_seconds * len([n for n in entries if n > 0])
+    njobs = max(1, int(ceil(total_cost / job_seconds)))
+    # A split inside a file means opening it once more
+    total_cost += (njobs - 1) * file_seconds
+    budget = total_cost / njobs
+    jobs = []
+    first = 0
+    cost = 0.
+    offset = 0
+    for n in entries:
+        if n == 0:
+            continue
+        cost += file_seconds
+        pos = 0
+        while pos < n:
+            take = n - pos
+            if cost_per_event > 0.:
+                take = min(take, max(1, int(ceil((budget - cost) / cost_per_event))))
+            pos += take
+            cost += take * cost_per_event
+            if cost >= budget and len(jobs) < njobs - 1:
+                jobs.append([first, offset + pos])
+                first = offset + pos
+                # The next job opens this file again
+                cost = file_seconds if pos < n else 0.
+        offset += n
+    if first < total:
+        jobs.append([first, total])
+    return jobs
+
+
+def write_job_plan(plan_file, filelist, cost_per_event, job_seconds, file_prefix='',
+                   tree='icEventProducer/EventTree', file_seconds=0., cache=None):
+    """Writes the job plan of a filelist for the --job_plan option of the
+    analysis programs and returns the number of jobs"""
+    with open(filelist) as f:
+        files = [line.rstrip('\n') for line in f]
+    entries = read_tree_entries([file_prefix + x for x in files], tree, cache)
+    plan = {
+        'filelist': filelist,
+        'tree': tree,
+        'files': files,
+        'entries': entries,
+        'cost_per_event': cost_per_event,
+        'jobs': plan_entry_split_jobs(entries, cost_per_event, job_seconds, file_seconds)
+    }
+    with open(plan_file, 'w') as f:
+        json.dump(plan, f, indent=1)
+    return len(plan['jobs'])
+
+
 class Jobs:
     description = 'Simple job submission system'
 
@@ -129,6 +259,13 @@ class Jobs:
             self.job_queue.append(cmd)
             # print cmd
 
+    def add_entry_split_jobs(self, prog, plan_file):
+        with open(plan_file) as f:
+            njobs = len(json.load(f)['jobs'])
+        for n in xrange(njobs):
+            cmd = '%s --job_plan=%s --job=%i' % (prog, plan_file, n)
+            self.job_queue.append(cmd)
+
     def create_job_script(self, commands, script_filename, do_log=False):
         fname = script_filename
         logname = script_filename.replace('.sh', '.log')
@@ -2,11 +2,13 @@
 #include <set>
 #include <map>
 #include <string>
+#include <cmath>
+#include <iostream>
 #include "Math/VectorUtil.h"
 
 namespace ic {
 // Constructors
-CompositeCandidate::CompositeCandidate() {}
+CompositeCandidate::CompositeCandidate() { pair_cache_.valid = false; }
 
 CompositeCandidate::~CompositeCandidate() {}
 
@@ -15,6 +17,7 @@ void CompositeCandidate::AddCandidate(std::string name, Candidate* cand) {
   cand_vec_.push_back(cand);
   Candidate::set_vector(Candidate::vector() + cand->vector());
   Candidate::set_charge(Candidate::charge() + cand->charge());
+  ResetKinematicsCache();
 }
 
 Candidate* CompositeCandidate::GetCandidate(std::string name) const {
@@ -74,6 +77,126 @@ void CompositeCandidate::Print() const {
   }
 }
 
+namespace {
+// Same definition as MT in FnPredicates
+double TransverseMass(ROOT::Math::PtEtaPhiEVector const& v1,
+                      ROOT::Math::PtEtaPhiEVector const& v2) {
+  double mt = 2. * v1.pt() * v2.pt() *
+              (1. - cos(ROOT::Math::VectorUtil::DeltaPhi(v1, v2)));
+  if (mt > 0) {
+    return std::sqrt(mt);
+  } else {
+    std::cerr << "Transverse mass would be negative! Returning 0.0"
+              << std::endl;
+  }
+  return 0.0;
+}
+}
+
+void CompositeCandidate::ResetKinematicsCache() const {
+  pair_cache_.valid = false;
+  met_cache_.clear();
+}
+
+CompositeCandidate::PairKinematics const* CompositeCandidate::Pair() const {
+  if (cand_vec_.size() < 2) return NULL;
+  PairKinematics& c = pair_cache_;
+  if (c.valid && c.pair == vector() && c.leg1 == cand_vec_[0]->vector() &&
+      c.leg2 == cand_vec_[1]->vector()) {
+    return &c;
+  }
+  // Anything computed for the old four-momenta is now stale
+  met_cache_.clear();
+  c.pair = vector();
+  c.leg1 = cand_vec_[0]->vector();
+  c.leg2 = cand_vec_[1]->vector();
+  double zeta_x = cos(c.leg1.phi()) + cos(c.leg2.phi());
+  double zeta_y = sin(c.leg1.phi()) + sin(c.leg2.phi());
+  double zeta_r = std::sqrt(zeta_x * zeta_x + zeta_y * zeta_y);
+  if (zeta_r > 0.) {
+    zeta_x /= zeta_r;
+    zeta_y /= zeta_r;
+  }
+  c.zeta_x = zeta_x;
+  c.zeta_y = zeta_y;
+  c.pzeta_vis = (c.leg1.px() + c.leg2.px()) * zeta_x +
+                (c.leg1.py() + c.leg2.py()) * zeta_y;
+  c.delta_r = ROOT::Math::VectorUtil::DeltaR(c.leg1, c.leg2);
+  c.delta_phi = ROOT::Math::VectorUtil::DeltaPhi(c.leg1, c.leg2);
+  c.mt_legs = TransverseMass(c.leg1, c.leg2);
+  c.valid = true;
+  return &c;
+}
+
+CompositeCandidate::METKinematics const* CompositeCandidate::WithMET(
+    Candidate const* met) const {
+  PairKinematics const* p = Pair();
+  if (!p || !met) return NULL;
+  METKinematics* c = NULL;
+  for (unsigned i = 0; i < met_cache_.size(); ++i) {
+    if (met_cache_[i].met == met) {
+      if (met_cache_[i].met_vector == met->vector()) return &(met_cache_[i]);
+      c = &(met_cache_[i]);
+      break;
+    }
+  }
+  if (!c) {
+    met_cache_.push_back(METKinematics());
+    c = &(met_cache_.back());
+    c->met = met;
+  }
+  c->met_vector = met->vector();
+  c->pzeta_miss = c->met_vector.px() * p->zeta_x + c->met_vector.py() * p->zeta_y;
+  c->mt_1 = TransverseMass(p->leg1, c->met_vector);
+  c->mt_2 = TransverseMass(p->leg2, c->met_vector);
+  c->mt_pair = TransverseMass(p->pair, c->met_vector);
+  c->pt_with_met = (p->pair + c->met_vector).pt();
+  return c;
+}
+
+double CompositeCandidate::LegsDeltaR() const {
+  PairKinematics const* p = Pair();
+  return p ? p->delta_r : 0.0;
+}
+
+double CompositeCandidate::LegsDeltaPhi() const {
+  PairKinematics const* p = Pair();
+  return p ? p->delta_phi : 0.0;
+}
+
+double CompositeCandidate::LegsMT() const {
+  PairKinematics const* p = Pair();
+  return p ? p->mt_legs : 0.0;
+}
+
+double CompositeCandidate::PZetaVis() const {
+  PairKinematics const* p = Pair();
+  return p ? p->pzeta_vis : 0.0;
+}
+
+double CompositeCandidate::PZeta(Candidate const* met,
+                                 double const& alpha) const {
+  METKinematics const* m = WithMET(met);
+  return m ? m->pzeta_miss - alpha * pair_cache_.pzeta_vis : 0.0;
+}
+
+double CompositeCandidate::MT(std::size_t const& index,
+                              Candidate const* met) const {
+  METKinematics const* m = WithMET(met);
+  if (!m) return 0.0;
+  return index == 0 ? m->mt_1 : m->mt_2;
+}
+
+double CompositeCandidate::MT(Candidate const* met) const {
+  METKinematics const* m = WithMET(met);
+  return m ? m->mt_pair : 0.0;
+}
+
+double CompositeCandidate::PtWithMET(Candidate const* met) const {
+  METKinematics const* m = WithMET(met);
+  return m ? m->pt_with_met : 0.0;
+}
+
 bool CompositeCandidate::Verify(std::string const& name) const {
   static std::set<std::string> warned;
   if (!cand_map_.count(name)) {
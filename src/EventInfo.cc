@@ -1,4 +1,6 @@
 #include "../interface/EventInfo.hh"
+#include <cmath>
+#include <sstream>
 #include "boost/format.hpp"
 
 namespace ic {
@@ -13,10 +15,195 @@ EventInfo::EventInfo()
       gen_ht_(0.),
       n_outgoing_partons_(0),
       gen_mll_(0.),
-      good_vertices_(0) {}
+      good_vertices_(0),
+      total_weight_(1.),
+      total_valid_(false) {}
+
+EventInfo::EventInfo(EventInfo const& other) {
+  *this = other;
+}
+
+EventInfo& EventInfo::operator=(EventInfo const& other) {
+  is_data_ = other.is_data_;
+  event_ = other.event_;
+  run_ = other.run_;
+  lumi_block_ = other.lumi_block_;
+  bunch_crossing_ = other.bunch_crossing_;
+  jet_rho_ = other.jet_rho_;
+  lepton_rho_ = other.lepton_rho_;
+  gen_ht_ = other.gen_ht_;
+  n_outgoing_partons_ = other.n_outgoing_partons_;
+  gen_mll_ = other.gen_mll_;
+  weights_ = other.weights_;
+  weight_status_ = other.weight_status_;
+  good_vertices_ = other.good_vertices_;
+  filters_ = other.filters_;
+  // The slots point into the maps of other
+  slots_.clear();
+  total_weight_ = other.total_weight_;
+  total_valid_ = other.total_valid_;
+  return *this;
+}
 
 EventInfo::~EventInfo() {}
 
+namespace {
+// The labels of all the weight handles given out in this job
+struct WeightRegistry {
+  std::vector<std::string> labels;
+  std::map<std::string, unsigned> handles;
+};
+
+WeightRegistry & Registry() {
+  static WeightRegistry registry;
+  return registry;
+}
+}
+
+unsigned EventInfo::weight_handle(std::string const& label) {
+  WeightRegistry & reg = Registry();
+  std::map<std::string, unsigned>::const_iterator it = reg.handles.find(label);
+  if (it != reg.handles.end()) return it->second;
+  reg.labels.push_back(label);
+  reg.handles[label] = reg.labels.size() - 1;
+  return reg.labels.size() - 1;
+}
+
+std::vector<unsigned> EventInfo::weight_handles(unsigned first, unsigned last) {
+  std::vector<unsigned> handles;
+  for (unsigned i = first; i <= last; ++i) {
+    std::ostringstream label;
+    label << i;
+    handles.push_back(weight_handle(label.str()));
+  }
+  return handles;
+}
+
+std::string const& EventInfo::weight_label(unsigned handle) {
+  return Registry().labels.at(handle);
+}
+
+EventInfo::WeightSlot EventInfo::find_weight(unsigned handle) const {
+  if (handle < slots_.size() && slots_[handle].first) return slots_[handle];
+  std::string const& label = weight_label(handle);
+  SDMap::const_iterator it = weights_.find(label);
+  if (it == weights_.end()) return WeightSlot(NULL, NULL);
+  SBMap::const_iterator st_it = weight_status_.find(label);
+  // The setters write through the slots, they are only handed out to
+  // non-const callers
+  WeightSlot slot(const_cast<double*>(&it->second),
+                  st_it != weight_status_.end() ? const_cast<bool*>(&st_it->second) : NULL);
+  // A weight without a status entry is not cached, as one can be added
+  // behind the slot's back by the label-based setters
+  if (slot.second) {
+    if (handle >= slots_.size()) slots_.resize(handle + 1, WeightSlot(NULL, NULL));
+    slots_[handle] = slot;
+  }
+  return slot;
+}
+
+double EventInfo::weight(unsigned handle) const {
+  WeightSlot slot = find_weight(handle);
+  if (slot.first) return *slot.first;
+  std::cerr << "Weight \"" << weight_label(handle) << "\" not found!" << std::endl;
+  return 1.0;
+}
+
+void EventInfo::set_weight(unsigned handle, double const& weight,
+                           bool const& enabled) {
+  double value = weight;
+  if (value != value) {
+    std::cerr << " -- weight " << weight_label(handle)
+              << " has NAN value, setting to 1..." << std::endl;
+    value = 1.;
+  }
+  WeightSlot slot = find_weight(handle);
+  if (slot.first && slot.second) {
+    double old_value = *slot.first;
+    bool was_enabled = *slot.second;
+    *slot.first = value;
+    *slot.second = enabled;
+    update_total(was_enabled, old_value, enabled, value);
+  } else {
+    store_weight(weight_label(handle), value, enabled);
+  }
+}
+
+void EventInfo::enable_weight(unsigned handle) {
+  WeightSlot slot = find_weight(handle);
+  if (!slot.first) return;
+  if (slot.second) {
+    update_status(*slot.first, slot.second, true);
+  } else {
+    enable_weight(weight_label(handle));
+  }
+}
+
+void EventInfo::disable_weight(unsigned handle) {
+  WeightSlot slot = find_weight(handle);
+  if (!slot.first) return;
+  if (slot.second) {
+    update_status(*slot.first, slot.second, false);
+  } else {
+    disable_weight(weight_label(handle));
+  }
+}
+
+void EventInfo::weights(std::vector<unsigned> const& handles, double * values,
+                        double fallback) const {
+  for (unsigned i = 0; i < handles.size(); ++i) {
+    WeightSlot slot = find_weight(handles[i]);
+    values[i] = slot.first ? *slot.first : fallback;
+  }
+}
+
+void EventInfo::store_weight(std::string const& label, double weight,
+                             bool enabled) {
+  std::pair<SDMap::iterator, bool> w =
+      weights_.insert(std::make_pair(label, weight));
+  std::pair<SBMap::iterator, bool> st =
+      weight_status_.insert(std::make_pair(label, enabled));
+  // A weight without a status entry counts as enabled
+  bool was_enabled = !w.second && (st.second || st.first->second);
+  double old_value = w.first->second;
+  w.first->second = weight;
+  st.first->second = enabled;
+  update_total(was_enabled, old_value, enabled, weight);
+}
+
+void EventInfo::update_status(double value, bool * status, bool enabled) {
+  bool was_enabled = *status;
+  *status = enabled;
+  update_total(was_enabled, value, enabled, value);
+}
+
+void EventInfo::update_total(bool removed, double old_value, bool added,
+                             double new_value) {
+  if (!total_valid_) return;
+  if (removed && added && old_value == new_value) return;
+  if (removed) {
+    if (old_value == 0. || !std::isfinite(old_value)) {
+      total_valid_ = false;
+      return;
+    }
+    total_weight_ /= old_value;
+  }
+  if (added) total_weight_ *= new_value;
+}
+
+double EventInfo::compute_total_weight() const {
+  SDMap::const_iterator it;
+  double weight = 1.0;
+  for (it = weights_.begin(); it != weights_.end(); ++it) {
+    SBMap::const_iterator st_it = weight_status_.find(it->first);
+    if (st_it != weight_status_.end()) {
+      if (!st_it->second) continue;
+    }
+    weight = it->second * weight;
+  }
+  return weight;
+}
+
 void EventInfo::Print() const {
   std::cout << boost::format("%s\n") % std::string(30, '=');
   std::cout << boost::format("%-17s | %10i\n")   % "event"          % event_;